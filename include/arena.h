@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+
+#include "backend.h"
+
+/// Size of the chunks the arenas bump allocate from, larger requests get a chunk of their own
+static constexpr std::size_t arena_chunk_size = 1024 * 1024;
+
+/// Chunked bump pointer allocator. Allocating moves a pointer forward in the current chunk and
+/// takes the next one when it's full, single blocks can't be released. reset() releases everything
+/// at once, the chunks are kept for the following allocations. Not thread safe, the arena backend
+/// uses one per thread
+class Arena
+{
+public:
+    Arena() = default;
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /// Allocate size bytes aligned to alignment (a power of two, at least 16). The size is stored
+    /// in front of the block, so it can be reallocated
+    void* allocate(std::size_t size, std::size_t alignment = 16);
+
+    /// Same as allocate(), but the block is cleared. Chunks larger than the standard size are never
+    /// reused, so blocks in them are zero already
+    void* allocate_zeroed(std::size_t size);
+
+    /// Release all blocks. Standard chunks are kept as spares, larger ones are unmapped
+    void reset();
+
+    /// Size of a block returned by allocate()
+    static std::size_t block_size(const void* ptr);
+
+    /// Header at the start of every chunk
+    struct Chunk;
+
+private:
+    /// Take the next chunk with at least size usable bytes
+    bool next_chunk(std::size_t size);
+
+    /// Chunks handed out since the last reset, the current one first
+    Chunk* used_  = nullptr;
+    /// Standard chunks released by reset()
+    Chunk* spare_ = nullptr;
+
+    char* top_ = nullptr;
+    char* end_ = nullptr;
+};
+
+/// The arena backend: a thread local Arena, free does nothing and realloc always copies. The
+/// drivers call release() at phase boundaries, when all blocks of the thread are freed. Chunks of
+/// exited threads are reclaimed by the next release() of any thread
+Backend arena_backend();
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// Heap usage as reported by the allocator itself, in bytes
+struct HeapStats {
+    /// Bytes handed out to the application (including the allocator's rounding)
+    std::size_t in_use = 0;
+    /// Bytes the allocator got from the operating system
+    std::size_t mapped = 0;
+};
+
+/// An allocator which can be benchmarked. Everything is a plain function pointer, so the members
+/// can be called just like std::malloc and std::free
+struct Backend {
+    /// Name used on the command line and in all output
+    std::string name;
+
+    void* (*malloc)(std::size_t)                                    = nullptr;
+    void (*free)(void*)                                             = nullptr;
+    void* (*realloc)(void*, std::size_t)                            = nullptr;
+    void* (*aligned_alloc)(std::size_t alignment, std::size_t size) = nullptr;
+
+    /// Optional hooks, each worker thread calls them before and after running a workload
+    void (*thread_init)()     = nullptr;
+    void (*thread_teardown)() = nullptr;
+
+    /// Optional query of the allocator's own statistics, returns false if they aren't available
+    bool (*heap_stats)(HeapStats&) = nullptr;
+
+    /// Version of the allocator (or the library it was loaded from), recorded in the results
+    std::string version;
+
+    /// Optional bulk release of everything the calling thread allocated. The drivers call it at
+    /// phase boundaries, when none of the thread's blocks are live any more. Backends with it may
+    /// do nothing on free
+    void (*release)() = nullptr;
+
+    /// Optional calloc, the workloads use malloc and memset without it
+    void* (*calloc)(std::size_t count, std::size_t size) = nullptr;
+
+    /// Optional free which is told the size the block was allocated (or last reallocated) with, like
+    /// C23 free_sized and sized operator delete. Only used for blocks from malloc and realloc, the
+    /// workloads use free without it
+    void (*free_sized)(void*, std::size_t) = nullptr;
+
+    /// Optional explicit purge, which gives cached and free memory back to the operating system,
+    /// like malloc_trim(0). Unlike release, live blocks stay valid
+    void (*purge)() = nullptr;
+};
+
+/// All known backends, the built-in ones are registered on first use
+std::vector<Backend>& backend_registry();
+
+/// Add a backend to the registry, an existing backend with the same name is replaced
+void register_backend(Backend backend);
+
+/// Look up a backend by name, returns nullptr if no such backend is registered
+const Backend* find_backend(std::string_view name);
+
+/// RAII helper calling the per thread hooks of a backend (if it has any)
+class BackendThreadScope
+{
+public:
+    explicit BackendThreadScope(const Backend& backend) : backend_(backend)
+    {
+        if (backend_.thread_init)
+            backend_.thread_init();
+    }
+
+    ~BackendThreadScope()
+    {
+        if (backend_.thread_teardown)
+            backend_.thread_teardown();
+    }
+
+    BackendThreadScope(const BackendThreadScope&) = delete;
+    BackendThreadScope& operator=(const BackendThreadScope&) = delete;
+
+private:
+    const Backend& backend_;
+};
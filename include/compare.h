@@ -0,0 +1,26 @@
+#pragma once
+
+#include <vector>
+
+#include "results.h"
+
+/// Outcome of a comparison against a baseline
+struct CompareOutcome {
+    int regressions = 0;
+    /// Data points of the baseline this run didn't produce
+    long missing = 0;
+    /// Data points of this run which aren't in the baseline
+    long new_points = 0;
+};
+
+/// Compare the records of this run against the ones of a baseline run with the same test, thread
+/// count, backend and size. Prints the relative change of the alloc, free and total time, the p99
+/// latencies, the peak and retained RSS and the throughput per size and backend. A change of a
+/// time is significant if the confidence intervals of the trials don't overlap, values without
+/// trials only have to change by more than threshold. It's a regression if it's significant and
+/// worse by more than threshold (0.05 = 5%)
+CompareOutcome compare_results(const std::vector<ResultRecord>& baseline, const std::vector<ResultRecord>& current, double threshold);
+
+/// Arguments of a baseline's command line which are safe to rerun, i.e. without the options that
+/// write results or compare against a baseline again
+std::vector<std::string> rerun_arguments(const std::vector<std::string>& command);
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "backend.h"
+#include "types.h"
+
+/// Workloads on standard containers instead of raw buffers
+enum class ContainerWorkload {
+    /// Insert into an unordered_map, then erase and insert random keys
+    map_churn,
+    /// Grow a set of vectors element by element, without reserving
+    vector_growth,
+    /// Build two lists, then splice the nodes of one between the nodes of the other
+    list_splice,
+    /// Build strings from small pieces
+    string_build,
+};
+
+inline constexpr std::array<std::pair<ContainerWorkload, std::string_view>, 4> container_workloads{{
+    {ContainerWorkload::map_churn, "map-churn"},
+    {ContainerWorkload::vector_growth, "vector-growth"},
+    {ContainerWorkload::list_splice, "list-splice"},
+    {ContainerWorkload::string_build, "string-build"},
+}};
+
+/// std::pmr::memory_resource which allocates from a backend
+class BackendResource : public std::pmr::memory_resource
+{
+public:
+    explicit BackendResource(const Backend& backend) : backend_(backend) {}
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void  do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override;
+    bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    const Backend& backend_;
+};
+
+/// How a contender allocates, the standard resources sit on top of a BackendResource
+enum class ResourceKind {
+    backend,
+    monotonic,
+    unsynchronized_pool,
+    synchronized_pool,
+};
+
+/// Something the containers allocate from. The backend's name is the name of the contender
+struct Contender {
+    Backend      backend;
+    ResourceKind kind = ResourceKind::backend;
+};
+
+/// Every backend on its own, followed by the standard monotonic and pool resources on top of the
+/// first backend
+std::vector<Contender> container_contenders(const std::vector<Backend>& backends);
+
+/// Run workload with every contender for 2^4 to 2^max_container_power elements. The alloc time is
+/// the time to build the containers, the touch time the time to walk them once and the free time
+/// the time to destroy them (and release the standard resources)
+std::vector<Stats> container_alloc(const std::vector<Contender>& contenders, ContainerWorkload workload);
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "backend.h"
+
+/// Load an allocator from a shared object at runtime. The spec has the form `path/to/lib.so[:prefix]`,
+/// the entry points are resolved as `<prefix>malloc`, `<prefix>free` and so on.
+///
+/// The library is loaded with dlmopen into a new link map namespace, so an allocator which usually
+/// is used with LD_PRELOAD (e.g. Hoard or jemalloc) only replaces malloc inside this namespace and
+/// can be compared to glibc in the same process. If that fails, it falls back to a plain local
+/// dlopen. On failure std::nullopt is returned and error contains the reason.
+std::optional<Backend> load_backend(std::string_view spec, std::string& error);
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+/// Log-linear latency histogram in the spirit of HdrHistogram. Values below 2^sub_bucket_bits are
+/// stored exactly, above that every power of two is split into 2^sub_bucket_bits linear buckets,
+/// which bounds the relative error to about 3%. Recording is just an index computation and an
+/// increment, so it can be done for every single allocation.
+class Histogram
+{
+public:
+    /// Number of bits used for the linear sub buckets
+    static constexpr int sub_bucket_bits = 5;
+
+    /// Number of linear sub buckets per power of two
+    static constexpr std::uint64_t sub_bucket_count = std::uint64_t{1} << sub_bucket_bits;
+
+    /// Largest power of two which can be recorded, larger values are clamped (2^40 ns is ~18 minutes)
+    static constexpr int max_value_bits = 40;
+
+    /// Total number of buckets
+    static constexpr std::size_t bucket_count = sub_bucket_count * (max_value_bits - sub_bucket_bits + 2);
+
+    /// Record a value (usually nanoseconds) count times
+    void record(std::uint64_t value, std::uint64_t count = 1)
+    {
+        counts_[index_of(value)] += count;
+        total_count_ += count;
+        sum_ += value * count;
+        max_ = std::max(max_, value);
+    }
+
+    /// Add all values of other to this histogram, e.g. to combine the results of multiple threads
+    void merge(const Histogram& other)
+    {
+        for (std::size_t i = 0; i < bucket_count; ++i) {
+            counts_[i] += other.counts_[i];
+        }
+        total_count_ += other.total_count_;
+        sum_ += other.sum_;
+        max_ = std::max(max_, other.max_);
+    }
+
+    /// Value at the given percentile (in [0, 100]), i.e. the largest value which is equivalent to
+    /// the bucket the percentile falls into
+    std::uint64_t percentile(double p) const
+    {
+        if (total_count_ == 0)
+            return 0;
+
+        auto target = static_cast<std::uint64_t>(p / 100.0 * total_count_ + 0.5);
+        target      = std::clamp<std::uint64_t>(target, 1, total_count_);
+
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < bucket_count; ++i) {
+            seen += counts_[i];
+            if (seen >= target) {
+                return std::min(highest_equivalent_value(i), max_);
+            }
+        }
+        return max_;
+    }
+
+    std::uint64_t count() const { return total_count_; }
+
+    std::uint64_t sum() const { return sum_; }
+
+    std::uint64_t max() const { return max_; }
+
+    double mean() const { return total_count_ ? static_cast<double>(sum_) / total_count_ : 0.0; }
+
+private:
+    static std::size_t index_of(std::uint64_t value)
+    {
+        if (value < sub_bucket_count)
+            return value;
+
+        constexpr std::uint64_t max_value = (std::uint64_t{1} << (max_value_bits + 1)) - 1;
+        value                             = std::min(value, max_value);
+
+        // Position of the most significant bit decides the power of two, the next bits the sub bucket
+        const int msb      = 63 - __builtin_clzll(value);
+        const int exponent = msb - sub_bucket_bits;
+        const auto mantissa = value >> exponent;
+
+        return sub_bucket_count + exponent * sub_bucket_count + (mantissa - sub_bucket_count);
+    }
+
+    static std::uint64_t highest_equivalent_value(std::size_t index)
+    {
+        if (index < sub_bucket_count)
+            return index;
+
+        const auto exponent = (index - sub_bucket_count) / sub_bucket_count;
+        const auto mantissa = (index - sub_bucket_count) % sub_bucket_count + sub_bucket_count;
+
+        return ((mantissa + 1) << exponent) - 1;
+    }
+
+    std::array<std::uint64_t, bucket_count> counts_{};
+    std::uint64_t                           total_count_{};
+    std::uint64_t                           sum_{};
+    std::uint64_t                           max_{};
+};
+
+/// Percentiles shown in the latency tables and written to the results, with their name there
+inline constexpr std::array<std::pair<double, std::string_view>, 5> reported_percentiles{
+    {{50.0, "p50"}, {90.0, "p90"}, {99.0, "p99"}, {99.9, "p99_9"}, {100.0, "max"}}};
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/// What the workloads tell the kernel about transparent huge pages for the blocks they allocate
+enum class HugePagePolicy {
+    /// Nothing, the system settings decide
+    system,
+    /// madvise(MADV_HUGEPAGE) on every block which spans a huge page, and TBB's huge page mode on
+    huge,
+    /// madvise(MADV_NOHUGEPAGE) on every block which spans a huge page, and TBB's huge page mode off
+    nohuge,
+};
+
+inline HugePagePolicy huge_page_policy = HugePagePolicy::system;
+
+/// Parse "system", "huge" or "nohuge", returns false for anything else
+bool parse_huge_page_policy(std::string_view name, HugePagePolicy& policy);
+
+/// Settings in /sys/kernel/mm/transparent_hugepage, the selected values of enabled and defrag (e.g.
+/// "madvise"), "unavailable" without THP support
+struct ThpSettings {
+    std::string enabled;
+    std::string defrag;
+    std::size_t huge_page_size = 0;
+};
+
+ThpSettings read_thp_settings();
+
+/// Process wide part of huge_page_policy, has to be called before the first allocation of a backend
+void apply_huge_page_policy();
+
+/// Apply huge_page_policy to the huge page aligned part of a block. Blocks smaller than a huge page
+/// are left alone, as the advice would also hit their neighbours
+void advise_huge_pages(void* block, std::size_t size);
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <array>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "backend.h"
+#include "types.h"
+
+/// Linked structures of small nodes, built from the blocks of a backend and walked afterwards
+enum class LocalityStructure {
+    /// A singly linked list in the order of the allocations
+    list,
+    /// An unbalanced binary search tree of random keys, walked in key order
+    tree,
+    /// Hash chains of random keys, walked bucket by bucket
+    hash_chains,
+};
+
+inline constexpr std::array<std::pair<LocalityStructure, std::string_view>, 3> locality_structures{{
+    {LocalityStructure::list, "list"},
+    {LocalityStructure::tree, "tree"},
+    {LocalityStructure::hash_chains, "hash-chains"},
+}};
+
+/// Build structure with 2^10 to 2^max_locality_power nodes with every backend and time a walk over
+/// all of them. With churned, the heap is fragmented first by allocating blocks of random sizes
+/// and freeing a random half of them, the other half stays live while the structure is built.
+/// The alloc time is the time to build the structure, the touch time the walk and the free time
+/// the time to destroy it. Besides, the cache lines and pages the nodes lie on are counted
+std::vector<Stats> locality_alloc(const std::vector<Backend>& backends, LocalityStructure structure, bool churned);
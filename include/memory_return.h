@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "backend.h"
+#include "results.h"
+
+/// Configuration of the memory return test
+struct ReturnConfig {
+    /// Bytes allocated (and touched) before everything is freed
+    std::size_t peak = 512 * 1024 * 1024;
+    /// Seconds the RSS is followed after the free
+    double duration = 5.0;
+    /// Seconds between two RSS samples
+    double interval = 0.1;
+    /// Small blocks allocated and freed after every sample of the trickle load, and blocks of the
+    /// working set allocated around the purge
+    long trickle = 64;
+};
+
+/// Allocate a peak working set of small and of large blocks, free it and follow how much of it the
+/// backend gives back to the operating system over time: once idle, once under a light trickle of
+/// small allocations. Then the backend's explicit purge (malloc_trim and the like) is timed,
+/// together with the allocations right after it. Recorded as tests "memory-return-idle", "memory-return-trickle"
+/// and "memory-return-purge", with the largest block size of the working set as size
+void memory_return(const std::vector<Backend>& backends, const ReturnConfig& config, ResultsWriter* results);
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+
+struct Backend;
+
+/// Memory usage of the process as reported by the kernel, in bytes
+struct ProcessMemory {
+    std::size_t rss       = 0;
+    std::size_t pss       = 0;
+    /// Part of the RSS in transparent huge pages
+    std::size_t anon_huge = 0;
+};
+
+/// Read RSS, PSS and AnonHugePages from /proc/self/smaps_rollup, falls back to /proc/self/statm
+/// (RSS only)
+ProcessMemory read_process_memory();
+
+/// Page faults of the calling thread so far
+struct PageFaults {
+    long minor = 0;
+    long major = 0;
+};
+
+/// Read the page faults of the calling thread with getrusage(RUSAGE_THREAD)
+PageFaults read_thread_faults();
+
+/// Footprint of a backend for one size. All values are relative to the state before the workload
+/// started, the overhead ratios are process memory divided by the bytes requested by the workload
+struct MemoryStats {
+    long        samples{};
+    std::size_t peak_requested{};
+    std::size_t peak_rss{};
+    std::size_t peak_pss{};
+    std::size_t peak_heap{};
+    std::size_t peak_anon_huge{};
+    std::size_t retained_rss{};
+    double      peak_overhead{};
+    double      steady_overhead_sum{};
+    long        steady_samples{};
+
+    double steady_overhead() const { return steady_samples ? steady_overhead_sum / steady_samples : 0.0; }
+};
+
+/// Samples the memory usage while a backend runs a workload. The driver creates one per backend
+/// and size before starting the threads, each thread reports the number of bytes it currently has
+/// allocated and the tracker compares the sum of all threads against the process footprint
+class MemoryTracker
+{
+public:
+    explicit MemoryTracker(const Backend& backend);
+
+    /// Called by a workload thread, live_bytes is the number of requested bytes the thread
+    /// currently holds. Steady samples contribute to the steady state overhead
+    void sample(std::size_t live_bytes, bool steady);
+
+    /// Sample once more after the workload freed everything, to see how much memory is retained
+    MemoryStats finish();
+
+private:
+    const Backend& backend_;
+    ProcessMemory  baseline_;
+    std::size_t    baseline_heap_ = 0;
+    std::size_t    live_bytes_    = 0;
+    MemoryStats    stats_;
+    std::mutex     mtx_;
+};
+
+/// Tracker of the current thread, set by the drivers while a workload runs with '--memory'
+inline thread_local MemoryTracker* thread_memory = nullptr;
+
+/// Bytes of the current thread already reported to the tracker
+inline thread_local std::size_t thread_live_bytes = 0;
+
+/// Report that the current thread holds live_bytes requested bytes (if memory is tracked)
+inline void memory_sample(std::size_t live_bytes, bool steady)
+{
+    if (thread_memory)
+        thread_memory->sample(live_bytes, steady);
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "backend.h"
+#include "types.h"
+
+/// NUMA node with the CPUs this process may use on it
+struct NumaNode {
+    int              id = 0;
+    std::vector<int> cpus;
+};
+
+/// Nodes which have CPUs this process may run on. Without NUMA support everything is node 0
+std::vector<NumaNode> numa_topology();
+
+/// Memory policy of the calling thread as reported by get_mempolicy, e.g. "default" or "bind"
+std::string memory_policy_name();
+
+/// Count on which node the pages of the given blocks of N bytes are, compared to local_node. Asks
+/// the kernel with move_pages, falls back to get_mempolicy(MPOL_F_NODE | MPOL_F_ADDR)
+PagePlacement page_placement(const std::vector<std::byte*>& blocks, long N, int local_node);
+
+/// Allocate blocks on a thread of alloc_node, touch and free them on a thread of free_node, then
+/// allocate the same amount again on free_node. Reports the page placement of the first and of
+/// the reused allocations, the alloc and free latency and the time to touch the remote pages
+std::vector<Stats> numa_alloc(const std::vector<Backend>& backends, const NumaNode& alloc_node, const NumaNode& free_node);
@@ -0,0 +1,313 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "huge_pages.h"
+#include "memory_stats.h"
+#include "options.h"
+#include "perf_counters.h"
+#include "queue.h"
+#include "timer.h"
+#include "types.h"
+#include "util.h"
+
+/// The workloads are generated ahead of time into a flat list of operations, so the timed loops do
+/// nothing but walk the list and call the backend. No random numbers, shuffles or container
+/// bookkeeping happen while the timer runs
+
+enum class OpKind : std::uint8_t {
+    alloc,
+    /// Resize the live allocation of the slot, timed as an allocation
+    realloc,
+    free,
+};
+
+/// A single operation. Every slot holds one live allocation at a time
+struct Op {
+    std::uint64_t size;
+    std::uint32_t slot;
+    OpKind        kind;
+};
+
+/// Consecutive operations of the same kind which are timed together, or a point at which the live
+/// bytes are reported to the memory tracker (count is 0 then)
+struct OpBatch {
+    OpKind        kind;
+    bool          steady;
+    std::uint32_t count;
+    std::uint64_t live_bytes;
+};
+
+/// A generated workload
+struct OpStream {
+    std::vector<Op>      ops;
+    std::vector<OpBatch> batches;
+    std::size_t          num_slots{};
+    /// Sum of all allocated bytes
+    std::uint64_t        requested{};
+
+    /// Add an operation, batches are cut at timer_batch_size operations or when the kind changes
+    void push(OpKind kind, std::uint32_t slot, std::uint64_t size = 0);
+
+    /// Report live_bytes to the memory tracker at this point
+    void sample(std::uint64_t live_bytes, bool steady);
+};
+
+/// How the workloads write to the blocks they allocate. The writes are timed separately from the
+/// allocation, so the page faults of fresh memory show up as touch time
+enum class TouchPolicy : std::uint8_t {
+    /// Don't write, the allocation alone is measured
+    none,
+    /// One byte on every page
+    page,
+    /// The whole block with memset
+    memset,
+    /// The whole block with non-temporal stores, which bypass the caches (memset where there are none)
+    stream,
+};
+
+inline TouchPolicy touch_policy = TouchPolicy::none;
+
+/// Parse "none", "page", "memset" or "stream", returns false for anything else
+bool parse_touch_policy(std::string_view name, TouchPolicy& policy);
+
+/// Write size bytes at block according to touch_policy. Returns the number of pages written to
+long touch_block(void* block, std::size_t size);
+
+/// Seed of the current run, every workload, size and thread derives its own stream from it
+inline std::uint64_t workload_seed = 0;
+
+/// A workload generator, ipow is the power of two of the (mean) size
+using StreamGenerator = OpStream (*)(long ipow, std::uint64_t seed);
+
+/// Entry points of a backend a workload goes through. Backends without them get malloc and memset
+/// instead of calloc, malloc instead of aligned_alloc and free instead of free_sized
+enum class AllocPath : std::uint8_t {
+    /// malloc, realloc and free
+    plain,
+    /// calloc(1, size) instead of malloc
+    calloc,
+    /// aligned_alloc with 64 bytes alignment, like SIMD buffers
+    aligned_64,
+    /// aligned_alloc with 4 KiB alignment, like buffers for direct IO
+    aligned_4k,
+    /// free_sized instead of free
+    sized_free,
+};
+
+/// A workload generator, the entry points it uses and the powers of two it runs for. The rows of
+/// the tables are labelled with row_label, the powers of two are sizes for most workloads
+struct Workload {
+    StreamGenerator  generate;
+    AllocPath        path      = AllocPath::plain;
+    long             max_power = max_size_power;
+    long             min_power = 1;
+    std::string_view row_label = "Bytes";
+};
+
+/// Derive the seed of one data point of one thread from workload_seed
+std::uint64_t stream_seed(long ipow, int thread_id);
+
+/// Allocate a fixed size and free it right away
+OpStream basic_alloc_free_stream(long ipow, std::uint64_t seed);
+
+/// Same as basic_alloc_free_stream(), but with at most 4 GB allocated per size. For calloc, which
+/// may clear every byte
+OpStream zeroed_alloc_free_stream(long ipow, std::uint64_t seed);
+
+/// Allocate repeat chunks of a fixed size and free them in a random order
+OpStream alloc_permuted_free_stream(long ipow, std::uint64_t seed);
+
+/// Allocate repeat chunks of random size in [N/2, 2N] and free them in a random order
+OpStream random_alloc_permuted_free_stream(long ipow, std::uint64_t seed);
+
+/// Allocate a random number of random sized chunks, free a random number of the live chunks in a
+/// random order, repeat
+OpStream random_alloc_random_free_stream(long ipow, std::uint64_t seed);
+
+/// Grow eight buffers in turns with realloc, by half their size each time, from 16 bytes to 2^ipow
+/// bytes, then free them. Like vectors which grow with realloc
+OpStream realloc_growth_stream(long ipow, std::uint64_t seed);
+
+/// Ends fixed duration runs. The workloads poll it between their batches, which is a load of a
+/// cache line nobody writes to until the time is up
+class StopSignal
+{
+public:
+    StopSignal() = default;
+    ~StopSignal();
+
+    StopSignal(const StopSignal&) = delete;
+    StopSignal& operator=(const StopSignal&) = delete;
+
+    /// Raise the signal after seconds, from a helper thread
+    void arm(double seconds);
+
+    bool stopped() const { return stopped_.load(std::memory_order_relaxed); }
+
+private:
+    alignas(cache_line_size) std::atomic<bool> stopped_{false};
+    std::thread timer_;
+};
+
+/// Free what's still live when a stream is cut off before op, outside of the timed regions. A slot
+/// is live if its next free comes before its next alloc, every slot allocated after the cut is
+/// skipped
+template <typename Free>
+void release_remaining(const OpStream& stream, const Op* op, const std::vector<void*>& slots, const std::vector<std::uint64_t>& sizes,
+                       Free free)
+{
+    std::vector<bool> skipped(stream.num_slots);
+    for (; op != stream.ops.data() + stream.ops.size(); ++op) {
+        if (op->kind == OpKind::alloc) {
+            skipped[op->slot] = true;
+        } else if (op->kind == OpKind::free && !skipped[op->slot]) {
+            free(slots[op->slot], sizes[op->slot]);
+        }
+    }
+}
+
+/// Execute stream with the given backend functions. realloc is called as realloc(ptr, old_size,
+/// size) and free as free(ptr, size), with the size the block was allocated with. With a stop
+/// signal, the stream is repeated until it's raised, the pass which is cut off cleans up untimed.
+/// A release function is called after every pass, its time counts as free time
+template <typename Malloc, typename Realloc, typename Free>
+BackendStats run_stream(const OpStream& stream, Malloc malloc, Realloc realloc, Free free, void (*release)(),
+                        const StopSignal* stop = nullptr)
+{
+    BackendStats result;
+
+    std::vector<void*>         slots(stream.num_slots);
+    std::vector<std::uint64_t> sizes(stream.num_slots);
+
+    // Also counts the faults of the allocator itself, e.g. on fresh metadata
+    const auto faults       = read_thread_faults();
+    const auto count_faults = [&] {
+        const auto now = read_thread_faults();
+        result.minor_faults += now.minor - faults.minor;
+        result.major_faults += now.major - faults.major;
+    };
+
+    do {
+        const Op* op = stream.ops.data();
+
+        for (const auto& batch : stream.batches) {
+            if (stop && stop->stopped()) {
+                release_remaining(stream, op, slots, sizes, free);
+                if (release) {
+                    release();
+                }
+                count_faults();
+                return result;
+            }
+
+            if (batch.count == 0) {
+                memory_sample(batch.live_bytes, batch.steady);
+                continue;
+            }
+
+            if (batch.kind == OpKind::alloc) {
+                phase_begin(Phase::alloc);
+                auto alloc_start = timer_start();
+                for (std::uint32_t i = 0; i < batch.count; ++i) {
+                    slots[op[i].slot] = malloc(op[i].size);
+                }
+                auto alloc_end = timer_stop();
+                phase_end(Phase::alloc);
+                result.record_alloc(timer_elapsed(alloc_start, alloc_end), batch.count);
+
+                // Here we just tell the compiler, we used it somehow and therefore can't assume
+                // anything. Without it, the frees could be optimized away together with the allocs
+                for (std::uint32_t i = 0; i < batch.count; ++i) {
+                    escape(slots[op[i].slot]);
+                    sizes[op[i].slot] = op[i].size;
+                    result.bytes += op[i].size;
+                }
+
+                // Untimed, before the first touch decides the page size
+                if (huge_page_policy != HugePagePolicy::system) {
+                    for (std::uint32_t i = 0; i < batch.count; ++i) {
+                        advise_huge_pages(slots[op[i].slot], op[i].size);
+                    }
+                }
+
+                if (touch_policy != TouchPolicy::none) {
+                    auto touch_start = timer_start();
+                    for (std::uint32_t i = 0; i < batch.count; ++i) {
+                        result.touched_pages += touch_block(slots[op[i].slot], op[i].size);
+                    }
+                    auto touch_end = timer_stop();
+                    result.touch_elapsed += timer_elapsed(touch_start, touch_end);
+                }
+            } else if (batch.kind == OpKind::realloc) {
+                long in_place = 0;
+
+                phase_begin(Phase::alloc);
+                auto realloc_start = timer_start();
+                for (std::uint32_t i = 0; i < batch.count; ++i) {
+                    void* old = slots[op[i].slot];
+                    slots[op[i].slot] = realloc(old, sizes[op[i].slot], op[i].size);
+                    in_place += slots[op[i].slot] == old;
+                }
+                auto realloc_end = timer_stop();
+                phase_end(Phase::alloc);
+                result.record_alloc(timer_elapsed(realloc_start, realloc_end), batch.count);
+                result.reallocs += batch.count;
+                result.in_place_reallocs += in_place;
+
+                if (huge_page_policy != HugePagePolicy::system) {
+                    for (std::uint32_t i = 0; i < batch.count; ++i) {
+                        advise_huge_pages(slots[op[i].slot], op[i].size);
+                    }
+                }
+
+                // Only the grown part is new, the rest was touched before (and copied by realloc)
+                if (touch_policy != TouchPolicy::none) {
+                    auto touch_start = timer_start();
+                    for (std::uint32_t i = 0; i < batch.count; ++i) {
+                        const auto old_size = sizes[op[i].slot];
+                        if (slots[op[i].slot] && op[i].size > old_size) {
+                            result.touched_pages += touch_block(static_cast<char*>(slots[op[i].slot]) + old_size, op[i].size - old_size);
+                        }
+                    }
+                    auto touch_end = timer_stop();
+                    result.touch_elapsed += timer_elapsed(touch_start, touch_end);
+                }
+
+                for (std::uint32_t i = 0; i < batch.count; ++i) {
+                    escape(slots[op[i].slot]);
+                    sizes[op[i].slot] = op[i].size;
+                    result.bytes += op[i].size;
+                }
+            } else {
+                phase_begin(Phase::free);
+                auto free_start = timer_start();
+                for (std::uint32_t i = 0; i < batch.count; ++i) {
+                    free(slots[op[i].slot], sizes[op[i].slot]);
+                }
+                auto free_end = timer_stop();
+                phase_end(Phase::free);
+                result.record_free(timer_elapsed(free_start, free_end), batch.count);
+            }
+
+            op += batch.count;
+        }
+
+        // Bulk release at the end of the pass, everything is freed by now
+        if (release) {
+            auto release_start = timer_start();
+            release();
+            auto release_end = timer_stop();
+            result.free_elapsed += timer_elapsed(release_start, release_end);
+        }
+    } while (stop && !stop->stopped());
+
+    count_faults();
+    return result;
+}
@@ -5,6 +5,30 @@
 /// Max power for all loops this is equal to rougthly 4 GB
 static constexpr long max_size_power = 33;
 
+/// Max power for the message sizes of the producer/consumer test, messages are in flight at
+/// the same time, so this stays well below max_size_power
+static constexpr long max_message_size_power = 20;
+
+/// Max power for the NUMA test, large enough to get blocks served directly by mmap
+static constexpr long max_numa_size_power = 24;
+
+/// Max power for the realloc growth test. Reallocs which move copy the whole buffer, so this stays
+/// below max_size_power
+static constexpr long max_realloc_size_power = 26;
+
+/// Max power for the calloc test, allocators which clear every block touch all of it
+static constexpr long max_calloc_size_power = 30;
+
+/// Max power for the number of elements in the container tests
+static constexpr long max_container_power = 20;
+
+/// Max power for the number of nodes in the locality test
+static constexpr long max_locality_power = 20;
+
+/// Powers of the number of allocations in the modeled workload, a row is a run of that many
+static constexpr long min_modeled_allocs_power = 10;
+static constexpr long max_modeled_allocs_power = 20;
+
 /// Size of a kilobyte
 static constexpr long kilobyte = 1024;
 
@@ -15,23 +39,59 @@ static constexpr long megabyte = 1024 * 1024;
 static constexpr long gigabyte = 1024 * 1024 * 1024;
 
 ///
-/// options which can be set via command line
+/// options which can be set via command line, these are inline so all translation units share the
+/// same value
 ///
 
 /// Varialbe if you want to print the total time
-static bool print_total_time = false;
+inline bool print_total_time = false;
 
 /// Varialbe if you want to print results each round
-static bool print_round_time = true;
+inline bool print_round_time = true;
 
 /// Number of times to repeat an allocation test
-static long repeat = 100;
+inline long repeat = 100;
+
+/// Seconds every workload runs per data point, repeating its operations. 0 runs them once, with
+/// repeat rounds
+inline double run_duration = 0.0;
+
+/// Variable if the latency percentiles should be printed after each test
+inline bool print_latency_percentiles = false;
+
+/// Variable if performance counters should be captured for the alloc and free phases
+inline bool use_perf_counters = false;
+
+/// Variable if the memory footprint should be sampled during the workloads
+inline bool track_memory = false;
+
+/// Number of operations timed together, 1 times every single operation
+inline long timer_batch_size = 1;
+
+/// Rounds run before the measured trials of every data point, their results are thrown away
+inline int warmup_rounds = 1;
+
+/// Independent trials per data point
+inline int num_trials = 5;
+
+/// Upper bound of trials when extending them to reach ci_target
+inline int max_trials = 50;
+
+/// Trials are added until the confidence interval is narrower than this fraction of the median,
+/// 0 disables it
+inline double ci_target = 0.0;
+
+/// Confidence level of the intervals
+inline double confidence_level = 0.95;
+
+/// Bootstrap resamples used for each confidence interval
+static constexpr int bootstrap_resamples = 1000;
 
-/// Variable if statistic should be printed
-static bool print_statistics = true;
+/// Variable if the median, MAD and confidence interval of the trials should be printed
+inline bool print_trial_summary = false;
 
 /// Minimum number of allocations done randomly each iterations for certain tests
-static int min_num_random_allocs = 200;
+inline int min_num_random_allocs = 200;
 
 /// Maximum number of allocations done randomly each iterations for certain tests
-static int max_num_random_allocs = 500;
+inline int max_num_random_allocs = 500;
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+/// Phase of a workload the counters are attributed to
+enum class Phase { alloc = 0, free = 1 };
+
+/// Hardware and software events captured per phase
+enum PerfEvent {
+    perf_cycles,
+    perf_instructions,
+    perf_l1d_misses,
+    perf_llc_misses,
+    perf_dtlb_misses,
+    perf_page_faults,
+    perf_context_switches,
+    perf_event_count,
+};
+
+/// Short name of each event, used for table headers and the report
+inline constexpr std::array<std::string_view, perf_event_count> perf_event_names{
+    "cycles", "instructions", "l1d_misses", "llc_misses", "dtlb_misses", "page_faults", "ctx_switches"};
+
+/// Counter values of one phase. Events which couldn't be opened or never ran are marked as not available
+struct PerfCounts {
+    std::array<std::uint64_t, perf_event_count> values{};
+    std::array<bool, perf_event_count>          available{};
+
+    void merge(const PerfCounts& other)
+    {
+        for (int e = 0; e < perf_event_count; ++e) {
+            values[e] += other.values[e];
+            available[e] = available[e] || other.available[e];
+        }
+    }
+};
+
+/// Counter groups of the calling thread, one group per phase. Each group only counts while it's
+/// enabled, so the workloads enable the group of the phase right before each timed region and
+/// disable it afterwards.
+///
+/// If perf_event_paranoid only allows user space measurements, kernel events are excluded. Events
+/// which can't be opened at all (no PMU in a VM, paranoid level 3, ...) are skipped, if none can
+/// be opened ok() returns false and everything is a no-op.
+class PerfCounters
+{
+public:
+    PerfCounters();
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool ok() const { return groups_[0].leader >= 0; }
+
+    void enable(Phase phase);
+    void disable(Phase phase);
+
+    /// Counter values of a phase, scaled up if the kernel had to multiplex the counters
+    PerfCounts read(Phase phase) const;
+
+private:
+    struct Group {
+        int                                         leader = -1;
+        std::array<int, perf_event_count>           fds{};
+        std::array<std::uint64_t, perf_event_count> ids{};
+    };
+
+    std::array<Group, 2> groups_;
+};
+
+/// Counters of the current thread, set by the drivers while a workload runs with '--perf'
+inline thread_local PerfCounters* thread_counters = nullptr;
+
+/// Start counting for the given phase in the current thread (if counters are used)
+inline void phase_begin(Phase phase)
+{
+    if (thread_counters)
+        thread_counters->enable(phase);
+}
+
+/// Stop counting for the given phase in the current thread (if counters are used)
+inline void phase_end(Phase phase)
+{
+    if (thread_counters)
+        thread_counters->disable(phase);
+}
+
+/// Opens the counters of the calling thread for the lifetime of the object if enabled is set, and
+/// installs them as thread_counters
+class ThreadPerfCounters
+{
+public:
+    explicit ThreadPerfCounters(bool enabled)
+    {
+        if (enabled) {
+            counters_       = std::make_unique<PerfCounters>();
+            thread_counters = counters_.get();
+        }
+    }
+
+    ~ThreadPerfCounters()
+    {
+        if (counters_ && thread_counters == counters_.get()) {
+            thread_counters = nullptr;
+        }
+    }
+
+    ThreadPerfCounters(const ThreadPerfCounters&) = delete;
+    ThreadPerfCounters& operator=(const ThreadPerfCounters&) = delete;
+
+    /// Values of both phases so far, left untouched if counters are disabled
+    void read(PerfCounts& alloc, PerfCounts& free) const
+    {
+        if (counters_) {
+            alloc = counters_->read(Phase::alloc);
+            free  = counters_->read(Phase::free);
+        }
+    }
+
+private:
+    /// On the heap, so thread_counters never points into the stack frame of the owner
+    std::unique_ptr<PerfCounters> counters_;
+};
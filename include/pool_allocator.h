@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+#include "backend.h"
+
+/// Spacing of the size classes of the pool backend
+enum class PoolSpacing {
+    /// 16, 32, 64, ... little overhead in metadata, up to 50% internal fragmentation
+    pow2,
+    /// Four classes per power of two (16, 32, 48, 64, 80, 96, 112, 128, 160, ...), at most 25%
+    quarter,
+};
+
+/// Knobs of the pool backend, they have to be set before its first allocation
+
+/// Blocks each thread caches per size class, before it hands a batch back to the depot
+inline int pool_cache_size = 64;
+
+/// Blocks moved between a thread cache and the global depot at once
+inline int pool_batch_size = 32;
+
+/// Spacing of the size classes
+inline PoolSpacing pool_spacing = PoolSpacing::quarter;
+
+/// Largest size class, bigger requests are mapped directly
+static constexpr std::size_t pool_max_class_size = 256 * 1024;
+
+/// Size and alignment of the superblocks the size classes carve their blocks from. The owning
+/// class of a block is found in the header at the start of its superblock
+static constexpr std::size_t pool_superblock_size = 1024 * 1024;
+
+/// Parse "pow2" or "quarter", returns false for anything else
+bool parse_pool_spacing(std::string_view name, PoolSpacing& spacing);
+
+/// The pool backend: segregated size classes with a cache per thread and class, and a lock-free
+/// global depot per class, which takes and hands out batches of pool_batch_size blocks
+Backend pool_backend();
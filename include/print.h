@@ -1,79 +1,33 @@
 #pragma once
 
 #include <cstdio>
+#include <string_view>
+#include <vector>
 
 #include <fmt/format.h>
 
+#include "backend.h"
 #include "types.h"
 #include "options.h"
 
 // Just some print functions, which make everything a little bit cleaner
-void print_header(bool);
-void print_difference(float diff_total, float diff_alloc, float diff_free, bool);
-void print_round(long N, fsec alloc_elapsed, fsec free_elapsed, fsec tbb_alloc_elapsed, fsec tbb_free_elapsed, bool, bool);
-void print_stats(std::FILE* handle, const std::vector<Stats>& statistics);
-void print_stats(std::FILE* handle, const std::vector<int> threads, const std::vector<std::vector<Stats>>& statistics);
-
-template <typename T>
-void print_sqaure_brackets(std::FILE* handle, const std::vector<T>& v)
-{
-    if (v.empty())
-        return;
-
-    fmt::print(handle, "[");
-    if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
-        fmt::print(handle, "{:.10f}", v[0]);
-    } else {
-        fmt::print(handle, "{}", v[0]);
-    }
-
-    if (v.size() == 1) {
-        fmt::print(handle, "]");
-        return;
-    }
-
-    for (int i = 1; i < v.size(); ++i) {
-        if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
-            fmt::print(handle, ",{:.10f}", v[i]);
-        } else {
-            fmt::print(handle, ",{}", v[i]);
-        }
-    }
-    fmt::print(handle, "]");
-}
-
-template <typename T>
-void print_numpy(std::FILE* handle, std::string_view name, const std::vector<T>& v)
-{
-    if (v.empty())
-        return;
-
-    fmt::print(handle, "{} = np.array(", name);
-    print_sqaure_brackets(handle, v);
-    fmt::print(handle, ")\n");
-}
-
-template <typename T>
-void print_numpy(std::FILE* handle, std::string_view name, const std::vector<std::vector<T>>& v)
-{
-    if (v.empty())
-        return;
-
-    fmt::print(handle, "{} = np.array([\n    ", name);
-    print_sqaure_brackets(handle, v[0]);
-
-    if (v.size() == 1) {
-        fmt::print(handle, "])\n");
-        return;
-    }
-
-    // Once we know, we have to print more than one do the comma and newline
-    fmt::print(handle, ",\n    ");
-
-    for (int i = 1; i < v.size(); ++i) {
-        print_sqaure_brackets(handle, v[i]);
-        fmt::print(handle, ",\n    ");
-    }
-    fmt::print(handle, "])\n");
-}
-
+void print_header(const std::vector<Backend>& backends, bool, std::string_view row_label = "Bytes");
+void print_difference(float diff_total, float diff_alloc, float diff_free, bool, bool, bool, bool);
+void print_round(long N, const std::vector<BackendStats>& round, bool, bool, int num_threads = 1);
+void print_rate_header(const std::vector<Backend>& backends, std::string_view row_label = "Bytes");
+void print_rate_round(long N, const std::vector<BackendStats>& round, int num_threads, bool);
+void print_numa_header(const std::vector<Backend>& backends);
+void print_numa_round(long N, const std::vector<BackendStats>& round, bool);
+void print_container_header(const std::vector<Backend>& backends);
+void print_container_round(long N, const std::vector<BackendStats>& round, bool);
+void print_locality_header(const std::vector<Backend>& backends);
+void print_locality_round(long N, const std::vector<BackendStats>& round, bool);
+void print_trials(const std::vector<Backend>& backends, const std::vector<Stats>& statistics);
+void print_throughput(const std::vector<Backend>& backends, const std::vector<Stats>& statistics, int num_threads,
+                      std::string_view row_label = "Bytes");
+void print_reallocs(const std::vector<Backend>& backends, const std::vector<Stats>& statistics);
+void print_touch(const std::vector<Backend>& backends, const std::vector<Stats>& statistics);
+void print_totals(const std::vector<Backend>& backends, const std::vector<BackendStats>& results);
+void print_latencies(const std::vector<Backend>& backends, const std::vector<Stats>& statistics);
+void print_perf_counters(const std::vector<Backend>& backends, const std::vector<Stats>& statistics);
+void print_memory(const std::vector<Backend>& backends, const std::vector<Stats>& statistics);
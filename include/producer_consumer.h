@@ -0,0 +1,24 @@
+#pragma once
+
+#include <vector>
+
+#include "backend.h"
+#include "types.h"
+
+/// Configuration of the producer/consumer workload
+struct PipelineConfig {
+    /// Threads allocating messages
+    int producers = 1;
+    /// Threads freeing messages
+    int consumers = 1;
+    /// Messages a producer allocates before handing them over, and a consumer takes before freeing them
+    long batch = 1;
+    /// Messages each producer allocates per size
+    long messages = 10000;
+};
+
+/// Producers allocate messages and hand them through a lock-free queue (SPSC for one producer and
+/// one consumer, MPMC otherwise) to consumers, which free them. So every free is a remote free.
+/// The alloc times come from the producers, the free times from the consumers, and the wall clock
+/// time covers the whole pipeline from the first allocation to the last free
+std::vector<Stats> producer_consumer_alloc(const std::vector<Backend>& backends, const PipelineConfig& config);
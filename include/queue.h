@@ -0,0 +1,133 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+/// Size of a cache line, used to keep producer and consumer state apart
+inline constexpr std::size_t cache_line_size = 64;
+
+/// Bounded lock-free single producer single consumer ring buffer. Each side caches the last seen
+/// index of the other side, so the shared cache lines are only touched when the cached value
+/// isn't enough anymore. Capacity must be a power of two
+template <typename T>
+class SpscQueue
+{
+public:
+    explicit SpscQueue(std::size_t capacity) : mask_(capacity - 1), buffer_(std::make_unique<T[]>(capacity)) {}
+
+    bool push(T value)
+    {
+        const auto head = head_.load(std::memory_order_relaxed);
+        if (head - tail_cache_ > mask_) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if (head - tail_cache_ > mask_)
+                return false;
+        }
+
+        buffer_[head & mask_] = value;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T& value)
+    {
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_cache_) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if (tail == head_cache_)
+                return false;
+        }
+
+        value = buffer_[tail & mask_];
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    const std::size_t    mask_;
+    std::unique_ptr<T[]> buffer_;
+
+    alignas(cache_line_size) std::atomic<std::size_t> head_{0};
+    std::size_t tail_cache_{0};
+
+    alignas(cache_line_size) std::atomic<std::size_t> tail_{0};
+    std::size_t head_cache_{0};
+};
+
+/// Bounded lock-free multi producer multi consumer queue (Dmitry Vyukov's design). Every cell
+/// carries a sequence number telling whether it's ready to be written or read in the current lap.
+/// Capacity must be a power of two
+template <typename T>
+class MpmcQueue
+{
+public:
+    explicit MpmcQueue(std::size_t capacity) : mask_(capacity - 1), cells_(std::make_unique<Cell[]>(capacity))
+    {
+        for (std::size_t i = 0; i < capacity; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool push(T value)
+    {
+        auto  pos = enqueue_.load(std::memory_order_relaxed);
+        Cell* cell;
+
+        for (;;) {
+            cell           = &cells_[pos & mask_];
+            const auto seq = cell->sequence.load(std::memory_order_acquire);
+            const auto dif = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+
+            if (dif == 0) {
+                if (enqueue_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (dif < 0) {
+                return false;
+            } else {
+                pos = enqueue_.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->value = value;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T& value)
+    {
+        auto  pos = dequeue_.load(std::memory_order_relaxed);
+        Cell* cell;
+
+        for (;;) {
+            cell           = &cells_[pos & mask_];
+            const auto seq = cell->sequence.load(std::memory_order_acquire);
+            const auto dif = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+
+            if (dif == 0) {
+                if (dequeue_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (dif < 0) {
+                return false;
+            } else {
+                pos = dequeue_.load(std::memory_order_relaxed);
+            }
+        }
+
+        value = cell->value;
+        cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        T                        value;
+    };
+
+    const std::size_t       mask_;
+    std::unique_ptr<Cell[]> cells_;
+
+    alignas(cache_line_size) std::atomic<std::size_t> enqueue_{0};
+    alignas(cache_line_size) std::atomic<std::size_t> dequeue_{0};
+};
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "backend.h"
+#include "trace.h"
+#include "types.h"
+
+/// A single operation of a replayed thread. Pointers of the trace are replaced with slots, each
+/// slot holds one live allocation at a time
+struct ReplayOp {
+    TraceOp       op;
+    std::uint32_t slot;
+    /// Number of operations on this slot before this one, used to keep pointer lifetimes intact
+    std::uint32_t slot_version;
+    std::uint64_t size;
+    std::uint64_t alignment;
+    /// Position in the global order of the trace
+    std::uint64_t sequence;
+};
+
+/// A trace converted into per thread operation lists
+struct ReplayTrace {
+    std::vector<std::vector<ReplayOp>> threads;
+    std::size_t                        num_slots{};
+    std::size_t                        num_ops{};
+    std::uint64_t                      total_bytes{};
+    /// Frees and reallocs of pointers the trace never saw being allocated
+    std::size_t skipped{};
+};
+
+/// Read a trace written by the alloc_trace library, returns false and sets error on failure
+bool load_trace(const std::string& path, ReplayTrace& trace, std::string& error);
+
+/// Replay the trace with backend, one thread per traced thread. Each thread keeps the order of its
+/// operations, and an operation on a pointer waits until the previous operation on it (usually
+/// the allocation in another thread) is done. With strict set, all operations are executed in
+/// exactly the order of the trace instead
+BackendStats replay_trace(const ReplayTrace& trace, const Backend& backend, bool strict);
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "backend.h"
+#include "types.h"
+
+/// File formats of the results
+enum class ResultsFormat {
+    /// One JSON object per line, the first one describes the run, every other one is a record
+    jsonl,
+    /// All records as typed columns after a small header, see scripts/results.py for a reader
+    columnar,
+};
+
+/// Parse "jsonl" or "columnar", returns false for anything else
+bool parse_results_format(std::string_view name, ResultsFormat& format);
+
+/// Everything needed to reproduce a run and to tell runs apart
+struct RunMetadata {
+    std::string start_time;
+    std::string host;
+    std::string cpu;
+    std::string kernel;
+    int         cpus = 0;
+
+    /// The command line as given
+    std::vector<std::string> command;
+    /// Settings after parsing, including the defaults
+    std::vector<std::pair<std::string, std::string>> options;
+    /// Name and version of every compared backend
+    std::vector<std::pair<std::string, std::string>> backends;
+};
+
+/// One test, thread count, size and backend with all its measured values
+struct ResultRecord {
+    std::string test;
+    int         threads = 0;
+    std::string backend;
+    long        size = 0;
+
+    /// Same names and order in every record, values which weren't measured are NaN
+    std::vector<std::pair<std::string, double>> fields;
+
+    /// Value of a field, NaN if there is no such field
+    double field(std::string_view name) const;
+};
+
+/// Read a results file of either format. The command line and options of the run are returned in
+/// run, the rest of its metadata isn't read
+bool load_results(const std::string& path, RunMetadata& run, std::vector<ResultRecord>& records, std::string& error);
+
+/// Fill in the host, CPU and kernel, the options are added by the caller
+RunMetadata collect_run_metadata(int argc, char** argv, const std::vector<Backend>& backends);
+
+/// Writes one record per test, thread count, size and backend. JSON Lines are written as they
+/// come in, the columnar format keeps everything in memory and is written on destruction. Without
+/// a path nothing is written, but the records are still kept for comparing against a baseline
+class ResultsWriter
+{
+public:
+    ResultsWriter(const std::string& path, ResultsFormat format, const RunMetadata& metadata);
+    ~ResultsWriter();
+
+    ResultsWriter(const ResultsWriter&) = delete;
+    ResultsWriter& operator=(const ResultsWriter&) = delete;
+
+    bool ok() const { return !writing_ || file_ != nullptr; }
+
+    /// Add the results of one test run with the given number of threads
+    void record(std::string_view test, int threads, const std::vector<Backend>& backends, const std::vector<Stats>& statistics);
+
+    /// Everything recorded so far
+    const std::vector<ResultRecord>& records() const { return records_; }
+
+private:
+    enum class ColumnType : std::uint8_t { f64 = 0, i64 = 1, string = 2 };
+
+    struct Column {
+        std::string                name;
+        ColumnType                 type;
+        std::vector<double>        f64;
+        std::vector<std::int64_t>  i64;
+        std::vector<std::uint32_t> index;
+        std::vector<std::string>   dictionary;
+    };
+
+    Column& column(std::size_t i, std::string_view name, ColumnType type);
+    void    add_string(Column& column, std::string_view value);
+    void    write_columns();
+
+    std::FILE*                file_    = nullptr;
+    bool                      writing_ = false;
+    ResultsFormat             format_;
+    std::string               metadata_;
+    std::vector<Column>       columns_;
+    std::uint64_t             rows_ = 0;
+    std::vector<ResultRecord> records_;
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "options.h"
+#include "statistics.h"
+#include "types.h"
+
+/// Repeat one data point: warmup_rounds trials which are thrown away, then num_trials measured
+/// ones. With a ci_target, trials are added until the confidence intervals of the alloc and free
+/// times are narrower than ci_target relative to their median, or max_trials is reached.
+/// The elapsed times of the result are the medians of the trials, the histograms and counters
+/// contain all trials, everything else comes from the last trial. With per_operation, the trials
+/// did a varying number of operations (fixed duration runs), so the times are divided by it
+template <typename Trial>
+BackendStats run_trials(Trial&& trial, bool per_operation = false)
+{
+    for (int i = 0; i < warmup_rounds; ++i) {
+        trial();
+    }
+
+    std::vector<double> alloc, free, total, wall, touch, alloc_rate, byte_rate;
+    BackendStats        result;
+    Histogram           alloc_latency, free_latency;
+    PerfCounts          alloc_counters, free_counters;
+
+    auto summarize_all = [&] {
+        result.alloc_summary = summarize(alloc, confidence_level, bootstrap_resamples);
+        result.free_summary  = summarize(free, confidence_level, bootstrap_resamples);
+        result.total_summary = summarize(total, confidence_level, bootstrap_resamples);
+    };
+
+    auto done = [&] {
+        if (static_cast<int>(alloc.size()) < num_trials)
+            return false;
+        if (ci_target <= 0.0 || static_cast<int>(alloc.size()) >= max_trials)
+            return true;
+
+        summarize_all();
+        return result.alloc_summary.relative_width() <= ci_target && result.free_summary.relative_width() <= ci_target;
+    };
+
+    while (!done()) {
+        result = trial();
+
+        const double allocs = per_operation ? std::max<long>(1, result.alloc_latency.count()) : 1;
+        const double frees  = per_operation ? std::max<long>(1, result.free_latency.count()) : 1;
+
+        alloc.push_back(result.alloc_elapsed.count() / allocs);
+        free.push_back(result.free_elapsed.count() / frees);
+        total.push_back(alloc.back() + free.back());
+        wall.push_back(result.wall_elapsed.count());
+        touch.push_back(result.touch_elapsed.count());
+
+        const double seconds = result.wall_elapsed.count();
+        alloc_rate.push_back(seconds > 0 ? result.alloc_latency.count() / seconds : 0.0);
+        byte_rate.push_back(seconds > 0 ? result.bytes / seconds : 0.0);
+
+        alloc_latency.merge(result.alloc_latency);
+        free_latency.merge(result.free_latency);
+        alloc_counters.merge(result.alloc_counters);
+        free_counters.merge(result.free_counters);
+    }
+
+    summarize_all();
+
+    result.alloc_elapsed  = fsec(result.alloc_summary.median);
+    result.free_elapsed   = fsec(result.free_summary.median);
+    result.wall_elapsed   = fsec(median(wall));
+    result.touch_elapsed  = fsec(median(touch));
+    result.alloc_rate     = median(alloc_rate);
+    result.byte_rate      = median(byte_rate);
+    result.alloc_latency  = alloc_latency;
+    result.free_latency   = free_latency;
+    result.alloc_counters = alloc_counters;
+    result.free_counters  = free_counters;
+    return result;
+}
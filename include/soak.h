@@ -0,0 +1,26 @@
+#pragma once
+
+#include <vector>
+
+#include "backend.h"
+#include "results.h"
+
+/// Configuration of the soak test
+struct SoakConfig {
+    /// Seconds every backend runs
+    double duration = 60.0;
+    /// Seconds between two samples of the time series
+    double interval = 1.0;
+    /// Threads running the workload at once
+    int threads = 1;
+    /// Live blocks per thread, rounded up to a power of two of at least 1024
+    long live_blocks = 16384;
+};
+
+/// Every thread allocates its live blocks with sizes from model_sizes, then keeps replacing them in
+/// a random order until the duration is over, so the heap ages the way it does in a long running
+/// service. Every interval the throughput, the latency percentiles and the footprint of the last
+/// interval are printed and recorded as test "soak", with the number of the interval as size.
+/// JSON Lines results are written as they come, a run which is cut off keeps the series up to there
+/// Backends which release their blocks in bulk are skipped, the whole soak is a single phase
+void soak_alloc(const std::vector<Backend>& backends, const SoakConfig& config, ResultsWriter* results);
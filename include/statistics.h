@@ -0,0 +1,36 @@
+#pragma once
+
+#include <vector>
+
+/// Robust summary of the trials of one data point. Samples further than outlier_mads scaled MADs
+/// from the median of all of them are rejected, the median, the MAD and the bootstrap confidence
+/// interval of the median are those of the kept samples
+struct Summary {
+    int    trials   = 0;
+    int    outliers = 0;
+    int    kept     = 0;
+    double median   = 0.0;
+    double mad      = 0.0;
+    double ci_low   = 0.0;
+    double ci_high  = 0.0;
+
+    /// Width of the confidence interval relative to the median, 0 without an interval
+    double relative_width() const { return median > 0.0 ? (ci_high - ci_low) / median : 0.0; }
+
+    /// There is an interval only with at least two trials
+    bool has_interval() const { return trials > 1; }
+};
+
+/// Samples further away from the median than this many MADs (scaled to a standard deviation) are
+/// rejected as outliers
+inline constexpr double outlier_mads = 3.0;
+
+/// Median of the values, the vector is reordered
+double median(std::vector<double>& values);
+
+/// Median, MAD and a percentile bootstrap interval of the median of the samples which aren't
+/// outliers, for the given confidence
+Summary summarize(std::vector<double> samples, double confidence, int resamples);
+
+/// Two data points only differ significantly if their confidence intervals don't overlap
+bool significant(const Summary& a, const Summary& b);
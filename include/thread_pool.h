@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "queue.h"
+#include "types.h"
+
+/// How the workers of a WorkerPool are pinned to CPUs
+enum class Affinity {
+    /// Let the scheduler decide, threads may migrate
+    none,
+    /// Fill one core, cache and node after the other, hyperthreads first. Threads share caches
+    compact,
+    /// Spread the threads round robin over nodes, last level caches and cores before using hyperthreads
+    scatter,
+    /// Thread i may run on any CPU of NUMA node i % nodes
+    numa,
+};
+
+/// Affinity of the workers used by the threaded tests
+inline Affinity worker_affinity = Affinity::none;
+
+/// Parse "none", "compact", "scatter" or "numa", returns false for anything else
+bool parse_affinity(std::string_view name, Affinity& affinity);
+
+/// The CPUs each of num_threads threads may run on. Empty sets for Affinity::none
+std::vector<std::vector<int>> affinity_cpu_sets(Affinity affinity, int num_threads);
+
+/// Pin the calling thread to the given CPUs, does nothing for an empty set
+bool pin_current_thread(const std::vector<int>& cpus);
+
+/// Reusable barrier for a fixed number of threads, which spins instead of sleeping, so all
+/// threads leave it within a few hundred cycles of each other. After a bounded spin, waiting
+/// threads yield, so more threads than cores still get through quickly
+class SpinBarrier
+{
+public:
+    explicit SpinBarrier(int count) : count_(count) {}
+
+    /// Wait until all threads arrived. Returns true in exactly one thread, the last to arrive
+    bool arrive_and_wait();
+
+private:
+    const int count_;
+
+    alignas(cache_line_size) std::atomic<int> waiting_{0};
+    alignas(cache_line_size) std::atomic<unsigned> generation_{0};
+};
+
+/// Fixed set of pinned worker threads, which is reused for all rounds of a test, so thread
+/// creation doesn't end up in the measurements. The tasks call start_together() right before
+/// their timed region and finish() right after it, which gives the wall clock time of the round
+class WorkerPool
+{
+public:
+    WorkerPool(int num_threads, Affinity affinity);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    int size() const { return static_cast<int>(threads_.size()); }
+
+    /// Run task(thread_id) on every worker and wait until all of them returned
+    void run(const std::function<void(int)>& task);
+
+    /// Wait for all workers, the wall clock starts when the last one arrives. Returns true in
+    /// exactly that worker
+    bool start_together();
+
+    /// The worker is done with its timed region
+    void finish(int thread_id);
+
+    /// Time from the start of the last run until the last worker called finish()
+    fsec wall_elapsed() const;
+
+private:
+    void work(int thread_id, std::vector<int> cpus);
+
+    std::vector<std::thread> threads_;
+
+    std::mutex                         mutex_;
+    std::condition_variable            wake_;
+    std::condition_variable            done_;
+    const std::function<void(int)>*    task_ = nullptr;
+    unsigned long                      job_  = 0;
+    int                                running_ = 0;
+    bool                               stop_    = false;
+
+    SpinBarrier                     start_;
+    stdclock::time_point            start_time_;
+    std::vector<stdclock::time_point> end_times_;
+};
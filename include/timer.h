@@ -0,0 +1,76 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC_TIMER 1
+#endif
+
+#include "types.h"
+
+/// Clock used to time the measured regions
+enum class TimerSource {
+    /// std::chrono::steady_clock, portable but reading it costs about as much as a small allocation
+    steady_clock,
+    /// Time stamp counter read with rdtsc/rdtscp and lfence, requires an invariant TSC
+    tsc,
+};
+
+/// Raw timestamp of the selected timer source
+using ticks = std::uint64_t;
+
+/// Currently selected timer source, set by init_timer()
+inline TimerSource timer_source = TimerSource::steady_clock;
+
+/// Nanoseconds per tick of the selected source, calibrated at startup for the TSC
+inline double timer_ns_per_tick = 1.0;
+
+/// Measured cost of an empty start/stop pair in ticks, it's subtracted from every measurement
+inline ticks timer_overhead = 0;
+
+/// Select the timer source, calibrate its frequency and measure its overhead. Falls back to the
+/// steady clock if the TSC is requested but not invariant. Returns the source actually used
+TimerSource init_timer(TimerSource requested);
+
+/// Parse "steady" or "tsc", returns false for anything else
+bool parse_timer_source(std::string_view name, TimerSource& source);
+
+/// Timestamp at the beginning of a timed region. The fences make sure no earlier instruction is
+/// still in flight and no later one starts before the counter is read
+inline ticks timer_start()
+{
+#ifdef HAVE_TSC_TIMER
+    if (timer_source == TimerSource::tsc) {
+        _mm_lfence();
+        ticks t = __rdtsc();
+        _mm_lfence();
+        return t;
+    }
+#endif
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(stdclock::now().time_since_epoch()).count();
+}
+
+/// Timestamp at the end of a timed region. rdtscp waits for all previous instructions to finish,
+/// the fence keeps later ones from starting before the counter is read
+inline ticks timer_stop()
+{
+#ifdef HAVE_TSC_TIMER
+    if (timer_source == TimerSource::tsc) {
+        unsigned int aux;
+        ticks        t = __rdtscp(&aux);
+        _mm_lfence();
+        return t;
+    }
+#endif
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(stdclock::now().time_since_epoch()).count();
+}
+
+/// Time between start and stop with the timer overhead removed
+inline stdclock::duration timer_elapsed(ticks start, ticks stop)
+{
+    const ticks elapsed = stop > start + timer_overhead ? stop - start - timer_overhead : 0;
+    return std::chrono::duration_cast<stdclock::duration>(std::chrono::duration<double, std::nano>(elapsed * timer_ns_per_tick));
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+/// Where a logical CPU sits in the machine, read from /sys/devices/system
+struct CpuInfo {
+    int cpu = 0;
+    /// Core id, hyperthreads of the same core share it
+    int core = 0;
+    /// Socket
+    int package = 0;
+    /// Last level cache, on Ryzen/EPYC this is the CCX. Falls back to the package
+    int llc = 0;
+    /// NUMA node, 0 if the kernel has no NUMA support
+    int node = 0;
+};
+
+/// All CPUs this process is allowed to run on, sorted by CPU number
+std::vector<CpuInfo> read_cpu_topology();
+
+/// Ids of the NUMA nodes that have memory, at least node 0
+std::vector<int> memory_nodes();
+
+/// Parse a kernel CPU/node list like "0-3,8,10-11"
+bool parse_cpu_list(std::string_view text, std::vector<int>& list);
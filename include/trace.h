@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+
+/// Binary format of allocation traces, written by the alloc_trace interposer library and read by
+/// '--replay'. A trace is a TraceHeader followed by TraceRecords. Records of different threads are
+/// flushed in blocks, so they are only ordered per thread, use the timestamp for the global order.
+
+/// Operations which are recorded
+enum class TraceOp : std::uint8_t {
+    malloc,
+    calloc,
+    realloc,
+    memalign,
+    free,
+    /// The release of the input pointer of a realloc, recorded before the call. The realloc itself
+    /// is recorded after it returns, so a block freed in between by another thread sorts before it
+    realloc_release,
+};
+
+struct TraceHeader {
+    char          magic[8];
+    std::uint32_t version;
+    std::uint32_t record_size;
+};
+
+struct TraceRecord {
+    /// Nanoseconds since the trace started
+    std::uint64_t timestamp;
+    /// Returned pointer, or the released one for free and realloc_release
+    std::uint64_t address;
+    /// Requested size, for calloc already multiplied out
+    std::uint64_t size;
+    /// Input pointer for realloc, alignment for memalign
+    std::uint64_t extra;
+    /// Dense index of the thread, in order of the thread's first allocation
+    std::uint32_t thread;
+    TraceOp       op;
+    std::uint8_t  padding[3];
+};
+
+inline constexpr char          trace_magic[8] = {'A', 'L', 'L', 'O', 'C', 'T', 'R', 'C'};
+inline constexpr std::uint32_t trace_version  = 2;
@@ -4,18 +4,79 @@
 #include <tuple>
 #include <vector>
 
-/// Typedefs for clock stuff, as the std names are just to long
-using fsec     = std::chrono::duration<float>;
+#include "histogram.h"
+#include "memory_stats.h"
+#include "perf_counters.h"
+#include "statistics.h"
+
+/// Typedefs for clock stuff, as the std names are just to long. Durations are summed over many
+/// operations, so use double precision
+using fsec     = std::chrono::duration<double>;
 using stdclock = std::chrono::steady_clock;
 
-using StatsVecTuple = std::tuple<std::vector<long>, std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>>;
-using StatsVecOfVecTuple = std::tuple<std::vector<std::vector<long>>, std::vector<std::vector<double>>, std::vector<std::vector<double>>,
-                                      std::vector<std::vector<double>>, std::vector<std::vector<double>>>;
+/// NUMA node of the pages a backend handed out, relative to the node of the thread that asked for
+/// them. Pages which aren't mapped (yet) or can't be queried are unknown
+struct PagePlacement {
+    long local{};
+    long remote{};
+    long unknown{};
+
+    double local_ratio() const { return local + remote ? static_cast<double>(local) / (local + remote) : 0.0; }
+};
+
+/// Timings of a single backend for a single size. The workloads record every operation, the elapsed
+/// times are the sum of all operations and the histograms keep the distribution (in nanoseconds).
+/// The counters are only filled with '--perf' and the memory stats with '--memory'. Workloads which
+/// measure throughput also set the wall clock time of the whole run and the bytes moved, the ones
+/// which write to the memory the time and number of pages touched and the page faults of the
+/// thread, the realloc workloads how many blocks stayed in place, and the NUMA test the placement of
+/// fresh and of reused pages. With several trials, the summaries describe the alloc, free and
+/// total time of the individual trials
+struct BackendStats {
+    fsec          alloc_elapsed{};
+    fsec          free_elapsed{};
+    fsec          wall_elapsed{};
+    fsec          touch_elapsed{};
+    long          bytes{};
+    long          touched_pages{};
+    long          minor_faults{};
+    long          major_faults{};
+    long          reallocs{};
+    long          in_place_reallocs{};
+    /// Distinct cache lines and pages the nodes of a walked structure lie on
+    long          walked_lines{};
+    long          walked_pages{};
+    /// Allocations and allocated bytes per second of wall clock time
+    double        alloc_rate{};
+    double        byte_rate{};
+    PagePlacement first_placement{};
+    PagePlacement reuse_placement{};
+    Histogram     alloc_latency{};
+    Histogram     free_latency{};
+    PerfCounts    alloc_counters{};
+    PerfCounts    free_counters{};
+    MemoryStats   memory{};
+    Summary       alloc_summary{};
+    Summary       free_summary{};
+    Summary       total_summary{};
+
+    /// Record count allocations which took elapsed in total, each one is recorded with the average
+    void record_alloc(stdclock::duration elapsed, long count = 1)
+    {
+        alloc_elapsed += elapsed;
+        alloc_latency.record(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / count, count);
+    }
+
+    /// Record count frees which took elapsed in total, each one is recorded with the average
+    void record_free(stdclock::duration elapsed, long count = 1)
+    {
+        free_elapsed += elapsed;
+        free_latency.record(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / count, count);
+    }
+};
 
+/// Timings of all backends for a single size, in the order the backends were selected
 struct Stats {
-    long num_bytes{};
-    fsec alloc_elapsed{};
-    fsec free_elapsed{};
-    fsec tbb_alloc_elapsed{};
-    fsec tbb_free_elasped{};
+    long                      num_bytes{};
+    std::vector<BackendStats> backends{};
 };
@@ -1,7 +1,12 @@
 #pragma once
 
+#include <thread>
 #include <vector>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
 #include "types.h"
 
 /// Taken fron Chandler Carruth's CppCon 2015 talk "Tuning C++: Benchmarks, and CPUs, and Compilers!
@@ -25,6 +30,27 @@ static void clobber()
     asm volatile("" : : : "memory");
 }
 
-StatsVecTuple split_stats(const std::vector<Stats>& stats);
- 
-StatsVecOfVecTuple split_2d_stats(const std::vector<std::vector<Stats>>& stats);
+/// Hint to the CPU that we're in a spin loop, so it can save power and let the sibling hyperthread run
+static inline void cpu_relax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#endif
+}
+
+/// Spins before a waiting thread yields its core
+inline constexpr int spins_before_yield = 1024;
+
+/// Wait until done returns true, spinning first and yielding the core later on. With more threads
+/// than cores, the thread waited for may need the core of the waiting one
+template <typename Done>
+void wait_until(Done&& done)
+{
+    for (int spins = 0; !done(); ++spins) {
+        if (spins < spins_before_yield) {
+            cpu_relax();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
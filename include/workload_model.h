@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "op_stream.h"
+
+/// Distribution the requested sizes are drawn from
+struct SizeDistribution {
+    enum class Kind {
+        /// Log-normal around a median, most sizes are small, a few are very large
+        lognormal,
+        /// Zipf over size classes, the smallest class is the most frequent
+        zipf,
+        /// Sizes and weights read from a file, e.g. taken from a heap profile
+        histogram,
+    };
+
+    Kind   kind   = Kind::lognormal;
+    double median = 64.0;
+    double sigma  = 1.5;
+
+    /// The classes (zipf) or sizes (histogram) with their weights
+    std::vector<std::uint64_t> sizes;
+    std::vector<double>        weights;
+};
+
+/// How many allocations later a block is freed again
+struct LifetimeModel {
+    enum class Kind {
+        /// Exponentially distributed around a mean
+        exponential,
+        /// Pareto distributed with a minimum, heavy tailed for small alpha
+        pareto,
+        /// Mostly short lived blocks, the rest lives long or (with a long mean of 0) until the end
+        generational,
+    };
+
+    Kind   kind           = Kind::exponential;
+    double mean           = 1000.0;
+    double alpha          = 1.5;
+    double minimum        = 1.0;
+    double short_fraction = 0.9;
+    double short_mean     = 10.0;
+    double long_mean      = 0.0;
+};
+
+/// Parse a size distribution: "lognormal:<median>:<sigma>", "zipf:<exponent>[:<largest class>]" or
+/// "hist:<file>". The file has a size and a weight per line, '#' starts a comment
+bool parse_size_distribution(std::string_view spec, SizeDistribution& distribution, std::string& error);
+
+/// Parse a lifetime model, lifetimes are counted in allocations: "exp:<mean>",
+/// "pareto:<alpha>:<minimum>" or "gen:<short fraction>:<short mean>[:<long mean>]"
+bool parse_lifetime_model(std::string_view spec, LifetimeModel& model, std::string& error);
+
+/// Model of the modeled workload, set from the command line before any stream is generated
+inline SizeDistribution model_sizes;
+inline LifetimeModel    model_lifetimes;
+
+/// Allocate 2^ipow blocks with sizes from model_sizes, each one is freed after a lifetime drawn
+/// from model_lifetimes. Whatever is still live at the end is freed in the order of its lifetime
+OpStream modeled_stream(long ipow, std::uint64_t seed);
+
+/// Draw count sizes from model_sizes, for workloads which don't need lifetimes
+std::vector<std::uint64_t> sample_sizes(std::size_t count, std::uint64_t seed);
@@ -1,2438 +0,0 @@
-import numpy as np
-threads = np.array([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
-bytes = np.array([
-    [
-        2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384,
-        32768, 65536, 131072, 262144, 524288, 1048576, 2097152, 4194304,
-        8388608, 16777216, 33554432, 67108864, 134217728, 268435456, 536870912,
-        1073741824, 2147483648, 4294967296, 8589934592
-    ],
-    [
-        2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384,
-        32768, 65536, 131072, 262144, 524288, 1048576, 2097152, 4194304,
-        8388608, 16777216, 33554432, 67108864, 134217728, 268435456, 536870912,
-        1073741824, 2147483648, 4294967296, 8589934592
-    ],
-    [
-        2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384,
-        32768, 65536, 131072, 262144, 524288, 1048576, 2097152, 4194304,
-        8388608, 16777216, 33554432, 67108864, 134217728, 268435456, 536870912,
-        1073741824, 2147483648, 4294967296, 8589934592
-    ],
-    [
-        2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384,
-        32768, 65536, 131072, 262144, 524288, 1048576, 2097152, 4194304,
-        8388608, 16777216, 33554432, 67108864, 134217728, 268435456, 536870912,
-        1073741824, 2147483648, 4294967296, 8589934592
-    ],
-    [
-        2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384,
-        32768, 65536, 131072, 262144, 524288, 1048576, 2097152, 4194304,
-        8388608, 16777216, 33554432, 67108864, 134217728, 268435456, 536870912,
-        1073741824, 2147483648, 4294967296, 8589934592
-    ],
-    [
-        2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384,
-        32768, 65536, 131072, 262144, 524288, 1048576, 2097152, 4194304,
-        8388608, 16777216, 33554432, 67108864, 134217728, 268435456, 536870912,
-        1073741824, 2147483648, 4294967296, 8589934592
-    ],
-    [
-        2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384,
-        32768, 65536, 131072, 262144, 524288, 1048576, 2097152, 4194304,
-        8388608, 16777216, 33554432, 67108864, 134217728, 268435456, 536870912,
-        1073741824, 2147483648, 4294967296, 8589934592
-    ],
-    [
-        2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384,
-        32768, 65536, 131072, 262144, 524288, 1048576, 2097152, 4194304,
-        8388608, 16777216, 33554432, 67108864, 134217728, 268435456, 536870912,
-        1073741824, 2147483648, 4294967296, 8589934592
-    ],
-    [
-        2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384,
-        32768, 65536, 131072, 262144, 524288, 1048576, 2097152, 4194304,
-        8388608, 16777216, 33554432, 67108864, 134217728, 268435456, 536870912,
-        1073741824, 2147483648, 4294967296, 8589934592
-    ],
-    [
-        2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384,
-        32768, 65536, 131072, 262144, 524288, 1048576, 2097152, 4194304,
-        8388608, 16777216, 33554432, 67108864, 134217728, 268435456, 536870912,
-        1073741824, 2147483648, 4294967296, 8589934592
-    ],
-    [
-        2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384,
-        32768, 65536, 131072, 262144, 524288, 1048576, 2097152, 4194304,
-        8388608, 16777216, 33554432, 67108864, 134217728, 268435456, 536870912,
-        1073741824, 2147483648, 4294967296, 8589934592
-    ],
-    [
-        2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384,
-        32768, 65536, 131072, 262144, 524288, 1048576, 2097152, 4194304,
-        8388608, 16777216, 33554432, 67108864, 134217728, 268435456, 536870912,
-        1073741824, 2147483648, 4294967296, 8589934592
-    ],
-    [
-        2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384,
-        32768, 65536, 131072, 262144, 524288, 1048576, 2097152, 4194304,
-        8388608, 16777216, 33554432, 67108864, 134217728, 268435456, 536870912,
-        1073741824, 2147483648, 4294967296, 8589934592
-    ],
-    [
-        2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384,
-        32768, 65536, 131072, 262144, 524288, 1048576, 2097152, 4194304,
-        8388608, 16777216, 33554432, 67108864, 134217728, 268435456, 536870912,
-        1073741824, 2147483648, 4294967296, 8589934592
-    ],
-    [
-        2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384,
-        32768, 65536, 131072, 262144, 524288, 1048576, 2097152, 4194304,
-        8388608, 16777216, 33554432, 67108864, 134217728, 268435456, 536870912,
-        1073741824, 2147483648, 4294967296, 8589934592
-    ],
-    [
-        2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384,
-        32768, 65536, 131072, 262144, 524288, 1048576, 2097152, 4194304,
-        8388608, 16777216, 33554432, 67108864, 134217728, 268435456, 536870912,
-        1073741824, 2147483648, 4294967296, 8589934592
-    ],
-])
-
-threads = np.array([1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16])
-first_allocs = np.array([
-    [
-        0.0000053869, 0.0000058269, 0.0000049531, 0.0000049550, 0.0000067119,
-        0.0000060606, 0.0000060169, 0.0000054237, 0.0004400144, 0.0004748403,
-        0.0004220829, 0.0004409986, 0.0004433378, 0.0003488414, 0.0003189100,
-        0.0001353128, 0.0001376756, 0.0001279463, 0.0003314189, 0.0000689219,
-        0.0001674394, 0.0011812289, 0.0004804016, 0.0023726725, 0.0013061214,
-        0.0020487297, 0.0113190021, 0.0124014001, 0.0146085229, 0.0161000565,
-        0.0159759521, 0.0181847084, 0.0179367848
-    ],
-    [
-        0.0000035137, 0.0000030238, 0.0000039250, 0.0000039706, 0.0000043925,
-        0.0000041744, 0.0000052112, 0.0000055937, 0.0004402331, 0.0004236524,
-        0.0003520959, 0.0004234892, 0.0003834105, 0.0003859250, 0.0003974800,
-        0.0000675556, 0.0000710006, 0.0000806063, 0.0002811039, 0.0003920841,
-        0.0005542766, 0.0012095209, 0.0011270508, 0.0008884580, 0.0013308163,
-        0.0026497596, 0.0113925384, 0.0137432767, 0.0122533077, 0.0162357222,
-        0.0174869597, 0.0168376863, 0.0177864842
-    ],
-    [
-        0.0000052475, 0.0000054169, 0.0000054525, 0.0000057156, 0.0000055469,
-        0.0000047350, 0.0000051581, 0.0000049925, 0.0003612013, 0.0003904523,
-        0.0004421949, 0.0004531168, 0.0002623422, 0.0002810196, 0.0003600987,
-        0.0000647625, 0.0000586331, 0.0000641956, 0.0001206919, 0.0003243148,
-        0.0003322870, 0.0016801647, 0.0024183495, 0.0017747479, 0.0009434508,
-        0.0004552809, 0.0105381962, 0.0131109497, 0.0149794137, 0.0143148806,
-        0.0172722749, 0.0186714511, 0.0175678004
-    ],
-    [
-        0.0000056631, 0.0000054600, 0.0000046012, 0.0000036169, 0.0000034687,
-        0.0000034056, 0.0000033725, 0.0000036294, 0.0004807741, 0.0004144507,
-        0.0003599894, 0.0004880785, 0.0005043691, 0.0004527466, 0.0003688112,
-        0.0000799821, 0.0000753100, 0.0001039044, 0.0002394114, 0.0004935671,
-        0.0006046479, 0.0003813865, 0.0006148095, 0.0012175785, 0.0011150318,
-        0.0006172768, 0.0100544384, 0.0130622918, 0.0152690150, 0.0176811628,
-        0.0182356369, 0.0166852586, 0.0166507661
-    ],
-    [
-        0.0000048775, 0.0000047837, 0.0000044950, 0.0000053069, 0.0000057544,
-        0.0000055462, 0.0000057881, 0.0000057350, 0.0005579531, 0.0005032744,
-        0.0004987738, 0.0004974541, 0.0004907522, 0.0004778930, 0.0004138387,
-        0.0000729975, 0.0000677900, 0.0000943395, 0.0003537289, 0.0003011277,
-        0.0006565116, 0.0006822841, 0.0013732868, 0.0011094435, 0.0027380600,
-        0.0016444292, 0.0115118464, 0.0147794252, 0.0160939600, 0.0185540840,
-        0.0197302774, 0.0170196109, 0.0200982057
-    ],
-    [
-        0.0000048769, 0.0000040956, 0.0000048869, 0.0000048169, 0.0000048869,
-        0.0000049131, 0.0000051456, 0.0000051856, 0.0003680339, 0.0003848625,
-        0.0004023962, 0.0003666371, 0.0003610394, 0.0004387981, 0.0004165652,
-        0.0001815033, 0.0002089025, 0.0001856120, 0.0006856525, 0.0022563080,
-        0.0019975875, 0.0029686813, 0.0019807399, 0.0026884815, 0.0014467875,
-        0.0024456771, 0.0133167356, 0.0132666212, 0.0143937645, 0.0195101127,
-        0.0197502933, 0.0144524733, 0.0188942663
-    ],
-    [
-        0.0000041231, 0.0000040756, 0.0000055425, 0.0000053525, 0.0000044131,
-        0.0000043187, 0.0000043269, 0.0000048612, 0.0004739413, 0.0004334670,
-        0.0004361543, 0.0004136227, 0.0004604029, 0.0005493811, 0.0004110014,
-        0.0001168806, 0.0000859100, 0.0001235128, 0.0006883213, 0.0002210463,
-        0.0008293767, 0.0011522438, 0.0007761854, 0.0006211103, 0.0026910866,
-        0.0012716765, 0.0126472171, 0.0141080320, 0.0103220316, 0.0179542825,
-        0.0196527317, 0.0167858750, 0.0192924235
-    ],
-    [
-        0.0000051900, 0.0000051850, 0.0000043094, 0.0000033675, 0.0000036981,
-        0.0000027731, 0.0000031688, 0.0000027663, 0.0003662439, 0.0004431844,
-        0.0004377025, 0.0003394553, 0.0003929586, 0.0003908589, 0.0003889480,
-        0.0001747313, 0.0001603522, 0.0002332141, 0.0003793345, 0.0021281098,
-        0.0026330962, 0.0026497000, 0.0007299160, 0.0007794818, 0.0010272283,
-        0.0019999531, 0.0124160592, 0.0140985530, 0.0174393058, 0.0191051289,
-        0.0158343837, 0.0181474444, 0.0192473661
-    ],
-    [
-        0.0000051012, 0.0000051925, 0.0000051219, 0.0000048131, 0.0000049581,
-        0.0000050156, 0.0000055931, 0.0000056675, 0.0003489897, 0.0003184167,
-        0.0003208253, 0.0003091663, 0.0003534425, 0.0002616259, 0.0002820448,
-        0.0001361226, 0.0001417812, 0.0001196390, 0.0004968346, 0.0023065014,
-        0.0022031844, 0.0017214348, 0.0011180249, 0.0010916627, 0.0006614161,
-        0.0022363269, 0.0130089689, 0.0139484480, 0.0189112201, 0.0187506601,
-        0.0211767536, 0.0191713646, 0.0190810636
-    ],
-    [
-        0.0000050581, 0.0000050231, 0.0000054031, 0.0000052569, 0.0000051412,
-        0.0000050375, 0.0000052075, 0.0000052069, 0.0003581986, 0.0004281050,
-        0.0004914233, 0.0004376924, 0.0004831763, 0.0004752606, 0.0003730925,
-        0.0001011558, 0.0000990206, 0.0001043227, 0.0003707629, 0.0006927641,
-        0.0013358395, 0.0007198356, 0.0001957751, 0.0009536747, 0.0007939311,
-        0.0023234617, 0.0129481964, 0.0140530784, 0.0142790833, 0.0159222521,
-        0.0175125897, 0.0165651925, 0.0175197404
-    ],
-    [
-        0.0000039419, 0.0000043900, 0.0000036406, 0.0000034725, 0.0000038806,
-        0.0000036556, 0.0000036844, 0.0000034856, 0.0002458606, 0.0003487581,
-        0.0003433840, 0.0003918145, 0.0003889825, 0.0003942198, 0.0003732979,
-        0.0001158140, 0.0001422408, 0.0001627400, 0.0004767891, 0.0009737598,
-        0.0015268688, 0.0019013189, 0.0014195727, 0.0004084496, 0.0020416752,
-        0.0013362516, 0.0134129860, 0.0141711077, 0.0158448443, 0.0182966888,
-        0.0175903961, 0.0176836830, 0.0187335853
-    ],
-    [
-        0.0000051619, 0.0000046875, 0.0000038656, 0.0000038800, 0.0000040244,
-        0.0000040725, 0.0000046537, 0.0000047487, 0.0004231241, 0.0003713843,
-        0.0004183585, 0.0004022236, 0.0003952202, 0.0004133219, 0.0004690994,
-        0.0001866956, 0.0001933777, 0.0002616298, 0.0007945573, 0.0014207105,
-        0.0014547009, 0.0022790588, 0.0007877645, 0.0007073691, 0.0014929960,
-        0.0009611005, 0.0125249419, 0.0144938370, 0.0140282884, 0.0176930986,
-        0.0200335998, 0.0189613234, 0.0179425739
-    ],
-    [
-        0.0000040038, 0.0000037956, 0.0000030850, 0.0000030025, 0.0000032094,
-        0.0000026194, 0.0000029625, 0.0000050294, 0.0003921775, 0.0004513169,
-        0.0004446812, 0.0004297609, 0.0004111243, 0.0003620502, 0.0003681118,
-        0.0001733617, 0.0001131809, 0.0002206138, 0.0002812838, 0.0009919475,
-        0.0012663607, 0.0031049508, 0.0008356112, 0.0010968770, 0.0013839185,
-        0.0017000871, 0.0106979795, 0.0148373796, 0.0154215144, 0.0147542283,
-        0.0179295912, 0.0201237313, 0.0197821576
-    ],
-    [
-        0.0000050675, 0.0000042275, 0.0000040056, 0.0000041506, 0.0000045456,
-        0.0000047144, 0.0000044437, 0.0000045844, 0.0004620475, 0.0004201194,
-        0.0003964907, 0.0004797670, 0.0004151687, 0.0003926116, 0.0003995786,
-        0.0001757891, 0.0001888344, 0.0002490963, 0.0005196841, 0.0011491388,
-        0.0010914240, 0.0022537429, 0.0014287975, 0.0011511431, 0.0013977287,
-        0.0015750424, 0.0131932218, 0.0151875932, 0.0134835774, 0.0180928428,
-        0.0186550841, 0.0169289988, 0.0176916756
-    ],
-    [
-        0.0000043519, 0.0000051244, 0.0000049506, 0.0000052587, 0.0000054619,
-        0.0000054975, 0.0000054188, 0.0000052031, 0.0003922327, 0.0003139264,
-        0.0004373978, 0.0004673918, 0.0004442700, 0.0004212125, 0.0004420381,
-        0.0001736263, 0.0001685708, 0.0001811119, 0.0004719628, 0.0010087924,
-        0.0013558933, 0.0010021828, 0.0011013182, 0.0015099877, 0.0020012541,
-        0.0016782216, 0.0116017852, 0.0119818859, 0.0149973519, 0.0173544548,
-        0.0174564905, 0.0189653095, 0.0196856968
-    ],
-    [
-        0.0000029394, 0.0000031400, 0.0000048194, 0.0000048387, 0.0000030013,
-        0.0000036094, 0.0000036331, 0.0000033012, 0.0003003369, 0.0002997410,
-        0.0004234847, 0.0008858546, 0.0003918201, 0.0003907901, 0.0004456916,
-        0.0001466103, 0.0001279177, 0.0001998707, 0.0006284342, 0.0003866934,
-        0.0011567579, 0.0008823225, 0.0012542142, 0.0002422152, 0.0015380176,
-        0.0015266314, 0.0119093573, 0.0138744107, 0.0145570925, 0.0190957021,
-        0.0171949845, 0.0186249521, 0.0184071679
-    ],
-])
-first_frees = np.array([
-    [
-        0.0000039781, 0.0000040894, 0.0000047925, 0.0000047169, 0.0000046075,
-        0.0000052831, 0.0000046525, 0.0000047644, 0.0004314012, 0.0004996549,
-        0.0004576820, 0.0004772646, 0.0004237380, 0.0003370251, 0.0003041275,
-        0.0001383909, 0.0001233619, 0.0001316325, 0.0005035147, 0.0001017494,
-        0.0002138421, 0.0014455557, 0.0009395045, 0.0029463153, 0.0019666348,
-        0.0027076979, 0.0100768572, 0.0119315740, 0.0138094975, 0.0155396005,
-        0.0152410511, 0.0156395342, 0.0170082599
-    ],
-    [
-        0.0000032663, 0.0000027250, 0.0000035944, 0.0000036581, 0.0000042844,
-        0.0000034500, 0.0000046962, 0.0000048975, 0.0004066118, 0.0004233205,
-        0.0003447891, 0.0003978242, 0.0003488066, 0.0003750544, 0.0004100188,
-        0.0000545962, 0.0000733631, 0.0000967750, 0.0005730119, 0.0004888846,
-        0.0008021346, 0.0015384839, 0.0013109996, 0.0012483418, 0.0019445741,
-        0.0036640519, 0.0105440011, 0.0139154214, 0.0122513780, 0.0154013280,
-        0.0168001484, 0.0170411505, 0.0169047117
-    ],
-    [
-        0.0000046637, 0.0000050762, 0.0000054806, 0.0000052769, 0.0000053456,
-        0.0000045206, 0.0000048794, 0.0000044444, 0.0003410109, 0.0003670667,
-        0.0004265991, 0.0004735155, 0.0002476516, 0.0002691744, 0.0003448440,
-        0.0000703163, 0.0000527469, 0.0000800250, 0.0001582902, 0.0004565384,
-        0.0004119038, 0.0023596417, 0.0027759369, 0.0025773773, 0.0013263822,
-        0.0006293706, 0.0100170560, 0.0132139893, 0.0126422122, 0.0147474008,
-        0.0163210966, 0.0162036382, 0.0167155657
-    ],
-    [
-        0.0000051619, 0.0000051325, 0.0000043931, 0.0000033200, 0.0000032806,
-        0.0000030925, 0.0000030844, 0.0000033544, 0.0004558583, 0.0003851944,
-        0.0003787744, 0.0004684584, 0.0004906475, 0.0004710308, 0.0003623181,
-        0.0000697434, 0.0000765256, 0.0001325766, 0.0003283440, 0.0005773098,
-        0.0006542484, 0.0004775420, 0.0009611743, 0.0014645508, 0.0013461284,
-        0.0007517748, 0.0094959829, 0.0122870812, 0.0139530199, 0.0162349809,
-        0.0166734755, 0.0151902856, 0.0171931759
-    ],
-    [
-        0.0000044769, 0.0000043694, 0.0000042006, 0.0000049087, 0.0000051544,
-        0.0000052262, 0.0000051037, 0.0000051744, 0.0005578072, 0.0005053219,
-        0.0004903650, 0.0005181078, 0.0005362193, 0.0004777240, 0.0003986079,
-        0.0000715769, 0.0000619263, 0.0001212403, 0.0005787965, 0.0003460289,
-        0.0009978213, 0.0009439643, 0.0017538036, 0.0013645667, 0.0036589073,
-        0.0021943327, 0.0122699151, 0.0142507786, 0.0158046111, 0.0185259581,
-        0.0189137328, 0.0177159924, 0.0173982400
-    ],
-    [
-        0.0000044806, 0.0000038106, 0.0000044469, 0.0000045844, 0.0000044737,
-        0.0000045512, 0.0000047312, 0.0000048250, 0.0003537026, 0.0004435651,
-        0.0004073337, 0.0003890603, 0.0003993769, 0.0004559875, 0.0004102497,
-        0.0001933566, 0.0002025256, 0.0002520696, 0.0011976830, 0.0031597335,
-        0.0027450174, 0.0039847470, 0.0027221348, 0.0035195595, 0.0018271052,
-        0.0031785169, 0.0118620330, 0.0130380737, 0.0160252638, 0.0190869849,
-        0.0189129766, 0.0145353805, 0.0184866935
-    ],
-    [
-        0.0000037825, 0.0000038475, 0.0000050612, 0.0000051544, 0.0000039619,
-        0.0000040169, 0.0000043087, 0.0000044344, 0.0005227010, 0.0005103865,
-        0.0004449322, 0.0004599795, 0.0004675127, 0.0005094273, 0.0004366108,
-        0.0001285281, 0.0000842919, 0.0001793571, 0.0011064040, 0.0003059840,
-        0.0010192010, 0.0014533262, 0.0009003440, 0.0008312524, 0.0036303238,
-        0.0014563211, 0.0117796492, 0.0142492354, 0.0102828015, 0.0174502991,
-        0.0190518592, 0.0182996765, 0.0178003516
-    ],
-    [
-        0.0000046369, 0.0000049394, 0.0000039925, 0.0000030912, 0.0000033837,
-        0.0000025369, 0.0000028313, 0.0000025131, 0.0003808421, 0.0004955307,
-        0.0004279576, 0.0003634006, 0.0004010472, 0.0003924853, 0.0003871166,
-        0.0001724731, 0.0001672795, 0.0003033689, 0.0004983042, 0.0030526142,
-        0.0032423893, 0.0034202379, 0.0008434198, 0.0010865332, 0.0012021534,
-        0.0026548342, 0.0120583372, 0.0147296060, 0.0166832786, 0.0173344538,
-        0.0171056520, 0.0169090424, 0.0199779384
-    ],
-    [
-        0.0000048075, 0.0000047094, 0.0000049862, 0.0000046850, 0.0000046150,
-        0.0000045731, 0.0000050650, 0.0000052137, 0.0004150389, 0.0003261697,
-        0.0003505599, 0.0003424357, 0.0003559437, 0.0003286659, 0.0003410539,
-        0.0001485735, 0.0001418681, 0.0001416132, 0.0007781560, 0.0029912454,
-        0.0031511423, 0.0023796128, 0.0014011665, 0.0013051024, 0.0007941553,
-        0.0030231625, 0.0124166943, 0.0147573585, 0.0181095041, 0.0191032737,
-        0.0181530546, 0.0183534659, 0.0189646520
-    ],
-    [
-        0.0000046119, 0.0000048987, 0.0000049594, 0.0000050756, 0.0000048919,
-        0.0000047225, 0.0000048356, 0.0000047544, 0.0004280490, 0.0004852894,
-        0.0004832331, 0.0004799096, 0.0004779532, 0.0004715456, 0.0003915388,
-        0.0001113577, 0.0000983100, 0.0001323770, 0.0005555440, 0.0008194277,
-        0.0019219682, 0.0009079287, 0.0002699545, 0.0011402123, 0.0010678683,
-        0.0035129411, 0.0127444351, 0.0142397927, 0.0133014768, 0.0155202644,
-        0.0168728586, 0.0160087198, 0.0175145213
-    ],
-    [
-        0.0000035887, 0.0000041756, 0.0000034719, 0.0000033925, 0.0000034288,
-        0.0000034231, 0.0000032794, 0.0000032788, 0.0002674876, 0.0003544500,
-        0.0003846503, 0.0004114634, 0.0004162638, 0.0004504829, 0.0003653647,
-        0.0001094139, 0.0001240138, 0.0002447587, 0.0005629048, 0.0012270665,
-        0.0016146625, 0.0019893949, 0.0019356242, 0.0004951179, 0.0024326204,
-        0.0015432384, 0.0131805865, 0.0142079890, 0.0158650577, 0.0189229380,
-        0.0172317252, 0.0170189105, 0.0182661973
-    ],
-    [
-        0.0000046369, 0.0000044812, 0.0000037306, 0.0000036525, 0.0000037181,
-        0.0000038925, 0.0000042331, 0.0000045519, 0.0003724835, 0.0003876507,
-        0.0003968291, 0.0003987320, 0.0003968515, 0.0004078613, 0.0004346994,
-        0.0002038937, 0.0001881658, 0.0003700310, 0.0009166360, 0.0017182619,
-        0.0018028206, 0.0028817314, 0.0009330248, 0.0010277829, 0.0016653640,
-        0.0012225662, 0.0119167212, 0.0136172753, 0.0137573890, 0.0177201834,
-        0.0185186472, 0.0189455952, 0.0182333495
-    ],
-    [
-        0.0000033338, 0.0000034025, 0.0000028069, 0.0000027694, 0.0000028575,
-        0.0000023706, 0.0000027575, 0.0000045837, 0.0004216344, 0.0005007440,
-        0.0004282660, 0.0005193865, 0.0004277850, 0.0003918981, 0.0003708003,
-        0.0001951001, 0.0001236859, 0.0003388151, 0.0004130609, 0.0012207944,
-        0.0014172375, 0.0036277119, 0.0009833813, 0.0012915432, 0.0016571200,
-        0.0018609035, 0.0107970024, 0.0139590707, 0.0150443725, 0.0156475715,
-        0.0186121278, 0.0177856032, 0.0187443644
-    ],
-    [
-        0.0000046362, 0.0000038281, 0.0000038156, 0.0000038319, 0.0000041219,
-        0.0000042487, 0.0000039075, 0.0000041475, 0.0005085506, 0.0005501193,
-        0.0003942569, 0.0004859044, 0.0004481287, 0.0003982324, 0.0003993811,
-        0.0001939639, 0.0002281169, 0.0004166299, 0.0007083709, 0.0011938752,
-        0.0013090566, 0.0031287132, 0.0016875933, 0.0015075740, 0.0016687397,
-        0.0018757819, 0.0121772755, 0.0146527439, 0.0150459260, 0.0181025229,
-        0.0183672328, 0.0166031159, 0.0162314642
-    ],
-    [
-        0.0000039544, 0.0000049494, 0.0000046381, 0.0000048412, 0.0000050237,
-        0.0000052125, 0.0000047912, 0.0000048250, 0.0004051890, 0.0003365940,
-        0.0004488541, 0.0004739967, 0.0004808644, 0.0004235506, 0.0004231983,
-        0.0001674344, 0.0001573741, 0.0002797891, 0.0006751531, 0.0011651681,
-        0.0017224019, 0.0012487993, 0.0014270688, 0.0017126121, 0.0023722968,
-        0.0018895054, 0.0118096424, 0.0113669466, 0.0156064201, 0.0182610229,
-        0.0187067818, 0.0177757293, 0.0204807539
-    ],
-    [
-        0.0000027094, 0.0000030112, 0.0000045744, 0.0000046719, 0.0000027856,
-        0.0000033113, 0.0000033581, 0.0000031569, 0.0003139545, 0.0002905872,
-        0.0004054436, 0.0009963824, 0.0004455519, 0.0004261127, 0.0004130930,
-        0.0001600964, 0.0001280120, 0.0003197098, 0.0008031013, 0.0005141327,
-        0.0014867885, 0.0011434070, 0.0017000928, 0.0002972756, 0.0020152882,
-        0.0016522558, 0.0114965271, 0.0143878506, 0.0134016173, 0.0171110202,
-        0.0158146191, 0.0188083574, 0.0183948148
-    ],
-])
-first_tbballocs = np.array([
-    [
-        0.0000841494, 0.0000065675, 0.0000063081, 0.0000065906, 0.0000068431,
-        0.0000070344, 0.0000069631, 0.0000071251, 0.0000076481, 0.0000060219,
-        0.0000064406, 0.0000086481, 0.0000118613, 0.0000097257, 0.0000109188,
-        0.0000099025, 0.0000101388, 0.0000104306, 0.0000249313, 0.0000098800,
-        0.0000123506, 0.0001893769, 0.0002155644, 0.0001752919, 0.0002210844,
-        0.0089426413, 0.0087240934, 0.0093249027, 0.0071636643, 0.0102270376,
-        0.0097600007, 0.0112521192, 0.0093114413
-    ],
-    [
-        0.0000050756, 0.0000052275, 0.0000046469, 0.0000050094, 0.0000055176,
-        0.0000050287, 0.0000073187, 0.0000070719, 0.0000068225, 0.0000043194,
-        0.0000056394, 0.0000050550, 0.0000189950, 0.0000071313, 0.0000080769,
-        0.0000079881, 0.0000066876, 0.0000064831, 0.0000080100, 0.0000075381,
-        0.0000259106, 0.0002253850, 0.0002952637, 0.0002505337, 0.0002055260,
-        0.0100760497, 0.0103998668, 0.0094994400, 0.0103404401, 0.0117562367,
-        0.0113745918, 0.0104061458, 0.0109750591
-    ],
-    [
-        0.0000071637, 0.0000066906, 0.0000070731, 0.0000072725, 0.0000061187,
-        0.0000069006, 0.0000063225, 0.0000066419, 0.0000046100, 0.0000057600,
-        0.0000062000, 0.0000038862, 0.0000114756, 0.0000086463, 0.0000081738,
-        0.0000091906, 0.0000087850, 0.0000093081, 0.0000083850, 0.0000098031,
-        0.0000230513, 0.0002426775, 0.0001668514, 0.0000676112, 0.0002164225,
-        0.0071578464, 0.0056830281, 0.0092110410, 0.0070023257, 0.0089379298,
-        0.0135724256, 0.0109390812, 0.0134175131
-    ],
-    [
-        0.0000079600, 0.0000066706, 0.0000050788, 0.0000051112, 0.0000048637,
-        0.0000048181, 0.0000050600, 0.0000062025, 0.0000061269, 0.0000067962,
-        0.0000073544, 0.0000071787, 0.0000160425, 0.0000088994, 0.0000080813,
-        0.0000081075, 0.0000083831, 0.0000082569, 0.0000084825, 0.0000082194,
-        0.0000115331, 0.0002003155, 0.0001822211, 0.0002069112, 0.0002070181,
-        0.0080554113, 0.0077144792, 0.0084151346, 0.0086736539, 0.0099869044,
-        0.0103066042, 0.0097126160, 0.0108667994
-    ],
-    [
-        0.0000070219, 0.0000064569, 0.0000066444, 0.0000073462, 0.0000076456,
-        0.0000078282, 0.0000074719, 0.0000074912, 0.0000075406, 0.0000072587,
-        0.0000073432, 0.0000071819, 0.0000145862, 0.0000086531, 0.0000114275,
-        0.0000109838, 0.0000106663, 0.0000113494, 0.0000085963, 0.0000112951,
-        0.0000144500, 0.0002412669, 0.0002948209, 0.0002378338, 0.0002750538,
-        0.0081906393, 0.0092910556, 0.0080417916, 0.0092809089, 0.0087388922,
-        0.0090609286, 0.0103922356, 0.0104818204
-    ],
-    [
-        0.0000060975, 0.0000062437, 0.0000063681, 0.0000068456, 0.0000063769,
-        0.0000065650, 0.0000060294, 0.0000061450, 0.0000058637, 0.0000055731,
-        0.0000072169, 0.0000068369, 0.0000208462, 0.0000092288, 0.0000102138,
-        0.0000098800, 0.0000102219, 0.0000091812, 0.0000089119, 0.0000130388,
-        0.0000156187, 0.0001982793, 0.0002078263, 0.0002297227, 0.0002411644,
-        0.0072409445, 0.0085815862, 0.0089971973, 0.0077602193, 0.0115845269,
-        0.0097933533, 0.0115732048, 0.0103346743
-    ],
-    [
-        0.0000061512, 0.0000050206, 0.0000064925, 0.0000066462, 0.0000060262,
-        0.0000060244, 0.0000059462, 0.0000061987, 0.0000063456, 0.0000055769,
-        0.0000067531, 0.0000066937, 0.0000160744, 0.0000113013, 0.0000079194,
-        0.0000091044, 0.0000086056, 0.0000085269, 0.0000083700, 0.0000081431,
-        0.0000187725, 0.0001653088, 0.0002056794, 0.0002431761, 0.0002172629,
-        0.0074108951, 0.0114986971, 0.0076820669, 0.0094194170, 0.0110554667,
-        0.0128885768, 0.0110980906, 0.0099594453
-    ],
-    [
-        0.0000072312, 0.0000062112, 0.0000048725, 0.0000335668, 0.0000040194,
-        0.0000038062, 0.0000038625, 0.0000038394, 0.0000067687, 0.0000056562,
-        0.0000061006, 0.0000059187, 0.0000151000, 0.0000077619, 0.0000093025,
-        0.0000083306, 0.0000101600, 0.0000078844, 0.0000068806, 0.0000079088,
-        0.0000210550, 0.0001842750, 0.0002132963, 0.0002042862, 0.0002153131,
-        0.0081796376, 0.0079140477, 0.0075248089, 0.0099534439, 0.0107795158,
-        0.0106200818, 0.0126332529, 0.0101714740
-    ],
-    [
-        0.0000072456, 0.0000067025, 0.0000067475, 0.0000063050, 0.0000068262,
-        0.0000068069, 0.0000065588, 0.0000065181, 0.0000052225, 0.0000042194,
-        0.0000050131, 0.0000070651, 0.0000129519, 0.0000100269, 0.0000095638,
-        0.0000087250, 0.0000096169, 0.0000094869, 0.0000084401, 0.0000104494,
-        0.0000102738, 0.0002001000, 0.0002120808, 0.0002239300, 0.0002137356,
-        0.0100027183, 0.0096974019, 0.0088011473, 0.0096666878, 0.0096862586,
-        0.0141747724, 0.0087913442, 0.0101406975
-    ],
-    [
-        0.0000072487, 0.0000068225, 0.0000070444, 0.0000068619, 0.0000067337,
-        0.0000065462, 0.0000063831, 0.0000065887, 0.0000073431, 0.0000071387,
-        0.0000071844, 0.0000076619, 0.0000152494, 0.0000094938, 0.0000085106,
-        0.0000093506, 0.0000096019, 0.0000096225, 0.0000078775, 0.0000087094,
-        0.0000124369, 0.0002441356, 0.0002139521, 0.0002126789, 0.0002165394,
-        0.0085754879, 0.0091637522, 0.0062304023, 0.0090799285, 0.0114401858,
-        0.0104583763, 0.0105170924, 0.0095173363
-    ],
-    [
-        0.0000052487, 0.0000045675, 0.0000048281, 0.0000047525, 0.0000045912,
-        0.0000045831, 0.0000050669, 0.0000044262, 0.0000051394, 0.0000052956,
-        0.0000054194, 0.0000058137, 0.0000112681, 0.0000102725, 0.0000075313,
-        0.0000094475, 0.0000093481, 0.0000082031, 0.0000095381, 0.0000108481,
-        0.0000209212, 0.0001842980, 0.0001800725, 0.0001970594, 0.0002285675,
-        0.0060644099, 0.0089327898, 0.0084902551, 0.0083292015, 0.0118694119,
-        0.0096817184, 0.0095631462, 0.0105251372
-    ],
-    [
-        0.0000068325, 0.0000060056, 0.0000049644, 0.0000049875, 0.0000053094,
-        0.0000050163, 0.0000066544, 0.0000064781, 0.0000062906, 0.0000067675,
-        0.0000054287, 0.0000056456, 0.0000153494, 0.0000094188, 0.0000089156,
-        0.0000086025, 0.0000071219, 0.0000073913, 0.0000097588, 0.0000120981,
-        0.0000105987, 0.0002084481, 0.0002030427, 0.0002329319, 0.0001757690,
-        0.0079334294, 0.0068927966, 0.0087556224, 0.0093344804, 0.0104622040,
-        0.0106774028, 0.0097469706, 0.0091493549
-    ],
-    [
-        0.0000059950, 0.0000050119, 0.0000056762, 0.0000043812, 0.0000047494,
-        0.0000030525, 0.0000059294, 0.0000061294, 0.0000064744, 0.0000073431,
-        0.0000078750, 0.0000064994, 0.0000155119, 0.0000087250, 0.0000084488,
-        0.0000080150, 0.0000067356, 0.0000084156, 0.0000069831, 0.0000066681,
-        0.0000176788, 0.0002435175, 0.0002517487, 0.0002771140, 0.0002403577,
-        0.0086687608, 0.0098154135, 0.0088794110, 0.0091140941, 0.0096598119,
-        0.0103452830, 0.0096694836, 0.0102577303
-    ],
-    [
-        0.0000063319, 0.0000052287, 0.0000059406, 0.0000057175, 0.0000054500,
-        0.0000070637, 0.0000062181, 0.0000057587, 0.0000060794, 0.0000064170,
-        0.0000057425, 0.0000055419, 0.0000132650, 0.0000096838, 0.0000097019,
-        0.0000095588, 0.0000291981, 0.0000098933, 0.0000080225, 0.0000111200,
-        0.0000141300, 0.0002464731, 0.0002460878, 0.0002146588, 0.0001910500,
-        0.0063399654, 0.0061061336, 0.0093016857, 0.0083681950, 0.0109992782,
-        0.0116105396, 0.0141961118, 0.0089673176
-    ],
-    [
-        0.0000060619, 0.0000068987, 0.0000068056, 0.0000067731, 0.0000072075,
-        0.0000072731, 0.0000072606, 0.0000064612, 0.0000054394, 0.0000065931,
-        0.0000064637, 0.0000059806, 0.0000164687, 0.0000079032, 0.0000088319,
-        0.0000074781, 0.0000075763, 0.0000067988, 0.0000079694, 0.0000110575,
-        0.0000115550, 0.0001511319, 0.0001601050, 0.0002002513, 0.0001993481,
-        0.0104162171, 0.0094342455, 0.0081540253, 0.0067086490, 0.0084192827,
-        0.0101630930, 0.0111724818, 0.0107238842
-    ],
-    [
-        0.0000042562, 0.0000039344, 0.0000057900, 0.0000057575, 0.0000057725,
-        0.0000041581, 0.0000041438, 0.0000037387, 0.0000041712, 0.0000061781,
-        0.0000058587, 0.0000061294, 0.0000121187, 0.0000098731, 0.0000095725,
-        0.0000058231, 0.0000088013, 0.0000062444, 0.0000064419, 0.0000088263,
-        0.0000160081, 0.0001589955, 0.0001591347, 0.0001914525, 0.0002028466,
-        0.0071669277, 0.0078787012, 0.0082324110, 0.0075064814, 0.0089763002,
-        0.0106789786, 0.0106037110, 0.0107590724
-    ],
-])
-first_tbbfrees = np.array([
-    [
-        0.0000061425, 0.0000051050, 0.0000049875, 0.0000049775, 0.0000051531,
-        0.0000051562, 0.0000049787, 0.0000050006, 0.0000057144, 0.0000051212,
-        0.0000048119, 0.0000059787, 0.0000066000, 0.0000057469, 0.0000079187,
-        0.0000061925, 0.0000059906, 0.0000076444, 0.0000069006, 0.0000056744,
-        0.0000058387, 0.0000479288, 0.0000487725, 0.0000468844, 0.0000564562,
-        0.0035569745, 0.0028016851, 0.0039571663, 0.0037537629, 0.0056965970,
-        0.0058775516, 0.0059136073, 0.0050393073
-    ],
-    [
-        0.0000034481, 0.0000038575, 0.0000037831, 0.0000041806, 0.0000041044,
-        0.0000036762, 0.0000051012, 0.0000054694, 0.0000049437, 0.0000028050,
-        0.0000039769, 0.0000036794, 0.0000056519, 0.0000047032, 0.0000046037,
-        0.0000049925, 0.0000050219, 0.0000041087, 0.0000071744, 0.0000048744,
-        0.0000055375, 0.0000466350, 0.0000524088, 0.0000559869, 0.0000566220,
-        0.0030119428, 0.0039629331, 0.0038462470, 0.0044968827, 0.0088838479,
-        0.0073767938, 0.0059023378, 0.0056797825
-    ],
-    [
-        0.0000050062, 0.0000055188, 0.0000056725, 0.0000057319, 0.0000048437,
-        0.0000048125, 0.0000045437, 0.0000047581, 0.0000032912, 0.0000040825,
-        0.0000042812, 0.0000030475, 0.0000044512, 0.0000056219, 0.0000050706,
-        0.0000053162, 0.0000050137, 0.0000071500, 0.0000055875, 0.0000052769,
-        0.0000049537, 0.0000499294, 0.0000467857, 0.0000309425, 0.0000524637,
-        0.0041918657, 0.0035015030, 0.0050380691, 0.0038584126, 0.0054348269,
-        0.0067770230, 0.0056923451, 0.0062269177
-    ],
-    [
-        0.0000056775, 0.0000049501, 0.0000033975, 0.0000035294, 0.0000033688,
-        0.0000034425, 0.0000036769, 0.0000044281, 0.0000042025, 0.0000050737,
-        0.0000051887, 0.0000050856, 0.0000057237, 0.0000061919, 0.0000047225,
-        0.0000050206, 0.0000058275, 0.0000050169, 0.0000061187, 0.0000045619,
-        0.0000068731, 0.0000552321, 0.0000527596, 0.0000505912, 0.0000535569,
-        0.0046839770, 0.0057351361, 0.0048138155, 0.0041864919, 0.0056295604,
-        0.0050325305, 0.0047918158, 0.0054776166
-    ],
-    [
-        0.0000052731, 0.0000047675, 0.0000053937, 0.0000054219, 0.0000058900,
-        0.0000055350, 0.0000055856, 0.0000054750, 0.0000055369, 0.0000054356,
-        0.0000053587, 0.0000048094, 0.0000064919, 0.0000053825, 0.0000073094,
-        0.0000074031, 0.0000066319, 0.0000066131, 0.0000051837, 0.0000077575,
-        0.0000056862, 0.0000511890, 0.0000550045, 0.0000543256, 0.0000536400,
-        0.0044792625, 0.0032407430, 0.0045417687, 0.0049564792, 0.0056198807,
-        0.0050523584, 0.0071990755, 0.0053489413
-    ],
-    [
-        0.0000043351, 0.0000050819, 0.0000048756, 0.0000049350, 0.0000047737,
-        0.0000049850, 0.0000044925, 0.0000048431, 0.0000044363, 0.0000038731,
-        0.0000053550, 0.0000048125, 0.0000067119, 0.0000060856, 0.0000072681,
-        0.0000078106, 0.0000074387, 0.0000072138, 0.0000049594, 0.0000056481,
-        0.0000063656, 0.0000544319, 0.0000630956, 0.0000500601, 0.0000564625,
-        0.0035992470, 0.0044728955, 0.0032855584, 0.0028267398, 0.0080766324,
-        0.0058251331, 0.0088561177, 0.0065380912
-    ],
-    [
-        0.0000041556, 0.0000035631, 0.0000046737, 0.0000047831, 0.0000043375,
-        0.0000042981, 0.0000043181, 0.0000044031, 0.0000044300, 0.0000038831,
-        0.0000050012, 0.0000053694, 0.0000089562, 0.0000093613, 0.0000049662,
-        0.0000059800, 0.0000050350, 0.0000052587, 0.0000049894, 0.0000047400,
-        0.0000048687, 0.0000465525, 0.0000512681, 0.0000617471, 0.0000540720,
-        0.0042555723, 0.0026090515, 0.0044183112, 0.0045633577, 0.0043469039,
-        0.0067718481, 0.0071798731, 0.0069235009
-    ],
-    [
-        0.0000050262, 0.0000044769, 0.0000034531, 0.0000032713, 0.0000026931,
-        0.0000026356, 0.0000026013, 0.0000026313, 0.0000048087, 0.0000039119,
-        0.0000043444, 0.0000040450, 0.0000058475, 0.0000055781, 0.0000064494,
-        0.0000048219, 0.0000055206, 0.0000054462, 0.0000037150, 0.0000070269,
-        0.0000045319, 0.0000553081, 0.0000524031, 0.0000493187, 0.0000517913,
-        0.0058037508, 0.0051289182, 0.0046202913, 0.0057327212, 0.0055538961,
-        0.0057104202, 0.0054183993, 0.0063384715
-    ],
-    [
-        0.0000051456, 0.0000050763, 0.0000052419, 0.0000047725, 0.0000050725,
-        0.0000048912, 0.0000048601, 0.0000048362, 0.0000038769, 0.0000031075,
-        0.0000039631, 0.0000053001, 0.0000072912, 0.0000060331, 0.0000065887,
-        0.0000051475, 0.0000055362, 0.0000060156, 0.0000047844, 0.0000070262,
-        0.0000048350, 0.0000507975, 0.0000811813, 0.0000508106, 0.0000506763,
-        0.0038910718, 0.0042589847, 0.0024923258, 0.0049070604, 0.0047606435,
-        0.0075484090, 0.0051602847, 0.0047816075
-    ],
-    [
-        0.0000049831, 0.0000051050, 0.0000052462, 0.0000050713, 0.0000050225,
-        0.0000048400, 0.0000048081, 0.0000047825, 0.0000049981, 0.0000052531,
-        0.0000050400, 0.0000056431, 0.0000080506, 0.0000059800, 0.0000046562,
-        0.0000054712, 0.0000057750, 0.0000054112, 0.0000046037, 0.0000049237,
-        0.0000047981, 0.0000490987, 0.0000592813, 0.0000497544, 0.0000545406,
-        0.0042451010, 0.0051735574, 0.0051634880, 0.0034064394, 0.0065448489,
-        0.0058943215, 0.0053582061, 0.0066626756
-    ],
-    [
-        0.0000040350, 0.0000036725, 0.0000037219, 0.0000037694, 0.0000037050,
-        0.0000034944, 0.0000038456, 0.0000034537, 0.0000035926, 0.0000042050,
-        0.0000041294, 0.0000040925, 0.0000046469, 0.0000055062, 0.0000043500,
-        0.0000056044, 0.0000059656, 0.0000054237, 0.0000055944, 0.0000061487,
-        0.0000045537, 0.0000501281, 0.0000479981, 0.0000508013, 0.0000584025,
-        0.0052794130, 0.0037549820, 0.0031661077, 0.0044442606, 0.0057947035,
-        0.0058695441, 0.0068295975, 0.0055938372
-    ],
-    [
-        0.0000050094, 0.0000047137, 0.0000039313, 0.0000039163, 0.0000041982,
-        0.0000040369, 0.0000047550, 0.0000045956, 0.0000043125, 0.0000050412,
-        0.0000039744, 0.0000039281, 0.0000048287, 0.0000055006, 0.0000053431,
-        0.0000051406, 0.0000040725, 0.0000045012, 0.0000059456, 0.0000055269,
-        0.0000039512, 0.0000558381, 0.0000464844, 0.0000540694, 0.0000459807,
-        0.0054530851, 0.0047491943, 0.0052946033, 0.0041667474, 0.0060219467,
-        0.0058472697, 0.0053296820, 0.0061134915
-    ],
-    [
-        0.0000040544, 0.0000033694, 0.0000038344, 0.0000032212, 0.0000034781,
-        0.0000024463, 0.0000045244, 0.0000046837, 0.0000048650, 0.0000049225,
-        0.0000058612, 0.0000048644, 0.0000061962, 0.0000062000, 0.0000062106,
-        0.0000044631, 0.0000041594, 0.0000053962, 0.0000043494, 0.0000036681,
-        0.0000043225, 0.0000506731, 0.0000453481, 0.0000520619, 0.0000487700,
-        0.0034167382, 0.0026136138, 0.0031302010, 0.0068260976, 0.0063276007,
-        0.0063016196, 0.0046549691, 0.0065135923
-    ],
-    [
-        0.0000042306, 0.0000038931, 0.0000042706, 0.0000042481, 0.0000041425,
-        0.0000046006, 0.0000041694, 0.0000039912, 0.0000043200, 0.0000045994,
-        0.0000040281, 0.0000037750, 0.0000054394, 0.0000050675, 0.0000065562,
-        0.0000064962, 0.0000079300, 0.0000062644, 0.0000045631, 0.0000050725,
-        0.0000066537, 0.0000484437, 0.0000492300, 0.0000532019, 0.0000476887,
-        0.0046493108, 0.0027413727, 0.0036976498, 0.0031001167, 0.0063397461,
-        0.0055264211, 0.0072267661, 0.0046038073
-    ],
-    [
-        0.0000040681, 0.0000052256, 0.0000051037, 0.0000052306, 0.0000060075,
-        0.0000053919, 0.0000051556, 0.0000049869, 0.0000038569, 0.0000048387,
-        0.0000047937, 0.0000044981, 0.0000057881, 0.0000056976, 0.0000047750,
-        0.0000043994, 0.0000046306, 0.0000044181, 0.0000045569, 0.0000046500,
-        0.0000050787, 0.0000465506, 0.0000478619, 0.0000562188, 0.0000484169,
-        0.0031219081, 0.0032858308, 0.0033925541, 0.0030735868, 0.0046173371,
-        0.0059952568, 0.0081608826, 0.0048351334
-    ],
-    [
-        0.0000033375, 0.0000035231, 0.0000049031, 0.0000048837, 0.0000048306,
-        0.0000032600, 0.0000034800, 0.0000031006, 0.0000034081, 0.0000050712,
-        0.0000049925, 0.0000049931, 0.0000057325, 0.0000064819, 0.0000055856,
-        0.0000037169, 0.0000055712, 0.0000035981, 0.0000038606, 0.0000055662,
-        0.0000041731, 0.0000468357, 0.0000487932, 0.0000520687, 0.0000534376,
-        0.0040182909, 0.0057871006, 0.0044539687, 0.0051269550, 0.0051745968,
-        0.0076373843, 0.0059886044, 0.0061925156
-    ],
-])
-second_allocs = np.array([
-    [
-        0.0000045737, 0.0000107931, 0.0000027088, 0.0000081375, 0.0000123163,
-        0.0000146031, 0.0000115013, 0.0000127444, 0.0000135894, 0.0000217639,
-        0.0000305894, 0.0000381537, 0.0000186100, 0.0001246762, 0.0005959715,
-        0.0055781403, 0.0094145732, 0.0105849467, 0.0104641654, 0.0136168934,
-        0.0131901558, 0.0137252500, 0.0158124696, 0.0140095465, 0.0220378973,
-        0.0260673147, 0.0221929792, 0.0145111484, 0.0185447298, 0.0256256014,
-        0.0261339638, 0.0267988164, 0.0271948073
-    ],
-    [
-        0.0000037169, 0.0000101169, 0.0000101563, 0.0000112981, 0.0000086175,
-        0.0000086325, 0.0000071050, 0.0000130306, 0.0000121775, 0.0000107982,
-        0.0000112544, 0.0000032769, 0.0000065563, 0.0000156487, 0.0000479269,
-        0.0116261840, 0.0082673281, 0.0086211888, 0.0075749615, 0.0108230887,
-        0.0074074878, 0.0152594391, 0.0138584338, 0.0184682440, 0.0198689159,
-        0.0320540853, 0.0219870750, 0.0221567545, 0.0238301381, 0.0259331893,
-        0.0253805369, 0.0284268036, 0.0243355203
-    ],
-    [
-        0.0000028400, 0.0000052906, 0.0000098413, 0.0000045694, 0.0000032750,
-        0.0000048131, 0.0000058800, 0.0000162300, 0.0000093112, 0.0000131656,
-        0.0000180207, 0.0000056756, 0.0000043369, 0.0000060431, 0.0000156450,
-        0.0087718470, 0.0094050365, 0.0073618144, 0.0084769661, 0.0091564143,
-        0.0094270287, 0.0123998420, 0.0118176946, 0.0142450575, 0.0123735173,
-        0.0281161256, 0.0182817020, 0.0213110838, 0.0210654102, 0.0265653357,
-        0.0229194742, 0.0267123487, 0.0277925991
-    ],
-    [
-        0.0000089844, 0.0000066425, 0.0000025325, 0.0000024887, 0.0000024669,
-        0.0000037862, 0.0000031662, 0.0000026244, 0.0000098150, 0.0000134331,
-        0.0000216625, 0.0000171338, 0.0000057938, 0.0000147656, 0.0000070838,
-        0.0058095427, 0.0058563873, 0.0066307965, 0.0084978817, 0.0137089109,
-        0.0123920916, 0.0111455657, 0.0105070686, 0.0130779268, 0.0110701555,
-        0.0073311385, 0.0199517906, 0.0198833421, 0.0204242766, 0.0246406849,
-        0.0224716738, 0.0265410356, 0.0258137286
-    ],
-    [
-        0.0000030931, 0.0000029406, 0.0000022925, 0.0000044244, 0.0000021781,
-        0.0000025987, 0.0000061956, 0.0000171225, 0.0000041675, 0.0000101012,
-        0.0000063275, 0.0000093250, 0.0000041806, 0.0000077731, 0.0000213506,
-        0.0098122535, 0.0089145564, 0.0089501254, 0.0091235042, 0.0087640183,
-        0.0111028021, 0.0084091285, 0.0111756697, 0.0111027230, 0.0145139461,
-        0.0207969993, 0.0222831909, 0.0186047759, 0.0235918183, 0.0236594770,
-        0.0255017616, 0.0292073619, 0.0290309787
-    ],
-    [
-        0.0000025619, 0.0000018094, 0.0000016694, 0.0000016456, 0.0000017138,
-        0.0000016881, 0.0000016838, 0.0000015900, 0.0000040638, 0.0000132344,
-        0.0000046737, 0.0000030606, 0.0000035356, 0.0000043619, 0.0000063912,
-        0.0096556414, 0.0085799638, 0.0100991502, 0.0094085466, 0.0103507666,
-        0.0099591454, 0.0101658069, 0.0114540700, 0.0110464543, 0.0160613153,
-        0.0014934605, 0.0223795380, 0.0188019071, 0.0245012678, 0.0269825328,
-        0.0289561283, 0.0283010546, 0.0297725275
-    ],
-    [
-        0.0000019100, 0.0000017412, 0.0000024144, 0.0000026581, 0.0000019950,
-        0.0000019500, 0.0000024581, 0.0000020150, 0.0000095075, 0.0000147163,
-        0.0000153469, 0.0000132663, 0.0000025844, 0.0000075362, 0.0000299712,
-        0.0014020383, 0.0015407192, 0.0020589815, 0.0017778811, 0.0008181385,
-        0.0010479154, 0.0002473463, 0.0005852102, 0.0005375802, 0.0080858003,
-        0.0180643387, 0.0177655220, 0.0238394011, 0.0225843024, 0.0272462219,
-        0.0266806558, 0.0274170283, 0.0276050102
-    ],
-    [
-        0.0000026650, 0.0000036269, 0.0000133476, 0.0000053350, 0.0000154775,
-        0.0000142088, 0.0000118563, 0.0000066637, 0.0000122087, 0.0000184137,
-        0.0000183369, 0.0000234557, 0.0000069819, 0.0000072575, 0.0000217787,
-        0.0077547119, 0.0094704954, 0.0075622648, 0.0096640373, 0.0091745146,
-        0.0103627956, 0.0097735338, 0.0116183711, 0.0145494556, 0.0386505201,
-        0.0176567268, 0.0193006992, 0.0196011122, 0.0244306792, 0.0248982068,
-        0.0248212088, 0.0198478363, 0.0241835881
-    ],
-    [
-        0.0000029837, 0.0000034006, 0.0000044562, 0.0000086425, 0.0000132862,
-        0.0000034219, 0.0000030575, 0.0000050806, 0.0000134431, 0.0000037675,
-        0.0000170531, 0.0000056969, 0.0000058794, 0.0000075850, 0.0000248825,
-        0.0082352227, 0.0053750300, 0.0054597342, 0.0063522039, 0.0098131234,
-        0.0101943668, 0.0090996334, 0.0106234532, 0.0102136172, 0.0184518360,
-        0.0134816570, 0.0209758319, 0.0223751701, 0.0241218600, 0.0260181706,
-        0.0287252534, 0.0275131892, 0.0259354934
-    ],
-    [
-        0.0000117419, 0.0000027850, 0.0000026044, 0.0000021481, 0.0000021782,
-        0.0000038250, 0.0000023787, 0.0000024225, 0.0000045194, 0.0000149394,
-        0.0000151825, 0.0000150931, 0.0000061775, 0.0000070031, 0.0000203419,
-        0.0103792595, 0.0088877082, 0.0096024657, 0.0094057806, 0.0093732215,
-        0.0095517626, 0.0089640655, 0.0096481349, 0.0132509712, 0.0148811452,
-        0.0270080529, 0.0203736480, 0.0216919202, 0.0219073147, 0.0268714968,
-        0.0280450601, 0.0271432288, 0.0271267965
-    ],
-    [
-        0.0000015912, 0.0000019381, 0.0000023013, 0.0000038688, 0.0000034725,
-        0.0000042344, 0.0000033113, 0.0000021669, 0.0000050381, 0.0000035206,
-        0.0000163756, 0.0000110706, 0.0000044775, 0.0000142769, 0.0000262762,
-        0.0079100076, 0.0081490632, 0.0067358506, 0.0086514158, 0.0094505344,
-        0.0092072384, 0.0138925668, 0.0194649249, 0.0148055162, 0.0273526870,
-        0.0195355266, 0.0210936219, 0.0208010226, 0.0271314625, 0.0262604021,
-        0.0249452032, 0.0241116006, 0.0230957605
-    ],
-    [
-        0.0000058206, 0.0000040200, 0.0000122544, 0.0000138481, 0.0000045406,
-        0.0000124744, 0.0000105356, 0.0000146750, 0.0000099406, 0.0000115700,
-        0.0000156037, 0.0000189963, 0.0000084138, 0.0000057481, 0.0000177644,
-        0.0106631285, 0.0077035283, 0.0091777137, 0.0095794620, 0.0077988445,
-        0.0082764011, 0.0119221220, 0.0142713794, 0.0123344958, 0.0278651547,
-        0.0181710646, 0.0199945867, 0.0214303285, 0.0250851866, 0.0265572853,
-        0.0275856648, 0.0271878988, 0.0271015465
-    ],
-    [
-        0.0000040450, 0.0000041762, 0.0000038419, 0.0000042187, 0.0000022656,
-        0.0000032506, 0.0000029113, 0.0000030169, 0.0000067025, 0.0000123994,
-        0.0000170662, 0.0000178131, 0.0000063381, 0.0000189944, 0.0000307100,
-        0.0087302215, 0.0074747889, 0.0086232228, 0.0102569582, 0.0109549044,
-        0.0076763798, 0.0110446243, 0.0136897480, 0.0124026416, 0.0147257075,
-        0.0158194397, 0.0229030382, 0.0195244309, 0.0226511173, 0.0167064443,
-        0.0264848601, 0.0256517250, 0.0281614363
-    ],
-    [
-        0.0000034637, 0.0000115981, 0.0000088369, 0.0000053869, 0.0000073150,
-        0.0000090700, 0.0000070269, 0.0000110706, 0.0000108450, 0.0000108219,
-        0.0000175775, 0.0000174162, 0.0000098012, 0.0000051975, 0.0000236288,
-        0.0074032941, 0.0077438494, 0.0071803499, 0.0098681711, 0.0095822569,
-        0.0121731451, 0.0098327259, 0.0119464323, 0.0101961931, 0.0436841771,
-        0.0190666392, 0.0184909794, 0.0201849267, 0.0245911609, 0.0268983841,
-        0.0261784811, 0.0264381468, 0.0237517077
-    ],
-    [
-        0.0000031881, 0.0000028094, 0.0000026425, 0.0000028887, 0.0000098019,
-        0.0000045631, 0.0000030413, 0.0000042481, 0.0000055987, 0.0000157363,
-        0.0000181981, 0.0000131013, 0.0000053975, 0.0000091663, 0.0000222531,
-        0.0099234758, 0.0106595354, 0.0071763853, 0.0119300457, 0.0101517085,
-        0.0093828421, 0.0124309286, 0.0082026562, 0.0142018674, 0.0148077756,
-        0.0161440875, 0.0193665065, 0.0230092816, 0.0221210551, 0.0235153418,
-        0.0251643881, 0.0275113899, 0.0277878232
-    ],
-    [
-        0.0000138400, 0.0000029100, 0.0000030581, 0.0000036287, 0.0000042056,
-        0.0000080675, 0.0000024600, 0.0000021962, 0.0000039537, 0.0000022594,
-        0.0000134887, 0.0000084925, 0.0000053825, 0.0000202369, 0.0000530608,
-        0.0099547524, 0.0093858065, 0.0073515624, 0.0092281904, 0.0089400588,
-        0.0081332047, 0.0104362248, 0.0071328478, 0.0128534501, 0.0451533273,
-        0.0158068389, 0.0227902252, 0.0184843633, 0.0163517930, 0.0238019265,
-        0.0260815993, 0.0274558067, 0.0243593734
-    ],
-])
-second_frees = np.array([
-    [
-        0.0000016844, 0.0000040944, 0.0000012925, 0.0000019282, 0.0000054363,
-        0.0000061694, 0.0000077100, 0.0000098369, 0.0001738219, 0.0005406058,
-        0.0004991291, 0.0004644699, 0.0000834300, 0.0006050396, 0.0007549532,
-        0.0004874989, 0.0003736684, 0.0012413143, 0.0006015486, 0.0015315472,
-        0.0003830614, 0.0004284378, 0.0052017705, 0.0017671110, 0.0031217611,
-        0.0079796249, 0.0065336307, 0.0074075796, 0.0073376182, 0.0087879971,
-        0.0097143231, 0.0087667080, 0.0085676499
-    ],
-    [
-        0.0000013225, 0.0000031437, 0.0000027500, 0.0000041287, 0.0000020256,
-        0.0000031900, 0.0000017256, 0.0000064300, 0.0003330419, 0.0004313899,
-        0.0000709825, 0.0000071500, 0.0000118981, 0.0000411763, 0.0001674344,
-        0.0016455728, 0.0005008746, 0.0003147558, 0.0008089899, 0.0008227085,
-        0.0007102574, 0.0029291001, 0.0135237332, 0.0052877222, 0.0047127362,
-        0.0127386004, 0.0083664618, 0.0077686622, 0.0087135620, 0.0087676356,
-        0.0114988443, 0.0108918818, 0.0081399148
-    ],
-    [
-        0.0000011212, 0.0000015306, 0.0000026681, 0.0000015431, 0.0000011069,
-        0.0000018319, 0.0000036863, 0.0000067331, 0.0001784173, 0.0004857962,
-        0.0000937397, 0.0000160319, 0.0000073987, 0.0000142688, 0.0000374744,
-        0.0006485335, 0.0007447585, 0.0008665037, 0.0012937223, 0.0009956629,
-        0.0005637997, 0.0005786909, 0.0008664330, 0.0008818409, 0.0011646866,
-        0.0332352556, 0.0089945197, 0.0093597425, 0.0099299112, 0.0118270954,
-        0.0116046509, 0.0108319577, 0.0120259961
-    ],
-    [
-        0.0000034313, 0.0000023951, 0.0000010563, 0.0000009069, 0.0000009444,
-        0.0000013738, 0.0000013087, 0.0000012169, 0.0000161644, 0.0001114862,
-        0.0001145175, 0.0000457150, 0.0000087300, 0.0000335063, 0.0000115544,
-        0.0004346316, 0.0005902203, 0.0005461554, 0.0007796711, 0.0024666155,
-        0.0003104960, 0.0026033414, 0.0011051749, 0.0014666553, 0.0007652898,
-        0.0274043158, 0.0067083910, 0.0081570344, 0.0073280912, 0.0089704003,
-        0.0095808916, 0.0099965986, 0.0084523521
-    ],
-    [
-        0.0000013019, 0.0000010031, 0.0000010869, 0.0000016244, 0.0000010606,
-        0.0000013400, 0.0000017719, 0.0000041100, 0.0000099388, 0.0000653569,
-        0.0000115400, 0.0000208625, 0.0000100731, 0.0000142888, 0.0000592456,
-        0.0003685407, 0.0006993429, 0.0004120414, 0.0006584892, 0.0008217266,
-        0.0013817577, 0.0007467510, 0.0010731694, 0.0009827667, 0.0012911663,
-        0.0273500495, 0.0095297173, 0.0079217888, 0.0084517170, 0.0105803125,
-        0.0087558804, 0.0110437237, 0.0121717313
-    ],
-    [
-        0.0000008094, 0.0000006925, 0.0000006875, 0.0000006494, 0.0000008081,
-        0.0000009000, 0.0000008281, 0.0000006512, 0.0000094719, 0.0001063969,
-        0.0000117038, 0.0000055363, 0.0000058306, 0.0000079637, 0.0000126731,
-        0.0007439131, 0.0007233070, 0.0006674261, 0.0009194004, 0.0006683715,
-        0.0006236763, 0.0009163804, 0.0009019288, 0.0011009905, 0.0009279341,
-        0.0045776898, 0.0077007399, 0.0057536736, 0.0081917830, 0.0091852630,
-        0.0093403347, 0.0091388291, 0.0087604867
-    ],
-    [
-        0.0000009462, 0.0000006725, 0.0000009088, 0.0000009687, 0.0000008400,
-        0.0000009863, 0.0000010713, 0.0000009725, 0.0000084975, 0.0001097821,
-        0.0000852625, 0.0000328525, 0.0000074750, 0.0000126169, 0.0000747625,
-        0.0001042020, 0.0001878009, 0.0002763389, 0.0002532532, 0.0002937132,
-        0.0003113159, 0.0001428319, 0.0004496807, 0.0002011606, 0.0217706617,
-        0.0049318303, 0.0068405704, 0.0078068199, 0.0073252795, 0.0107138287,
-        0.0101513313, 0.0106791211, 0.0111383069
-    ],
-    [
-        0.0000011232, 0.0000013012, 0.0000052025, 0.0000015737, 0.0000041888,
-        0.0000038869, 0.0000056456, 0.0000016781, 0.0002942688, 0.0003205050,
-        0.0001158600, 0.0001307110, 0.0000121612, 0.0000127756, 0.0000482444,
-        0.0007399312, 0.0004681984, 0.0007848783, 0.0004655574, 0.0010147719,
-        0.0011437382, 0.0004324453, 0.0008184958, 0.0010892035, 0.0214039497,
-        0.0044033318, 0.0074577536, 0.0080010490, 0.0094449185, 0.0098934006,
-        0.0102283051, 0.0088321809, 0.0097331712
-    ],
-    [
-        0.0000012687, 0.0000012325, 0.0000013963, 0.0000021925, 0.0000038912,
-        0.0000016337, 0.0000019200, 0.0000015125, 0.0001581694, 0.0000113325,
-        0.0001095475, 0.0000113650, 0.0000110212, 0.0000128188, 0.0000641144,
-        0.0012544732, 0.0004007845, 0.0004985440, 0.0006386945, 0.0011790924,
-        0.0013228236, 0.0010545773, 0.0010839368, 0.0016959785, 0.0257025473,
-        0.0052850982, 0.0084118601, 0.0086469008, 0.0088695819, 0.0096238665,
-        0.0097994031, 0.0107648056, 0.0108603155
-    ],
-    [
-        0.0000045281, 0.0000011231, 0.0000011888, 0.0000010175, 0.0000012237,
-        0.0000016844, 0.0000015231, 0.0000015475, 0.0000085469, 0.0001083144,
-        0.0000466150, 0.0000317256, 0.0000112031, 0.0000185844, 0.0000579656,
-        0.0007067185, 0.0006352821, 0.0007110549, 0.0006353600, 0.0010830661,
-        0.0002289983, 0.0007119502, 0.0009197911, 0.0006226353, 0.0244465191,
-        0.0072832708, 0.0078449054, 0.0093237674, 0.0078971740, 0.0112060215,
-        0.0107525773, 0.0114816008, 0.0100969058
-    ],
-    [
-        0.0000010869, 0.0000008181, 0.0000009719, 0.0000016100, 0.0000013856,
-        0.0000021412, 0.0000010981, 0.0000012387, 0.0000153606, 0.0000114875,
-        0.0000920625, 0.0000299062, 0.0000133462, 0.0000329762, 0.0000767119,
-        0.0005600420, 0.0005616898, 0.0007151334, 0.0005891539, 0.0005718897,
-        0.0006872392, 0.0015499654, 0.0038722276, 0.0015493506, 0.0327511244,
-        0.0044427481, 0.0074009378, 0.0084249340, 0.0087400414, 0.0115419189,
-        0.0094601512, 0.0089852195, 0.0097123515
-    ],
-    [
-        0.0000013269, 0.0000013231, 0.0000038994, 0.0000038200, 0.0000015237,
-        0.0000039825, 0.0000033087, 0.0000081188, 0.0002657563, 0.0001542706,
-        0.0001938511, 0.0001384350, 0.0000157369, 0.0000108438, 0.0000461581,
-        0.0009303070, 0.0005660541, 0.0005644778, 0.0005171511, 0.0005401340,
-        0.0006995083, 0.0011792645, 0.0006191723, 0.0011054254, 0.0110650128,
-        0.0056507867, 0.0078796642, 0.0081437100, 0.0089880358, 0.0108386129,
-        0.0103143966, 0.0094248774, 0.0118729118
-    ],
-    [
-        0.0000016537, 0.0000012225, 0.0000013194, 0.0000012425, 0.0000010687,
-        0.0000019487, 0.0000016431, 0.0000014025, 0.0000103456, 0.0000747988,
-        0.0000671494, 0.0000368306, 0.0000115900, 0.0000477325, 0.0000822012,
-        0.0007583954, 0.0003783834, 0.0007339499, 0.0009950806, 0.0008088341,
-        0.0005844633, 0.0013555413, 0.0019623954, 0.0006942460, 0.0433161743,
-        0.0023093214, 0.0100337695, 0.0065378724, 0.0087245898, 0.0079442719,
-        0.0111024641, 0.0102447290, 0.0117887426
-    ],
-    [
-        0.0000012400, 0.0000033481, 0.0000026369, 0.0000015407, 0.0000017256,
-        0.0000034069, 0.0000020806, 0.0000040925, 0.0001819725, 0.0001054569,
-        0.0000883634, 0.0000908550, 0.0000170575, 0.0000105581, 0.0000582408,
-        0.0005820321, 0.0004810214, 0.0005707933, 0.0006467662, 0.0014285113,
-        0.0009294431, 0.0010528264, 0.0007414083, 0.0019276697, 0.0148584284,
-        0.0037983691, 0.0083290180, 0.0089286501, 0.0109174820, 0.0122163268,
-        0.0156171583, 0.0131346453, 0.0099943690
-    ],
-    [
-        0.0000010175, 0.0000010719, 0.0000010131, 0.0000010975, 0.0000033513,
-        0.0000015856, 0.0000016275, 0.0000015331, 0.0000213794, 0.0001526917,
-        0.0001048144, 0.0000287244, 0.0000103200, 0.0000193669, 0.0000527344,
-        0.0011163845, 0.0005801142, 0.0005142401, 0.0008320097, 0.0008749999,
-        0.0007162360, 0.0006969908, 0.0008106616, 0.0010835162, 0.0244824123,
-        0.0024106216, 0.0094045280, 0.0094029251, 0.0103198327, 0.0136561934,
-        0.0132274851, 0.0138142016, 0.0129481768
-    ],
-    [
-        0.0000035613, 0.0000012206, 0.0000011525, 0.0000012250, 0.0000013194,
-        0.0000026713, 0.0000014550, 0.0000010094, 0.0000078537, 0.0000066931,
-        0.0000384594, 0.0000153206, 0.0000105619, 0.0000520856, 0.0001698820,
-        0.0012413965, 0.0009097650, 0.0007820803, 0.0005574045, 0.0008524730,
-        0.0007969361, 0.0008293297, 0.0006869527, 0.0007571415, 0.0285763387,
-        0.0044179009, 0.0091867149, 0.0064733448, 0.0095124207, 0.0129823098,
-        0.0121759102, 0.0129284719, 0.0095259082
-    ],
-])
-second_tbballocs = np.array([
-    [
-        0.0000035688, 0.0000029131, 0.0000026581, 0.0000026987, 0.0000025506,
-        0.0000026244, 0.0000033488, 0.0000030456, 0.0000040256, 0.0000050038,
-        0.0000854906, 0.0000164281, 0.0007834553, 0.0007954756, 0.0004202175,
-        0.0006834017, 0.0004816642, 0.0010830605, 0.0017458554, 0.0027024436,
-        0.0109167760, 0.0040977751, 0.0085448492, 0.0078412257, 0.0052133752,
-        0.0132254716, 0.0109476745, 0.0095508462, 0.0089213206, 0.0107645774,
-        0.0104294736, 0.0115095759, 0.0101887574
-    ],
-    [
-        0.0000037006, 0.0000030588, 0.0000027488, 0.0000026381, 0.0000028913,
-        0.0000027112, 0.0000029256, 0.0000028037, 0.0000036831, 0.0000051525,
-        0.0000069382, 0.0000242950, 0.0011355686, 0.0005244275, 0.0007346600,
-        0.0004634806, 0.0011908103, 0.0013250335, 0.0011655353, 0.0021624686,
-        0.0085971812, 0.0063408683, 0.0101800198, 0.0049180593, 0.0062039425,
-        0.0079603326, 0.0106660780, 0.0090652546, 0.0084624197, 0.0108887218,
-        0.0125463475, 0.0096130269, 0.0106127029
-    ],
-    [
-        0.0000034250, 0.0000025850, 0.0000027181, 0.0000025512, 0.0000025362,
-        0.0000026106, 0.0000034856, 0.0000033594, 0.0000038825, 0.0000051644,
-        0.0000063419, 0.0000145613, 0.0019817536, 0.0004914506, 0.0004543475,
-        0.0006051225, 0.0008919116, 0.0012236862, 0.0015156930, 0.0041118455,
-        0.0063600559, 0.0072412142, 0.0079821348, 0.0106980018, 0.0063936235,
-        0.0087977536, 0.0097617898, 0.0106848469, 0.0106508238, 0.0118992915,
-        0.0120355226, 0.0127083827, 0.0105766226
-    ],
-    [
-        0.0000035019, 0.0000026469, 0.0000025725, 0.0000024656, 0.0000024931,
-        0.0000027075, 0.0000025969, 0.0000027188, 0.0000030225, 0.0000039188,
-        0.0000081013, 0.0000240900, 0.0011545853, 0.0004400970, 0.0003167912,
-        0.0007583105, 0.0005030339, 0.0018999578, 0.0003933569, 0.0019807252,
-        0.0074904570, 0.0075510968, 0.0072491858, 0.0051615760, 0.0063137328,
-        0.0069696573, 0.0020041345, 0.0109385429, 0.0109437341, 0.0171818789,
-        0.0107265823, 0.0099288952, 0.0123347323
-    ],
-    [
-        0.0000033869, 0.0000024762, 0.0000027956, 0.0000030482, 0.0000018600,
-        0.0000015188, 0.0000024500, 0.0000031075, 0.0000033525, 0.0000051050,
-        0.0000072369, 0.0000143644, 0.0004742960, 0.0004770492, 0.0008133660,
-        0.0005405100, 0.0009134990, 0.0005591687, 0.0010759078, 0.0042523164,
-        0.0059178290, 0.0094684120, 0.0084009720, 0.0061729476, 0.0093447510,
-        0.0091887387, 0.0085585704, 0.0097153336, 0.0102720894, 0.0130129997,
-        0.0107136741, 0.0110926181, 0.0100833550
-    ],
-    [
-        0.0000025406, 0.0000020369, 0.0000016081, 0.0000022137, 0.0000017156,
-        0.0000017275, 0.0000018769, 0.0000018425, 0.0000021169, 0.0000033394,
-        0.0000050919, 0.0000180306, 0.0004639098, 0.0004636338, 0.0004861044,
-        0.0007698469, 0.0010800324, 0.0012459634, 0.0013292785, 0.0027422376,
-        0.0052426509, 0.0046422617, 0.0093801543, 0.0064258841, 0.0075875428,
-        0.0122348871, 0.0096068243, 0.0091307666, 0.0101467445, 0.0093606710,
-        0.0100776069, 0.0104275560, 0.0097311502
-    ],
-    [
-        0.0000018650, 0.0000020444, 0.0000023400, 0.0000023556, 0.0000024719,
-        0.0000023694, 0.0000023913, 0.0000016681, 0.0000030250, 0.0000042931,
-        0.0000075250, 0.0000172337, 0.0005868909, 0.0003857084, 0.0005240025,
-        0.0010084963, 0.0006526669, 0.0013091830, 0.0014112863, 0.0040561319,
-        0.0089245774, 0.0041130795, 0.0071383575, 0.0061203968, 0.0064840443,
-        0.0072244932, 0.0097405100, 0.0096552512, 0.0093124751, 0.0099450536,
-        0.0127652651, 0.0101756891, 0.0116844494
-    ],
-    [
-        0.0000036344, 0.0000031294, 0.0000035350, 0.0000035350, 0.0000035088,
-        0.0000033088, 0.0000035088, 0.0000036450, 0.0000043744, 0.0000057932,
-        0.0000090687, 0.0000184944, 0.0006741171, 0.0004215888, 0.0007795775,
-        0.0004121400, 0.0010490100, 0.0009242891, 0.0014805791, 0.0026793012,
-        0.0074914177, 0.0096052075, 0.0058048107, 0.0073417672, 0.0084010148,
-        0.0072240834, 0.0100386972, 0.0119402586, 0.0096101481, 0.0112975631,
-        0.0100934021, 0.0112827253, 0.0125105269
-    ],
-    [
-        0.0000036156, 0.0000030669, 0.0000032800, 0.0000032956, 0.0000031544,
-        0.0000032350, 0.0000036556, 0.0000035794, 0.0000045719, 0.0000063112,
-        0.0000098219, 0.0000194044, 0.0008108402, 0.0004399468, 0.0007156554,
-        0.0006735044, 0.0006738824, 0.0008689631, 0.0014774126, 0.0037088206,
-        0.0077391458, 0.0062833973, 0.0083614262, 0.0058326176, 0.0035845113,
-        0.0084255105, 0.0102555659, 0.0091851372, 0.0104328878, 0.0106487945,
-        0.0101025719, 0.0097761052, 0.0117264492
-    ],
-    [
-        0.0000029269, 0.0000035013, 0.0000029887, 0.0000030356, 0.0000029694,
-        0.0000030644, 0.0000039006, 0.0000033031, 0.0000039525, 0.0000051894,
-        0.0000086900, 0.0000202500, 0.0009366231, 0.0005829771, 0.0011841306,
-        0.0004559588, 0.0010851832, 0.0011453161, 0.0015714315, 0.0028608816,
-        0.0072102752, 0.0088948580, 0.0108492570, 0.0092686415, 0.0046590511,
-        0.0115783019, 0.0102703953, 0.0076810773, 0.0114746783, 0.0106853796,
-        0.0099256868, 0.0121225175, 0.0116155241
-    ],
-    [
-        0.0000016663, 0.0000021981, 0.0000018469, 0.0000019731, 0.0000016625,
-        0.0000021988, 0.0000017375, 0.0000015438, 0.0000036581, 0.0000045869,
-        0.0000075281, 0.0000193069, 0.0010468097, 0.0005577793, 0.0008474628,
-        0.0004828401, 0.0010813272, 0.0012351986, 0.0010383984, 0.0025541577,
-        0.0114148892, 0.0067773578, 0.0055833263, 0.0079439003, 0.0047962456,
-        0.0113970479, 0.0106227733, 0.0114721274, 0.0094411075, 0.0104360767,
-        0.0104211411, 0.0089570377, 0.0117108393
-    ],
-    [
-        0.0000038488, 0.0000034294, 0.0000034400, 0.0000035519, 0.0000035306,
-        0.0000035244, 0.0000037163, 0.0000037550, 0.0000038538, 0.0000057106,
-        0.0000124006, 0.0000313575, 0.0007558828, 0.0004079613, 0.0007051428,
-        0.0007581270, 0.0005465428, 0.0013166759, 0.0009396544, 0.0024343817,
-        0.0076946281, 0.0095167849, 0.0086517911, 0.0053064669, 0.0085044950,
-        0.0098729525, 0.0100063290, 0.0100930566, 0.0104968511, 0.0093329065,
-        0.0121913776, 0.0115791019, 0.0122309104
-    ],
-    [
-        0.0000044850, 0.0000031719, 0.0000028387, 0.0000027250, 0.0000026201,
-        0.0000028081, 0.0000033388, 0.0000032725, 0.0000033119, 0.0000064288,
-        0.0000110663, 0.0000194294, 0.0012011685, 0.0006112088, 0.0005266116,
-        0.0009586497, 0.0008612622, 0.0013526728, 0.0013430666, 0.0031246725,
-        0.0060669435, 0.0073277736, 0.0088658920, 0.0079257870, 0.0067144535,
-        0.0092163850, 0.0083383489, 0.0057742195, 0.0100034447, 0.0128475484,
-        0.0108605605, 0.0137837110, 0.0091428719
-    ],
-    [
-        0.0000027075, 0.0000027863, 0.0000023756, 0.0000023950, 0.0000027975,
-        0.0000024656, 0.0000032206, 0.0000035894, 0.0000045969, 0.0000051500,
-        0.0000097831, 0.0000449450, 0.0009036144, 0.0004430394, 0.0006739000,
-        0.0006720239, 0.0012298051, 0.0014162435, 0.0012675471, 0.0111499177,
-        0.0104661584, 0.0081000794, 0.0070063272, 0.0048697144, 0.0071480372,
-        0.0102627063, 0.0089006070, 0.0106042642, 0.0110554192, 0.0106789609,
-        0.0114641124, 0.0116228787, 0.0123272352
-    ],
-    [
-        0.0000026100, 0.0000026131, 0.0000029187, 0.0000031444, 0.0000030506,
-        0.0000031269, 0.0000032894, 0.0000032081, 0.0000035144, 0.0000041413,
-        0.0000098344, 0.0000160712, 0.0007868901, 0.0004475894, 0.0004677538,
-        0.0011902356, 0.0003564607, 0.0019441334, 0.0011915948, 0.0033198108,
-        0.0137922307, 0.0092743281, 0.0063104383, 0.0082125869, 0.0054752231,
-        0.0131771462, 0.0075542252, 0.0071449126, 0.0103866532, 0.0101635987,
-        0.0114683518, 0.0109234080, 0.0108886473
-    ],
-    [
-        0.0000032294, 0.0000023281, 0.0000029519, 0.0000030950, 0.0000027787,
-        0.0000025456, 0.0000035081, 0.0000023837, 0.0000021856, 0.0000030600,
-        0.0000088456, 0.0000182750, 0.0009143193, 0.0005497750, 0.0004961581,
-        0.0005636081, 0.0013097259, 0.0012648591, 0.0016709279, 0.0015042308,
-        0.0076061203, 0.0070814989, 0.0051376801, 0.0097391866, 0.0029621674,
-        0.0131122870, 0.0095456811, 0.0087641878, 0.0086694490, 0.0117906909,
-        0.0112803150, 0.0115927793, 0.0105035752
-    ],
-])
-second_tbbfrees = np.array([
-    [
-        0.0000029900, 0.0000015056, 0.0000012056, 0.0000015750, 0.0000016675,
-        0.0000024250, 0.0000042013, 0.0000075469, 0.0000133644, 0.0000054156,
-        0.0006722575, 0.0000183787, 0.0000133425, 0.0000147812, 0.0000082531,
-        0.0000125219, 0.0000089475, 0.0000119875, 0.0000612137, 0.0000433431,
-        0.0000496081, 0.0000843556, 0.0007713847, 0.0006283623, 0.0001943663,
-        0.0026149303, 0.0030123263, 0.0037400492, 0.0048746220, 0.0048202025,
-        0.0043263664, 0.0025490553, 0.0055647288
-    ],
-    [
-        0.0000017925, 0.0000014737, 0.0000013662, 0.0000017069, 0.0000021725,
-        0.0000019575, 0.0000023769, 0.0000023062, 0.0000027194, 0.0000031506,
-        0.0000033725, 0.0000185131, 0.0000257206, 0.0000268131, 0.0000131425,
-        0.0000094144, 0.0000171262, 0.0000289669, 0.0000427131, 0.0000402256,
-        0.0003139489, 0.0000446081, 0.0015622985, 0.0002287901, 0.0002839351,
-        0.0056323586, 0.0028994908, 0.0055298950, 0.0056288200, 0.0039919168,
-        0.0022680196, 0.0049104006, 0.0045085652
-    ],
-    [
-        0.0000015650, 0.0000014912, 0.0000015338, 0.0000017112, 0.0000019037,
-        0.0000019106, 0.0000023919, 0.0000029919, 0.0000030781, 0.0000029831,
-        0.0000032338, 0.0000112963, 0.0000107556, 0.0000080981, 0.0000172012,
-        0.0000152631, 0.0000116481, 0.0000181738, 0.0000466144, 0.0005933935,
-        0.0001922457, 0.0003100163, 0.0001709776, 0.0002483101, 0.0005112860,
-        0.0024742472, 0.0015044505, 0.0050016795, 0.0045970641, 0.0043024491,
-        0.0028076130, 0.0036504988, 0.0044016591
-    ],
-    [
-        0.0000016063, 0.0000015869, 0.0000013806, 0.0000016612, 0.0000018575,
-        0.0000017944, 0.0000018200, 0.0000019531, 0.0000019469, 0.0000020231,
-        0.0000036531, 0.0000183069, 0.0000187212, 0.0000116719, 0.0000186432,
-        0.0000126569, 0.0000194900, 0.0000249838, 0.0000443194, 0.0000305476,
-        0.0003849340, 0.0000772744, 0.0004608009, 0.0000759075, 0.0002430327,
-        0.0036570015, 0.0063212039, 0.0017248627, 0.0046237591, 0.0037124036,
-        0.0036295780, 0.0061331750, 0.0043518906
-    ],
-    [
-        0.0000015800, 0.0000010838, 0.0000011919, 0.0000018319, 0.0000014119,
-        0.0000012300, 0.0000017275, 0.0000023763, 0.0000028206, 0.0000029538,
-        0.0000034369, 0.0000107831, 0.0000086606, 0.0000232744, 0.0000132081,
-        0.0000091794, 0.0000140719, 0.0000219081, 0.0000440389, 0.0002820939,
-        0.0002895052, 0.0000590056, 0.0002439001, 0.0001034307, 0.0002677594,
-        0.0046559563, 0.0032883270, 0.0046252091, 0.0043466301, 0.0042405510,
-        0.0047949394, 0.0043344907, 0.0053743627
-    ],
-    [
-        0.0000009912, 0.0000011337, 0.0000008550, 0.0000013419, 0.0000013256,
-        0.0000013037, 0.0000013069, 0.0000014600, 0.0000014762, 0.0000020294,
-        0.0000025275, 0.0000124381, 0.0000102231, 0.0000101731, 0.0000121994,
-        0.0000123038, 0.0000176881, 0.0000168688, 0.0000438400, 0.0001809357,
-        0.0001428107, 0.0000374333, 0.0006957435, 0.0003438585, 0.0003241596,
-        0.0039530694, 0.0035740091, 0.0039256206, 0.0061858501, 0.0052284622,
-        0.0058466662, 0.0054414631, 0.0039336644
-    ],
-    [
-        0.0000009544, 0.0000011338, 0.0000013194, 0.0000014688, 0.0000015625,
-        0.0000015369, 0.0000014206, 0.0000011662, 0.0000027344, 0.0000028312,
-        0.0000034813, 0.0000127813, 0.0000121663, 0.0000091594, 0.0000091275,
-        0.0000128681, 0.0000087844, 0.0000155501, 0.0000369937, 0.0003127927,
-        0.0000417100, 0.0001036344, 0.0004146646, 0.0001999464, 0.0015190783,
-        0.0053063980, 0.0051006917, 0.0028736705, 0.0046126880, 0.0049710581,
-        0.0031513250, 0.0041279434, 0.0049504787
-    ],
-    [
-        0.0000016794, 0.0000014963, 0.0000017069, 0.0000021500, 0.0000024094,
-        0.0000023413, 0.0000023712, 0.0000028775, 0.0000031013, 0.0000033356,
-        0.0000039369, 0.0000154825, 0.0000103508, 0.0000117669, 0.0000222119,
-        0.0000089550, 0.0000119800, 0.0000141325, 0.0000405969, 0.0001946033,
-        0.0001048606, 0.0005464104, 0.0001374363, 0.0002117719, 0.0003650090,
-        0.0042015254, 0.0034920671, 0.0027639635, 0.0037656906, 0.0038608867,
-        0.0032948973, 0.0046244296, 0.0040974710
-    ],
-    [
-        0.0000016187, 0.0000014369, 0.0000014738, 0.0000019362, 0.0000023037,
-        0.0000025781, 0.0000027256, 0.0000027687, 0.0000031744, 0.0000034856,
-        0.0000043269, 0.0000140431, 0.0000164475, 0.0000104363, 0.0000128900,
-        0.0000096294, 0.0000180425, 0.0000132350, 0.0000374119, 0.0001953077,
-        0.0000443807, 0.0000380269, 0.0005998516, 0.0002248883, 0.0001245326,
-        0.0048782188, 0.0032871237, 0.0050426028, 0.0052195648, 0.0038746784,
-        0.0035584059, 0.0038646222, 0.0049163853
-    ],
-    [
-        0.0000013219, 0.0000016157, 0.0000014013, 0.0000018406, 0.0000020412,
-        0.0000024225, 0.0000027738, 0.0000028581, 0.0000032269, 0.0000033287,
-        0.0000040350, 0.0000147606, 0.0000116931, 0.0000199482, 0.0000114844,
-        0.0000092075, 0.0000158969, 0.0000184513, 0.0000425506, 0.0000645831,
-        0.0000253794, 0.0000952794, 0.0004249396, 0.0003148808, 0.0001336432,
-        0.0036675404, 0.0054921182, 0.0025580488, 0.0027753473, 0.0043962891,
-        0.0060913060, 0.0035317682, 0.0037053034
-    ],
-    [
-        0.0000008169, 0.0000009138, 0.0000009838, 0.0000012225, 0.0000012519,
-        0.0000016850, 0.0000013869, 0.0000012194, 0.0000027006, 0.0000026231,
-        0.0000034319, 0.0000151569, 0.0000100269, 0.0000148513, 0.0000219962,
-        0.0000101825, 0.0000115187, 0.0000199194, 0.0000408800, 0.0000417706,
-        0.0001285688, 0.0002378676, 0.0001670801, 0.0003241888, 0.0018317315,
-        0.0025672601, 0.0024762421, 0.0023362921, 0.0045487895, 0.0044448441,
-        0.0043286891, 0.0045878245, 0.0049920222
-    ],
-    [
-        0.0000017419, 0.0000017156, 0.0000017913, 0.0000022200, 0.0000024681,
-        0.0000024663, 0.0000027456, 0.0000030813, 0.0000030763, 0.0000047138,
-        0.0000124900, 0.0000295588, 0.0000096356, 0.0000080981, 0.0000074394,
-        0.0000156113, 0.0000122775, 0.0000516632, 0.0000345744, 0.0000324807,
-        0.0003273115, 0.0004783877, 0.0004513827, 0.0001842214, 0.0005381529,
-        0.0052274358, 0.0042176158, 0.0043131858, 0.0037799845, 0.0052265516,
-        0.0032554090, 0.0038575090, 0.0036754452
-    ],
-    [
-        0.0000016444, 0.0000015013, 0.0000015037, 0.0000017644, 0.0000018513,
-        0.0000021181, 0.0000024894, 0.0000030156, 0.0000027406, 0.0000033525,
-        0.0000064812, 0.0000186894, 0.0000112844, 0.0000144444, 0.0000110650,
-        0.0000084619, 0.0000195888, 0.0000264550, 0.0000384344, 0.0000602769,
-        0.0000430864, 0.0001588732, 0.0004034733, 0.0000376326, 0.0003329452,
-        0.0045125596, 0.0037162022, 0.0025034351, 0.0026571567, 0.0023337058,
-        0.0051481044, 0.0027171979, 0.0047981674
-    ],
-    [
-        0.0000012388, 0.0000012850, 0.0000012019, 0.0000015788, 0.0000019863,
-        0.0000018688, 0.0000026206, 0.0000027488, 0.0000030150, 0.0000030206,
-        0.0000042613, 0.0000652713, 0.0000098794, 0.0000090694, 0.0000101656,
-        0.0000102225, 0.0000138594, 0.0000250351, 0.0000466606, 0.0000691906,
-        0.0002509164, 0.0022219711, 0.0004580134, 0.0003348477, 0.0003991515,
-        0.0023749953, 0.0051618405, 0.0037918419, 0.0046264338, 0.0047662552,
-        0.0029585836, 0.0043596546, 0.0040891683
-    ],
-    [
-        0.0000014500, 0.0000013500, 0.0000014763, 0.0000020050, 0.0000020794,
-        0.0000023819, 0.0000025100, 0.0000025031, 0.0000021975, 0.0000021144,
-        0.0000058513, 0.0000140281, 0.0000157919, 0.0000093813, 0.0000095644,
-        0.0000313769, 0.0000098956, 0.0000297362, 0.0000483619, 0.0000393288,
-        0.0001244832, 0.0001783264, 0.0000375081, 0.0006390685, 0.0000472632,
-        0.0049866922, 0.0050773411, 0.0059739263, 0.0030859173, 0.0064246580,
-        0.0047998023, 0.0047750338, 0.0035789490
-    ],
-    [
-        0.0000015337, 0.0000012431, 0.0000015069, 0.0000019063, 0.0000019556,
-        0.0000019469, 0.0000025494, 0.0000015913, 0.0000015256, 0.0000018944,
-        0.0000037456, 0.0000133662, 0.0000179362, 0.0000273294, 0.0000103775,
-        0.0000097613, 0.0000135131, 0.0000182563, 0.0000673539, 0.0002497157,
-        0.0004466178, 0.0001519382, 0.0000592469, 0.0004985091, 0.0000520481,
-        0.0036298442, 0.0032801437, 0.0040889978, 0.0038576350, 0.0034254661,
-        0.0029708352, 0.0029425989, 0.0043897764
-    ],
-])
-third_allocs = np.array([
-    [
-        0.0000000594, 0.0000000612, 0.0000000687, 0.0000000694, 0.0000000612,
-        0.0000001069, 0.0000000756, 0.0000000594, 0.0000000538, 0.0000000575,
-        0.0000002444, 0.0000001844, 0.0000000994, 0.0000001231, 0.0000090062,
-        0.0000026694, 0.0000163006, 0.0000080531, 0.0000126488, 0.0000095881,
-        0.0000160706, 0.0000071687, 0.0000253013, 0.0000123675, 0.0000204119,
-        0.0003397753, 0.0000889395, 0.0000924195, 0.0001172014, 0.0002242951,
-        0.0001717831, 0.0000822356, 0.0001598757
-    ],
-    [
-        0.0000001150, 0.0000001031, 0.0000000944, 0.0000001394, 0.0000001287,
-        0.0000001044, 0.0000000838, 0.0000000900, 0.0000000794, 0.0000000913,
-        0.0000001381, 0.0000001188, 0.0000000712, 0.0000001488, 0.0000030906,
-        0.0000225100, 0.0000078900, 0.0000031669, 0.0000251594, 0.0000219500,
-        0.0000151406, 0.0000123175, 0.0000222719, 0.0000266750, 0.0000154919,
-        0.0000529332, 0.0001414651, 0.0001744244, 0.0001059419, 0.0002440151,
-        0.0001284063, 0.0000959520, 0.0000942131
-    ],
-    [
-        0.0000000775, 0.0000000919, 0.0000000838, 0.0000000781, 0.0000000763,
-        0.0000000887, 0.0000000850, 0.0000001044, 0.0000000719, 0.0000000869,
-        0.0000001069, 0.0000001350, 0.0000001481, 0.0000002300, 0.0000210063,
-        0.0000080162, 0.0000070719, 0.0000029338, 0.0000026463, 0.0000104206,
-        0.0000092894, 0.0000284206, 0.0000047850, 0.0000252013, 0.0000259275,
-        0.0001469263, 0.0000673406, 0.0001535201, 0.0001174307, 0.0001909150,
-        0.0001211719, 0.0002794828, 0.0001393820
-    ],
-    [
-        0.0000000931, 0.0000000956, 0.0000002212, 0.0000000925, 0.0000000844,
-        0.0000001638, 0.0000001375, 0.0000001237, 0.0000001406, 0.0000000931,
-        0.0000004431, 0.0000001319, 0.0000002013, 0.0000001956, 0.0000093269,
-        0.0000138587, 0.0000085775, 0.0000068969, 0.0000069275, 0.0000134862,
-        0.0000215719, 0.0000130219, 0.0000065081, 0.0000151662, 0.0000136101,
-        0.0000429962, 0.0000969531, 0.0001285506, 0.0001341338, 0.0001939113,
-        0.0001098900, 0.0001827888, 0.0001013888
-    ],
-    [
-        0.0000000788, 0.0000000713, 0.0000000813, 0.0000000725, 0.0000000744,
-        0.0000000856, 0.0000000887, 0.0000001137, 0.0000001813, 0.0000001113,
-        0.0000000650, 0.0000001456, 0.0000001412, 0.0000001531, 0.0000013738,
-        0.0000042325, 0.0000095688, 0.0000188256, 0.0000161812, 0.0000232156,
-        0.0000369919, 0.0000086775, 0.0000116806, 0.0000139300, 0.0000080781,
-        0.0000790013, 0.0000693344, 0.0001205526, 0.0001248239, 0.0001145594,
-        0.0001396526, 0.0000969975, 0.0001809339
-    ],
-    [
-        0.0000000831, 0.0000000719, 0.0000001794, 0.0000000863, 0.0000000913,
-        0.0000000787, 0.0000000788, 0.0000000994, 0.0000001056, 0.0000000819,
-        0.0000004750, 0.0000000831, 0.0000000925, 0.0000001100, 0.0000039331,
-        0.0000042737, 0.0000123050, 0.0000132525, 0.0000158419, 0.0000088981,
-        0.0000128812, 0.0000167987, 0.0000224314, 0.0000190763, 0.0000135956,
-        0.0000872594, 0.0000963100, 0.0001777088, 0.0001122277, 0.0002015907,
-        0.0001324332, 0.0000997907, 0.0001173613
-    ],
-    [
-        0.0000000750, 0.0000000737, 0.0000000813, 0.0000000831, 0.0000000762,
-        0.0000000694, 0.0000000800, 0.0000000844, 0.0000000950, 0.0000000969,
-        0.0000001687, 0.0000004950, 0.0000001038, 0.0000001700, 0.0000080988,
-        0.0000182138, 0.0000191882, 0.0000040937, 0.0000044931, 0.0000132800,
-        0.0000064163, 0.0000318695, 0.0000102251, 0.0000084706, 0.0000271350,
-        0.0001035700, 0.0000720194, 0.0001802870, 0.0001285783, 0.0000980294,
-        0.0001079544, 0.0000943306, 0.0001934500
-    ],
-    [
-        0.0000000838, 0.0000000831, 0.0000000881, 0.0000000988, 0.0000000706,
-        0.0000001669, 0.0000000919, 0.0000001656, 0.0000000850, 0.0000008619,
-        0.0000001587, 0.0000001469, 0.0000002225, 0.0000003337, 0.0000239475,
-        0.0000240713, 0.0000067163, 0.0000122406, 0.0000124456, 0.0000171094,
-        0.0000165963, 0.0000156950, 0.0000500326, 0.0000086231, 0.0000102556,
-        0.0000257044, 0.0001771657, 0.0002518827, 0.0001401156, 0.0001697389,
-        0.0002071488, 0.0001071713, 0.0001144826
-    ],
-    [
-        0.0000000613, 0.0000000650, 0.0000000763, 0.0000000731, 0.0000002888,
-        0.0000003750, 0.0000003800, 0.0000000869, 0.0000000850, 0.0000000856,
-        0.0000000825, 0.0000001750, 0.0000002906, 0.0000002556, 0.0000551906,
-        0.0000086200, 0.0000129875, 0.0000269144, 0.0000109156, 0.0000111469,
-        0.0000044144, 0.0000302538, 0.0000053588, 0.0000182119, 0.0000167107,
-        0.0000935819, 0.0001019381, 0.0000780025, 0.0000879346, 0.0001613258,
-        0.0001478019, 0.0000655576, 0.0001281113
-    ],
-    [
-        0.0000000675, 0.0000000756, 0.0000001119, 0.0000000850, 0.0000002375,
-        0.0000000975, 0.0000000881, 0.0000000913, 0.0000000944, 0.0000001037,
-        0.0000002144, 0.0000006644, 0.0000001931, 0.0000002194, 0.0000216775,
-        0.0000052331, 0.0000097819, 0.0000099931, 0.0000064794, 0.0000220219,
-        0.0000352194, 0.0000047756, 0.0000062913, 0.0000142631, 0.0000213050,
-        0.0001150519, 0.0000675276, 0.0000470770, 0.0001634576, 0.0000957932,
-        0.0000666869, 0.0001316256, 0.0003558552
-    ],
-    [
-        0.0000001000, 0.0000000762, 0.0000000825, 0.0000000931, 0.0000001000,
-        0.0000001163, 0.0000001325, 0.0000000775, 0.0000000881, 0.0000000950,
-        0.0000000750, 0.0000000863, 0.0000001894, 0.0000001794, 0.0000039681,
-        0.0000077294, 0.0000249625, 0.0000150325, 0.0000155594, 0.0000058313,
-        0.0000052806, 0.0000157669, 0.0000107612, 0.0000165562, 0.0000337988,
-        0.0001130913, 0.0000714838, 0.0001742995, 0.0001101976, 0.0002864390,
-        0.0000529181, 0.0001415394, 0.0001803994
-    ],
-    [
-        0.0000000875, 0.0000001562, 0.0000000981, 0.0000000988, 0.0000000938,
-        0.0000000775, 0.0000000863, 0.0000001237, 0.0000005706, 0.0000000838,
-        0.0000000875, 0.0000000906, 0.0000001544, 0.0000002050, 0.0000016600,
-        0.0000043275, 0.0000081413, 0.0000051250, 0.0000047106, 0.0000055656,
-        0.0000012850, 0.0000190169, 0.0000040725, 0.0000147519, 0.0027933447,
-        0.0000612557, 0.0001068151, 0.0001239932, 0.0000917494, 0.0001149719,
-        0.0001145556, 0.0001374982, 0.0001476833
-    ],
-    [
-        0.0000001269, 0.0000000888, 0.0000000813, 0.0000001125, 0.0000001637,
-        0.0000012338, 0.0000001387, 0.0000001144, 0.0000001081, 0.0000000938,
-        0.0000001144, 0.0000001337, 0.0000001525, 0.0000008206, 0.0000023225,
-        0.0000160994, 0.0000093556, 0.0000179481, 0.0000044062, 0.0000144213,
-        0.0000272494, 0.0000058338, 0.0000160975, 0.0000042206, 0.0000163838,
-        0.0001177094, 0.0001154312, 0.0000535276, 0.0001094184, 0.0001024944,
-        0.0002171164, 0.0002802390, 0.0001433164
-    ],
-    [
-        0.0000000919, 0.0000001162, 0.0000000969, 0.0000000894, 0.0000001081,
-        0.0000000881, 0.0000001088, 0.0000001269, 0.0000000944, 0.0000000844,
-        0.0000001150, 0.0000001281, 0.0000001606, 0.0000001188, 0.0000075963,
-        0.0000021500, 0.0000049850, 0.0000012300, 0.0000124631, 0.0000061425,
-        0.0000120151, 0.0000090313, 0.0000188063, 0.0000080950, 0.0000859050,
-        0.0000506506, 0.0000677425, 0.0001565907, 0.0002651446, 0.0001418333,
-        0.0001528770, 0.0001607208, 0.0001615307
-    ],
-    [
-        0.0000000937, 0.0000000931, 0.0000002631, 0.0000000938, 0.0000000906,
-        0.0000000844, 0.0000001113, 0.0000000806, 0.0000000956, 0.0000001269,
-        0.0000001275, 0.0000000938, 0.0000001537, 0.0000002131, 0.0000035250,
-        0.0000024787, 0.0000022894, 0.0000032606, 0.0000128606, 0.0000326775,
-        0.0000260631, 0.0000099681, 0.0000139275, 0.0000196357, 0.0000329863,
-        0.0001226239, 0.0001063338, 0.0001444052, 0.0002195759, 0.0000963114,
-        0.0001599327, 0.0000753206, 0.0001054151
-    ],
-    [
-        0.0000001000, 0.0000000775, 0.0000000950, 0.0000001056, 0.0000001069,
-        0.0000002419, 0.0000001150, 0.0000001375, 0.0000001194, 0.0000001856,
-        0.0000002169, 0.0000001406, 0.0000001475, 0.0000001656, 0.0000052469,
-        0.0000110362, 0.0000207856, 0.0000052456, 0.0000102869, 0.0000058938,
-        0.0000144158, 0.0000188119, 0.0000243663, 0.0000119625, 0.0000549438,
-        0.0001454512, 0.0001555671, 0.0001269194, 0.0001151044, 0.0002314508,
-        0.0001541113, 0.0000964225, 0.0002860890
-    ],
-])
-third_frees = np.array([
-    [
-        0.0000011681, 0.0000011844, 0.0000012131, 0.0000015187, 0.0000021681,
-        0.0000031806, 0.0000048544, 0.0000117494, 0.0000103575, 0.0000235625,
-        0.0000276175, 0.0001290913, 0.0000132745, 0.0000116550, 0.0001027382,
-        0.0000442994, 0.0000626600, 0.0000487087, 0.0000580494, 0.0000533588,
-        0.0000446419, 0.0001255401, 0.0025084543, 0.0000789281, 0.0102892611,
-        0.0044119284, 0.0051158336, 0.0058738366, 0.0066154907, 0.0061144503,
-        0.0068090623, 0.0065368577, 0.0069225905
-    ],
-    [
-        0.0000012456, 0.0000014819, 0.0000013856, 0.0000017706, 0.0000028219,
-        0.0000035531, 0.0000040238, 0.0000160013, 0.0000153987, 0.0000100256,
-        0.0000520538, 0.0000661075, 0.0000520406, 0.0000116844, 0.0000572039,
-        0.0000805594, 0.0000699713, 0.0000450300, 0.0001495125, 0.0000615852,
-        0.0000834256, 0.0004840278, 0.0004281716, 0.0002713064, 0.0048849522,
-        0.0056566289, 0.0060595772, 0.0073137628, 0.0061173332, 0.0093553951,
-        0.0100642145, 0.0092237676, 0.0096272714
-    ],
-    [
-        0.0000015556, 0.0000013981, 0.0000016044, 0.0000015206, 0.0000019325,
-        0.0000031213, 0.0000026713, 0.0000502083, 0.0001089813, 0.0000956054,
-        0.0000291500, 0.0000125481, 0.0000175056, 0.0000186502, 0.0001271731,
-        0.0000691881, 0.0001020500, 0.0000418376, 0.0000206169, 0.0000297369,
-        0.0000423013, 0.0000736525, 0.0000664150, 0.0000915651, 0.0047023431,
-        0.0067608543, 0.0057278331, 0.0088745123, 0.0072982716, 0.0109231677,
-        0.0098843323, 0.0108739808, 0.0106693022
-    ],
-    [
-        0.0000017625, 0.0000019412, 0.0000017000, 0.0000020600, 0.0000022413,
-        0.0000030619, 0.0000028819, 0.0000118706, 0.0000227332, 0.0001932538,
-        0.0001395544, 0.0000219213, 0.0000134525, 0.0000132456, 0.0002203045,
-        0.0000413319, 0.0001122619, 0.0000479139, 0.0000640425, 0.0000850788,
-        0.0000400937, 0.0002151338, 0.0000894201, 0.0001246913, 0.0061384980,
-        0.0023268403, 0.0065885335, 0.0077788667, 0.0069215195, 0.0104844365,
-        0.0110363923, 0.0090314355, 0.0088792853
-    ],
-    [
-        0.0000012687, 0.0000014344, 0.0000016231, 0.0000015988, 0.0000017481,
-        0.0000024069, 0.0000021681, 0.0000135500, 0.0000681475, 0.0001067816,
-        0.0000115206, 0.0000156494, 0.0000122656, 0.0000362996, 0.0001565113,
-        0.0000651356, 0.0000467194, 0.0000650607, 0.0000693381, 0.0001412001,
-        0.0000833337, 0.0001228869, 0.0002303959, 0.0001311638, 0.0101415664,
-        0.0024261167, 0.0051492052, 0.0066445991, 0.0092890756, 0.0076752095,
-        0.0074955784, 0.0086777089, 0.0086662415
-    ],
-    [
-        0.0000016300, 0.0000014844, 0.0000013600, 0.0000015244, 0.0000018244,
-        0.0000021956, 0.0000030356, 0.0000074112, 0.0000812950, 0.0000955412,
-        0.0000575402, 0.0000140556, 0.0000386300, 0.0000155125, 0.0000768020,
-        0.0000551338, 0.0000335082, 0.0000523187, 0.0001567194, 0.0001372001,
-        0.0001268519, 0.0000895675, 0.0000600906, 0.0001685781, 0.0063297139,
-        0.0029140869, 0.0066162832, 0.0083859582, 0.0096292552, 0.0120313670,
-        0.0102213556, 0.0091468301, 0.0097646285
-    ],
-    [
-        0.0000021025, 0.0000013819, 0.0000016275, 0.0000015094, 0.0000018450,
-        0.0000023469, 0.0000025138, 0.0000137100, 0.0000229169, 0.0000984200,
-        0.0001146506, 0.0001018719, 0.0000136625, 0.0000368894, 0.0001069925,
-        0.0000923363, 0.0000963363, 0.0000571306, 0.0000701651, 0.0000988894,
-        0.0000932551, 0.0000559094, 0.0003363408, 0.0001370688, 0.0065201144,
-        0.0060299528, 0.0065961317, 0.0080899121, 0.0080437651, 0.0112460479,
-        0.0113892443, 0.0091324262, 0.0096112061
-    ],
-    [
-        0.0000015050, 0.0000017900, 0.0000013963, 0.0000014175, 0.0000018981,
-        0.0000027862, 0.0000026075, 0.0001248619, 0.0000130237, 0.0001082631,
-        0.0000755434, 0.0000146256, 0.0000155038, 0.0000217994, 0.0002412058,
-        0.0000663194, 0.0000909237, 0.0001018676, 0.0000416157, 0.0000861157,
-        0.0003627003, 0.0002372145, 0.0002352475, 0.0001033425, 0.0057135774,
-        0.0016695672, 0.0069082454, 0.0100590121, 0.0081689898, 0.0083440272,
-        0.0111834425, 0.0088356072, 0.0106438892
-    ],
-    [
-        0.0000013419, 0.0000014606, 0.0000013844, 0.0000014431, 0.0000019331,
-        0.0000023587, 0.0000026856, 0.0000066437, 0.0000079981, 0.0001064737,
-        0.0000201612, 0.0000142125, 0.0000133475, 0.0000199537, 0.0001449339,
-        0.0000504256, 0.0001259863, 0.0001617489, 0.0001507165, 0.0001271319,
-        0.0000779101, 0.0002826027, 0.0002189044, 0.0001163007, 0.0081847077,
-        0.0059231515, 0.0050070854, 0.0070139403, 0.0047623315, 0.0088465298,
-        0.0090970136, 0.0073718298, 0.0079911090
-    ],
-    [
-        0.0000015387, 0.0000013062, 0.0000014025, 0.0000018969, 0.0000024325,
-        0.0000026519, 0.0000030144, 0.0000132538, 0.0000665125, 0.0001102622,
-        0.0001684762, 0.0001031812, 0.0000180025, 0.0000161957, 0.0000603094,
-        0.0000519494, 0.0000999813, 0.0000873919, 0.0000695294, 0.0000946419,
-        0.0001100889, 0.0000646119, 0.0001199007, 0.0001090931, 0.0131744109,
-        0.0029954240, 0.0057358420, 0.0085011860, 0.0083921328, 0.0066917720,
-        0.0088971574, 0.0102466596, 0.0101910559
-    ],
-    [
-        0.0000018194, 0.0000014425, 0.0000016450, 0.0000015888, 0.0000018950,
-        0.0000026925, 0.0000022869, 0.0000468206, 0.0000131769, 0.0000337456,
-        0.0000222444, 0.0000098219, 0.0000302526, 0.0000155187, 0.0001613538,
-        0.0000739775, 0.0000560456, 0.0000508319, 0.0000548226, 0.0000708700,
-        0.0001342762, 0.0004252996, 0.0000796237, 0.0002104332, 0.0068691927,
-        0.0025047541, 0.0076969829, 0.0092247818, 0.0092152664, 0.0101211118,
-        0.0084123360, 0.0096415253, 0.0095755244
-    ],
-    [
-        0.0000013819, 0.0000018556, 0.0000019400, 0.0000016900, 0.0000023094,
-        0.0000027212, 0.0000024519, 0.0000195919, 0.0000703200, 0.0000708426,
-        0.0000561881, 0.0000269288, 0.0000119300, 0.0000197694, 0.0000783206,
-        0.0000747575, 0.0001190650, 0.0000624019, 0.0000355431, 0.0001107312,
-        0.0000635682, 0.0003107927, 0.0001189051, 0.0000671426, 0.0085606053,
-        0.0024958029, 0.0059916270, 0.0090793204, 0.0093286177, 0.0111608570,
-        0.0099198008, 0.0102874311, 0.0103645483
-    ],
-    [
-        0.0000015050, 0.0000014806, 0.0000014575, 0.0000022719, 0.0000023819,
-        0.0000033006, 0.0000032719, 0.0000073356, 0.0000126500, 0.0000338494,
-        0.0000095625, 0.0000146962, 0.0000430431, 0.0000824906, 0.0000326237,
-        0.0000720838, 0.0000560701, 0.0001153533, 0.0000836632, 0.0001024526,
-        0.0001313689, 0.0001469907, 0.0003275284, 0.0002203489, 0.0071724141,
-        0.0029233408, 0.0054029683, 0.0070911190, 0.0055536139, 0.0083123120,
-        0.0083862115, 0.0103488732, 0.0073657436
-    ],
-    [
-        0.0000014762, 0.0000015356, 0.0000015281, 0.0000017025, 0.0000025556,
-        0.0000024738, 0.0000023681, 0.0000705469, 0.0000087156, 0.0000153506,
-        0.0000114981, 0.0000119875, 0.0000146556, 0.0000178469, 0.0001975257,
-        0.0000582481, 0.0000518244, 0.0000281919, 0.0000699050, 0.0000718344,
-        0.0000906662, 0.0000610844, 0.0002658277, 0.0000576581, 0.0033740094,
-        0.0030343058, 0.0077602724, 0.0093199480, 0.0097300000, 0.0098062819,
-        0.0104977759, 0.0100860205, 0.0111938892
-    ],
-    [
-        0.0000014006, 0.0000014801, 0.0000018112, 0.0000017113, 0.0000020187,
-        0.0000024169, 0.0000023044, 0.0000065219, 0.0000100475, 0.0000083644,
-        0.0000134819, 0.0000154256, 0.0000110775, 0.0000179044, 0.0000625519,
-        0.0000624775, 0.0000533744, 0.0000668282, 0.0000731327, 0.0000902888,
-        0.0000854700, 0.0000911881, 0.0002063862, 0.0001744163, 0.0064749676,
-        0.0052430853, 0.0061597424, 0.0082439613, 0.0090026474, 0.0107774045,
-        0.0105035566, 0.0098147802, 0.0092292558
-    ],
-    [
-        0.0000012869, 0.0000018081, 0.0000021144, 0.0000016213, 0.0000020931,
-        0.0000025856, 0.0000030563, 0.0000106306, 0.0000086450, 0.0000119419,
-        0.0000625033, 0.0000189744, 0.0000322806, 0.0000258931, 0.0001342719,
-        0.0001046975, 0.0001134263, 0.0000455144, 0.0000526825, 0.0000715881,
-        0.0000615513, 0.0002394252, 0.0001588269, 0.0000631276, 0.0095443465,
-        0.0056499932, 0.0060482351, 0.0063559995, 0.0060944436, 0.0095020384,
-        0.0090609286, 0.0079585435, 0.0084624197
-    ],
-])
-third_tbballocs = np.array([
-    [
-        0.0000000556, 0.0000000494, 0.0000000763, 0.0000000588, 0.0000001306,
-        0.0000000650, 0.0000000625, 0.0000000563, 0.0000001275, 0.0000004719,
-        0.0000001563, 0.0000005694, 0.0000008794, 0.0000017044, 0.0000009606,
-        0.0000012387, 0.0000020638, 0.0000031412, 0.0000031188, 0.0000160819,
-        0.0000205100, 0.0001150851, 0.0000236825, 0.0000092250, 0.0000298300,
-        0.0000331156, 0.0001205801, 0.0000745013, 0.0002468889, 0.0006745254,
-        0.0001286707, 0.0002769440, 0.0003948315
-    ],
-    [
-        0.0000000688, 0.0000000794, 0.0000000913, 0.0000000656, 0.0000001250,
-        0.0000000688, 0.0000000581, 0.0000000700, 0.0000000619, 0.0000000775,
-        0.0000003913, 0.0000001806, 0.0000009331, 0.0000009581, 0.0000013825,
-        0.0000007938, 0.0000011481, 0.0000012394, 0.0000026644, 0.0000434532,
-        0.0000521188, 0.0000269600, 0.0000291369, 0.0000106794, 0.0000825494,
-        0.0000338687, 0.0000313944, 0.0003754114, 0.0002560433, 0.0003806959,
-        0.0001361307, 0.0003023732, 0.0001051039
-    ],
-    [
-        0.0000000750, 0.0000001050, 0.0000000631, 0.0000000988, 0.0000000638,
-        0.0000000919, 0.0000000781, 0.0000000813, 0.0000000625, 0.0000001613,
-        0.0000001081, 0.0000002038, 0.0000015100, 0.0000012569, 0.0000013281,
-        0.0000013719, 0.0000016388, 0.0000032481, 0.0000044119, 0.0001706914,
-        0.0000233012, 0.0000432988, 0.0000589932, 0.0000058556, 0.0000211825,
-        0.0000257614, 0.0000380356, 0.0000336138, 0.0000402187, 0.0000286644,
-        0.0002429869, 0.0002817752, 0.0000323625
-    ],
-    [
-        0.0000000631, 0.0000000725, 0.0000001138, 0.0000001056, 0.0000001000,
-        0.0000000962, 0.0000000981, 0.0000000700, 0.0000001463, 0.0000004462,
-        0.0000002219, 0.0000006694, 0.0000013300, 0.0000012969, 0.0000014194,
-        0.0000007944, 0.0000009981, 0.0000017306, 0.0000027988, 0.0000193151,
-        0.0000925725, 0.0000583700, 0.0000703757, 0.0000144987, 0.0000865501,
-        0.0000279688, 0.0005543222, 0.0004733440, 0.0001545589, 0.0001217288,
-        0.0003237776, 0.0001446195, 0.0000285250
-    ],
-    [
-        0.0000000612, 0.0000000769, 0.0000000875, 0.0000001256, 0.0000000838,
-        0.0000000888, 0.0000000825, 0.0000000738, 0.0000000844, 0.0000002737,
-        0.0000001281, 0.0000017269, 0.0000011688, 0.0000015431, 0.0000007869,
-        0.0000007056, 0.0000024325, 0.0000015137, 0.0000041562, 0.0001251069,
-        0.0000324444, 0.0000459545, 0.0001232319, 0.0000127687, 0.0000421031,
-        0.0000394551, 0.0000384075, 0.0002913633, 0.0001895426, 0.0000282894,
-        0.0001833813, 0.0004804846, 0.0002867083
-    ],
-    [
-        0.0000000838, 0.0000000994, 0.0000000744, 0.0000000869, 0.0000000556,
-        0.0000000694, 0.0000000913, 0.0000000563, 0.0000000713, 0.0000000688,
-        0.0000003269, 0.0000002881, 0.0000011394, 0.0000012575, 0.0000009769,
-        0.0000011944, 0.0000022100, 0.0000028094, 0.0000020000, 0.0000567463,
-        0.0001433776, 0.0000772919, 0.0001108169, 0.0000390176, 0.0000137781,
-        0.0002194883, 0.0003190115, 0.0003627546, 0.0003959503, 0.0002766346,
-        0.0004691340, 0.0001193607, 0.0000884457
-    ],
-    [
-        0.0000000944, 0.0000000706, 0.0000000731, 0.0000000856, 0.0000001056,
-        0.0000000894, 0.0000000981, 0.0000000713, 0.0000000894, 0.0000000669,
-        0.0000001181, 0.0000004525, 0.0000015556, 0.0000013013, 0.0000009162,
-        0.0000011831, 0.0000013812, 0.0000017475, 0.0000104650, 0.0000185056,
-        0.0001291338, 0.0000535644, 0.0000459937, 0.0000156456, 0.0000477538,
-        0.0001974758, 0.0000599106, 0.0002953770, 0.0005369997, 0.0001878331,
-        0.0000315744, 0.0007348243, 0.0000223762
-    ],
-    [
-        0.0000000863, 0.0000000631, 0.0000000875, 0.0000000762, 0.0000000994,
-        0.0000000994, 0.0000000750, 0.0000000900, 0.0000000781, 0.0000000631,
-        0.0000005719, 0.0000003031, 0.0000005169, 0.0000014675, 0.0000007306,
-        0.0000014725, 0.0000018731, 0.0000010300, 0.0000045438, 0.0000175244,
-        0.0000171369, 0.0001050682, 0.0002056788, 0.0000113363, 0.0000120562,
-        0.0000172719, 0.0000312756, 0.0003520202, 0.0002092620, 0.0001200225,
-        0.0001000476, 0.0007479761, 0.0002961539
-    ],
-    [
-        0.0000000625, 0.0000000600, 0.0000001250, 0.0000000788, 0.0000000756,
-        0.0000000787, 0.0000000825, 0.0000000737, 0.0000000813, 0.0000001262,
-        0.0000002631, 0.0000002688, 0.0000014556, 0.0000016188, 0.0000010862,
-        0.0000065681, 0.0000011625, 0.0000026756, 0.0000042200, 0.0000172219,
-        0.0001404619, 0.0001117745, 0.0000825725, 0.0000416838, 0.0000182806,
-        0.0000449338, 0.0000295544, 0.0003412052, 0.0002048964, 0.0000558119,
-        0.0000299763, 0.0004145778, 0.0003084252
-    ],
-    [
-        0.0000001056, 0.0000000856, 0.0000000931, 0.0000000769, 0.0000000806,
-        0.0000000831, 0.0000000894, 0.0000000656, 0.0000000769, 0.0000002075,
-        0.0000010481, 0.0000012988, 0.0000012187, 0.0000012912, 0.0000010444,
-        0.0000012312, 0.0000048350, 0.0000012950, 0.0000047631, 0.0000203519,
-        0.0000885838, 0.0000290814, 0.0000270850, 0.0000138375, 0.0000091344,
-        0.0001423220, 0.0000393481, 0.0003258933, 0.0003307065, 0.0002106351,
-        0.0001109913, 0.0001223820, 0.0010689076
-    ],
-    [
-        0.0000000756, 0.0000000944, 0.0000000731, 0.0000000537, 0.0000001412,
-        0.0000000731, 0.0000000787, 0.0000000675, 0.0000000812, 0.0000000769,
-        0.0000007807, 0.0000004250, 0.0000006837, 0.0000008519, 0.0000007006,
-        0.0000010556, 0.0000018463, 0.0000039219, 0.0000029144, 0.0000049381,
-        0.0000164201, 0.0000309556, 0.0000949350, 0.0000233144, 0.0000139150,
-        0.0000434775, 0.0000426731, 0.0000331244, 0.0000263444, 0.0014707645,
-        0.0006675654, 0.0000346938, 0.0000655156
-    ],
-    [
-        0.0000000700, 0.0000000606, 0.0000000644, 0.0000000806, 0.0000000731,
-        0.0000000725, 0.0000000869, 0.0000000650, 0.0000000838, 0.0000000650,
-        0.0000002687, 0.0000003894, 0.0000010938, 0.0000013700, 0.0000005225,
-        0.0000010663, 0.0000020987, 0.0000015288, 0.0000021763, 0.0000337582,
-        0.0001000376, 0.0001009831, 0.0000641188, 0.0001315782, 0.0000144387,
-        0.0000294294, 0.0000479863, 0.0006319223, 0.0008363122, 0.0001898002,
-        0.0005041052, 0.0000281544, 0.0001554014
-    ],
-    [
-        0.0000000850, 0.0000001962, 0.0000001069, 0.0000000906, 0.0000000937,
-        0.0000000669, 0.0000000844, 0.0000000706, 0.0000000644, 0.0000001519,
-        0.0000005019, 0.0000021019, 0.0000010562, 0.0000006706, 0.0000014775,
-        0.0000011781, 0.0000011275, 0.0000010462, 0.0000055694, 0.0000603438,
-        0.0002990090, 0.0000312563, 0.0000147695, 0.0000677962, 0.0000273444,
-        0.0001006412, 0.0002226789, 0.0005476822, 0.0000455164, 0.0006376372,
-        0.0005540046, 0.0001191957, 0.0003532227
-    ],
-    [
-        0.0000000675, 0.0000000875, 0.0000000831, 0.0000000944, 0.0000000712,
-        0.0000000856, 0.0000000763, 0.0000000931, 0.0000001144, 0.0000001850,
-        0.0000004294, 0.0000011850, 0.0000011050, 0.0000010869, 0.0000009531,
-        0.0000009244, 0.0000014688, 0.0000038106, 0.0000052144, 0.0000140419,
-        0.0001383694, 0.0000695163, 0.0000875675, 0.0000098306, 0.0001065144,
-        0.0000323019, 0.0000439369, 0.0000481131, 0.0000659557, 0.0004525691,
-        0.0001016300, 0.0002133445, 0.0000321094
-    ],
-    [
-        0.0000000550, 0.0000000675, 0.0000000650, 0.0000000612, 0.0000000594,
-        0.0000000581, 0.0000000513, 0.0000000544, 0.0000000681, 0.0000002175,
-        0.0000001481, 0.0000568288, 0.0000012288, 0.0000011212, 0.0000006856,
-        0.0000006731, 0.0000012744, 0.0000020713, 0.0000019387, 0.0000382937,
-        0.0002893708, 0.0000577188, 0.0003427983, 0.0000174256, 0.0000142556,
-        0.0000950063, 0.0006145104, 0.0001601419, 0.0016674945, 0.0001641064,
-        0.0001570620, 0.0001665219, 0.0001687227
-    ],
-    [
-        0.0000000538, 0.0000000594, 0.0000000844, 0.0000001075, 0.0000000756,
-        0.0000000850, 0.0000000681, 0.0000000613, 0.0000000888, 0.0000001025,
-        0.0000013894, 0.0000011150, 0.0000011744, 0.0000008925, 0.0000019269,
-        0.0000013288, 0.0000012306, 0.0000008825, 0.0000009312, 0.0000238694,
-        0.0000407806, 0.0000714964, 0.0000264219, 0.0000391707, 0.0000123275,
-        0.0000564532, 0.0000285413, 0.0002962276, 0.0006120234, 0.0000255981,
-        0.0000978676, 0.0002177159, 0.0003048747
-    ],
-])
-third_tbbfrees = np.array([
-    [
-        0.0000016569, 0.0000014350, 0.0000021313, 0.0000030669, 0.0000028781,
-        0.0000053701, 0.0000054412, 0.0000039556, 0.0000047144, 0.0000510781,
-        0.0001969716, 0.0002568172, 0.0000239401, 0.0000119200, 0.0000177506,
-        0.0000170700, 0.0000293163, 0.0000352963, 0.0000510582, 0.0003697620,
-        0.0007063516, 0.0016173784, 0.0003873471, 0.0004290759, 0.0002798921,
-        0.0018734268, 0.0057195323, 0.0037374904, 0.0049020774, 0.0044307886,
-        0.0032114086, 0.0044498751, 0.0028708389
-    ],
-    [
-        0.0000019325, 0.0000017151, 0.0000022069, 0.0000027300, 0.0000034112,
-        0.0000036331, 0.0000055531, 0.0000058369, 0.0000098150, 0.0000332325,
-        0.0002616794, 0.0002275621, 0.0000228719, 0.0000086119, 0.0000111287,
-        0.0000126406, 0.0000205462, 0.0000278487, 0.0000391531, 0.0004895597,
-        0.0011904244, 0.0012970848, 0.0001993419, 0.0003468789, 0.0004898633,
-        0.0023752139, 0.0028737581, 0.0048515927, 0.0028015147, 0.0041145217,
-        0.0037458395, 0.0039724819, 0.0042153876
-    ],
-    [
-        0.0000022806, 0.0000019706, 0.0000024881, 0.0000028300, 0.0000032806,
-        0.0000037731, 0.0000063769, 0.0000094044, 0.0000121237, 0.0000734657,
-        0.0006191251, 0.0003548220, 0.0000338306, 0.0000103000, 0.0000126019,
-        0.0000155663, 0.0000228306, 0.0000276869, 0.0000405212, 0.0004525202,
-        0.0007282104, 0.0009973574, 0.0003987640, 0.0002296427, 0.0002098908,
-        0.0018761405, 0.0034309416, 0.0031905065, 0.0037412189, 0.0040954258,
-        0.0036016284, 0.0023459424, 0.0030514300
-    ],
-    [
-        0.0000021237, 0.0000021581, 0.0000026763, 0.0000038237, 0.0000036131,
-        0.0000042400, 0.0000078900, 0.0000085663, 0.0000178475, 0.0000701719,
-        0.0005899302, 0.0005167454, 0.0000263806, 0.0000149025, 0.0000188163,
-        0.0000166757, 0.0000203307, 0.0000353263, 0.0000490845, 0.0004235997,
-        0.0006680491, 0.0013545427, 0.0004591714, 0.0004195872, 0.0003589590,
-        0.0022148737, 0.0034775054, 0.0035736409, 0.0042685480, 0.0034755450,
-        0.0037567997, 0.0046659689, 0.0029129295
-    ],
-    [
-        0.0000017450, 0.0000020831, 0.0000025413, 0.0000040725, 0.0000046469,
-        0.0000058294, 0.0000060694, 0.0000096444, 0.0000087294, 0.0000313494,
-        0.0002273313, 0.0003351875, 0.0000154494, 0.0000098807, 0.0000188044,
-        0.0000171444, 0.0000298832, 0.0000384350, 0.0000410334, 0.0003669597,
-        0.0018496895, 0.0013797259, 0.0004354626, 0.0002571608, 0.0001973277,
-        0.0023336632, 0.0040509272, 0.0024523893, 0.0038693524, 0.0054412223,
-        0.0045456765, 0.0029913804, 0.0054548373
-    ],
-    [
-        0.0000022819, 0.0000018969, 0.0000022775, 0.0000030063, 0.0000032638,
-        0.0000038187, 0.0000088425, 0.0000098313, 0.0000114737, 0.0000741288,
-        0.0002497400, 0.0003384994, 0.0000237438, 0.0000077675, 0.0000131744,
-        0.0000282969, 0.0000238556, 0.0000299263, 0.0000404831, 0.0003680121,
-        0.0008403948, 0.0018260967, 0.0003673295, 0.0005961889, 0.0009800848,
-        0.0033432662, 0.0024869833, 0.0051441463, 0.0049315519, 0.0031811807,
-        0.0044851406, 0.0030299823, 0.0049312096
-    ],
-    [
-        0.0000021344, 0.0000021363, 0.0000024369, 0.0000034950, 0.0000035850,
-        0.0000055869, 0.0000047119, 0.0000075413, 0.0000118144, 0.0001603344,
-        0.0004220107, 0.0004362402, 0.0000270881, 0.0000104194, 0.0000115581,
-        0.0000202850, 0.0000271131, 0.0000330619, 0.0000566306, 0.0006219997,
-        0.0009911101, 0.0014219848, 0.0004264660, 0.0003194984, 0.0004839251,
-        0.0026009628, 0.0067864652, 0.0045521804, 0.0034799217, 0.0031645817,
-        0.0026230260, 0.0040470208, 0.0053351363
-    ],
-    [
-        0.0000020594, 0.0000018350, 0.0000021656, 0.0000028544, 0.0000035062,
-        0.0000039863, 0.0000064756, 0.0000093700, 0.0000117025, 0.0000421807,
-        0.0006653132, 0.0004270925, 0.0000226031, 0.0000096744, 0.0000137856,
-        0.0000156737, 0.0000285444, 0.0000325344, 0.0000415494, 0.0003800282,
-        0.0006254410, 0.0016673210, 0.0004358403, 0.0005172590, 0.0003408127,
-        0.0016694979, 0.0039326251, 0.0068708891, 0.0056168223, 0.0046729059,
-        0.0030295807, 0.0058236490, 0.0044673411
-    ],
-    [
-        0.0000020481, 0.0000018844, 0.0000025287, 0.0000030512, 0.0000033181,
-        0.0000042413, 0.0000060931, 0.0000085519, 0.0000187269, 0.0000971063,
-        0.0002810919, 0.0003546021, 0.0000188857, 0.0000109206, 0.0000141262,
-        0.0000180938, 0.0000240631, 0.0000285100, 0.0000453846, 0.0005393722,
-        0.0011615730, 0.0012050150, 0.0003404915, 0.0002532669, 0.0006122061,
-        0.0025568989, 0.0026543385, 0.0037807035, 0.0044111912, 0.0051924959,
-        0.0036496562, 0.0035966123, 0.0025084380
-    ],
-    [
-        0.0000020331, 0.0000018187, 0.0000025356, 0.0000030862, 0.0000033363,
-        0.0000059262, 0.0000084313, 0.0000045419, 0.0000050425, 0.0001404229,
-        0.0009563886, 0.0005738249, 0.0000329012, 0.0000096888, 0.0000171169,
-        0.0000239337, 0.0000342031, 0.0000308850, 0.0000451144, 0.0001601639,
-        0.0009697084, 0.0016547161, 0.0004391790, 0.0005198422, 0.0003299707,
-        0.0019435349, 0.0050738854, 0.0031887630, 0.0042964369, 0.0026686811,
-        0.0041382080, 0.0034580259, 0.0049295169
-    ],
-    [
-        0.0000020744, 0.0000016869, 0.0000025119, 0.0000029169, 0.0000055587,
-        0.0000037575, 0.0000057187, 0.0000084694, 0.0000110338, 0.0000409300,
-        0.0002501302, 0.0003106137, 0.0000183944, 0.0000100019, 0.0000161994,
-        0.0000162844, 0.0000338638, 0.0000328769, 0.0000255019, 0.0004081541,
-        0.0003784590, 0.0013279510, 0.0004604008, 0.0003343834, 0.0006393385,
-        0.0015389310, 0.0039157504, 0.0037264128, 0.0045507373, 0.0041963579,
-        0.0034372080, 0.0057494980, 0.0028831610
-    ],
-    [
-        0.0000026700, 0.0000018388, 0.0000023406, 0.0000028688, 0.0000033775,
-        0.0000042756, 0.0000076106, 0.0000078694, 0.0000101350, 0.0000400187,
-        0.0003707139, 0.0002978225, 0.0000294256, 0.0000120525, 0.0000132619,
-        0.0000238119, 0.0000287994, 0.0000298644, 0.0000364944, 0.0003019951,
-        0.0006169971, 0.0012653972, 0.0003237026, 0.0001660083, 0.0002424120,
-        0.0028860944, 0.0033561033, 0.0048955870, 0.0035705725, 0.0050278497,
-        0.0043818681, 0.0032017468, 0.0045095924
-    ],
-    [
-        0.0000019687, 0.0000019088, 0.0000024525, 0.0000031119, 0.0000033031,
-        0.0000101606, 0.0000064781, 0.0000045731, 0.0000060507, 0.0000644983,
-        0.0002665130, 0.0004820050, 0.0000165220, 0.0000085194, 0.0000142562,
-        0.0000126637, 0.0000200506, 0.0000313300, 0.0000441906, 0.0004845697,
-        0.0008512328, 0.0011688190, 0.0003219853, 0.0004463721, 0.0004629584,
-        0.0015101505, 0.0030162558, 0.0052135880, 0.0056027560, 0.0055029709,
-        0.0039309673, 0.0026374175, 0.0028542699
-    ],
-    [
-        0.0000020400, 0.0000020925, 0.0000024781, 0.0000036069, 0.0000034381,
-        0.0000058400, 0.0000059994, 0.0000168362, 0.0000053038, 0.0000620169,
-        0.0006502588, 0.0004190388, 0.0000174419, 0.0000106612, 0.0000142982,
-        0.0000198294, 0.0000249394, 0.0000243175, 0.0000426469, 0.0005443065,
-        0.0008653476, 0.0011099994, 0.0005320109, 0.0002992177, 0.0003920597,
-        0.0020517723, 0.0035888753, 0.0041062310, 0.0041491124, 0.0028809293,
-        0.0039994200, 0.0072792745, 0.0036543780
-    ],
-    [
-        0.0000019381, 0.0000018244, 0.0000021088, 0.0000027850, 0.0000031600,
-        0.0000033169, 0.0000049707, 0.0000066287, 0.0000124269, 0.0000686987,
-        0.0002633314, 0.0003884736, 0.0000116075, 0.0000103719, 0.0000136019,
-        0.0000201806, 0.0000263769, 0.0000262369, 0.0000514194, 0.0002873776,
-        0.0009176991, 0.0014283253, 0.0003258620, 0.0005037690, 0.0001171525,
-        0.0019078405, 0.0035846531, 0.0033692424, 0.0031213702, 0.0055062561,
-        0.0033232444, 0.0043349401, 0.0036923620
-    ],
-    [
-        0.0000018919, 0.0000017738, 0.0000025231, 0.0000031513, 0.0000034725,
-        0.0000040600, 0.0000044025, 0.0000045256, 0.0000050106, 0.0000500225,
-        0.0002144475, 0.0003087849, 0.0000223056, 0.0000137837, 0.0000130501,
-        0.0000160700, 0.0000259063, 0.0000291169, 0.0000378500, 0.0005497643,
-        0.0013260440, 0.0010775750, 0.0002190739, 0.0003892358, 0.0003104288,
-        0.0021753863, 0.0032090768, 0.0042314557, 0.0057176049, 0.0040796441,
-        0.0028955215, 0.0032992014, 0.0031345058
-    ],
-])
-fourth_allocs = np.array([
-    [
-        0.0003918752, 0.0004196778, 0.0004176142, 0.0003481463, 0.0003980952,
-        0.0003591756, 0.0003757539, 0.0017038948, 0.0046487544, 0.0050570322,
-        0.0020846380, 0.0013298834, 0.0010021023, 0.0012468710, 0.0148635609,
-        0.0246870629, 0.0244958699, 0.0271261968, 0.0266151186, 0.0252868030,
-        0.0305210445, 0.0680782571, 0.0423042588, 0.0459507704, 0.1119146496,
-        0.3446404934, 0.6075006127, 0.7023997307, 0.7315239906, 0.8162456155,
-        0.8059923649, 0.7778375745, 0.8146836758
-    ],
-    [
-        0.0004058717, 0.0003766977, 0.0003575936, 0.0003752601, 0.0003715541,
-        0.0003454133, 0.0003617051, 0.0020718800, 0.0049512293, 0.0059096985,
-        0.0026966422, 0.0010409083, 0.0010386973, 0.0027422977, 0.0160086043,
-        0.0188124534, 0.0211109370, 0.0209756568, 0.0302071273, 0.0480385050,
-        0.1205508709, 0.3851441145, 0.2018394470, 0.2753690481, 0.3216198981,
-        0.3488731384, 0.6385207176, 0.7652953267, 0.8133714199, 0.8706263900,
-        0.8305950165, 0.8371275663, 0.8374338746
-    ],
-    [
-        0.0004044867, 0.0003787617, 0.0003343344, 0.0002863906, 0.0003750040,
-        0.0003646114, 0.0003794512, 0.0021020935, 0.0061670123, 0.0055412217,
-        0.0022783794, 0.0010324612, 0.0011312724, 0.0012475582, 0.0199610125,
-        0.0330102332, 0.0326341391, 0.0351102836, 0.0811619535, 0.1050766334,
-        0.1248018518, 0.1374082863, 0.1671139002, 0.1239997000, 0.1576989293,
-        0.3533663750, 0.5800673366, 0.6635691524, 0.7335218787, 0.8109346032,
-        0.8040906787, 0.7921832800, 0.7734230161
-    ],
-    [
-        0.0003850031, 0.0003577859, 0.0003425654, 0.0003962044, 0.0003720444,
-        0.0003670505, 0.0003600397, 0.0017982797, 0.0059735146, 0.0077054976,
-        0.0028110577, 0.0009941432, 0.0008899019, 0.0009845769, 0.0150288390,
-        0.0189568549, 0.0226877332, 0.0210236683, 0.0272220913, 0.0242842771,
-        0.1678532213, 0.1298820227, 0.1550766826, 0.1432903409, 0.3848499060,
-        0.3329305053, 0.5593788028, 0.6737136841, 0.7870825529, 0.9286440611,
-        0.9870070219, 0.9350925684, 0.9524055123
-    ],
-    [
-        0.0003576090, 0.0003388412, 0.0002891507, 0.0003367449, 0.0002814455,
-        0.0003162545, 0.0003013221, 0.0027469103, 0.0042296452, 0.0054685138,
-        0.0023378674, 0.0012345779, 0.0017548316, 0.0007719506, 0.0156362392,
-        0.0204149671, 0.0248899590, 0.0252768118, 0.0313708149, 0.0407841690,
-        0.0455833413, 0.0442908183, 0.0912918299, 0.0476540849, 0.1786985397,
-        0.3558961451, 0.6854217052, 0.7395904660, 0.8262439966, 0.8986924887,
-        0.9981381297, 0.8984026313, 0.9240499139
-    ],
-    [
-        0.0002752969, 0.0002806799, 0.0003153216, 0.0002922170, 0.0003090487,
-        0.0003036244, 0.0003041589, 0.0025616619, 0.0051407362, 0.0051941364,
-        0.0029756357, 0.0010197988, 0.0008420930, 0.0009892025, 0.0188745055,
-        0.0210290533, 0.0219522677, 0.0229048692, 0.0229185149, 0.0280887242,
-        0.0337557569, 0.0509451181, 0.0519175716, 0.1376690865, 0.1677206755,
-        0.3718686700, 0.6561911106, 0.7728571296, 0.8844517469, 0.9197825193,
-        0.9321338534, 0.9600279927, 0.9414611459
-    ],
-    [
-        0.0003735529, 0.0003967368, 0.0003802074, 0.0003502615, 0.0003400962,
-        0.0003627039, 0.0003614405, 0.0017506147, 0.0058466545, 0.0049702004,
-        0.0019931220, 0.0011018076, 0.0008643187, 0.0010991713, 0.0162271746,
-        0.0287699997, 0.0249240063, 0.0268778913, 0.0274783596, 0.0317283198,
-        0.2073882669, 0.1866222769, 0.2646274567, 0.1509776711, 0.1686522067,
-        0.3571851850, 0.6615585089, 0.7753722668, 0.9669281840, 0.8632329106,
-        0.9422243834, 0.9621875882, 0.9051460028
-    ],
-    [
-        0.0003302064, 0.0003471319, 0.0003330302, 0.0003643271, 0.0003966221,
-        0.0004053564, 0.0004254905, 0.0018101861, 0.0052492633, 0.0045518335,
-        0.0021182683, 0.0010231285, 0.0011951074, 0.0016337631, 0.0159744881,
-        0.0297242608, 0.0296497196, 0.0310975984, 0.0299463682, 0.0848741382,
-        0.2914599478, 0.1164480969, 0.1600851417, 0.1645690799, 0.1550355554,
-        0.3923729658, 0.6820833683, 0.7668698430, 0.8317903876, 0.8927761316,
-        0.8617177010, 0.9295801520, 0.8419019580
-    ],
-    [
-        0.0003876536, 0.0003534575, 0.0003675056, 0.0003365432, 0.0003658721,
-        0.0003605786, 0.0003519010, 0.0029568190, 0.0052141286, 0.0047494951,
-        0.0039579188, 0.0009754475, 0.0012803402, 0.0009131830, 0.0161467213,
-        0.0228295233, 0.0249491222, 0.0281329136, 0.0303407572, 0.1064306349,
-        0.1192977801, 0.2071405947, 0.1602129936, 0.3287627101, 0.1458284259,
-        0.3757672906, 0.6101262569, 0.7310428023, 0.7916504741, 0.8741601110,
-        0.8699378967, 0.8202959895, 0.8730228543
-    ],
-    [
-        0.0003613229, 0.0003617200, 0.0003777330, 0.0003553985, 0.0003660202,
-        0.0003253527, 0.0003820752, 0.0018581742, 0.0047894237, 0.0036332146,
-        0.0013241989, 0.0012957359, 0.0015631653, 0.0018080861, 0.0164974760,
-        0.0236146338, 0.0294761043, 0.0270729177, 0.0319233611, 0.0571283139,
-        0.1280318499, 0.1819045395, 0.1548097581, 0.1931439042, 0.1134370416,
-        0.3487883210, 0.7038137913, 0.7542118430, 0.8693256974, 0.9357899427,
-        0.8789696097, 0.8422398567, 0.9171572924
-    ],
-    [
-        0.0003648046, 0.0003468007, 0.0003339376, 0.0003860356, 0.0003476133,
-        0.0003962168, 0.0004030896, 0.0018773775, 0.0051502390, 0.0045454036,
-        0.0023246473, 0.0011573166, 0.0011059179, 0.0011711436, 0.0184610896,
-        0.0244109090, 0.0268475898, 0.0353691392, 0.0487579256, 0.1165273413,
-        0.1464103758, 0.1534971446, 0.1919855326, 0.1099627465, 0.1832681596,
-        0.3550731838, 0.7202190757, 0.8186579347, 0.8582151532, 0.9301106930,
-        0.9501750469, 0.9249257445, 0.9009533525
-    ],
-    [
-        0.0003790465, 0.0003489654, 0.0003564085, 0.0003415669, 0.0003516933,
-        0.0003308120, 0.0003722414, 0.0019561169, 0.0057151029, 0.0046066637,
-        0.0022508739, 0.0011031332, 0.0010241506, 0.0010391054, 0.0168420915,
-        0.0289248265, 0.0318978652, 0.0286824573, 0.0328059681, 0.1310752928,
-        0.1215139851, 0.1514996290, 0.1871579736, 0.1554265916, 0.1226464733,
-        0.4252210259, 0.6629362702, 0.7361524105, 0.9150273204, 0.8471416831,
-        0.9658848047, 0.9234246612, 0.9225509167
-    ],
-    [
-        0.0004035719, 0.0004305856, 0.0003452458, 0.0003646322, 0.0003968040,
-        0.0003280804, 0.0003654749, 0.0020019126, 0.0051026414, 0.0042901738,
-        0.0022691404, 0.0011228075, 0.0012400137, 0.0012897303, 0.0178286787,
-        0.0228659268, 0.0283130202, 0.0309989825, 0.0316063687, 0.1522142589,
-        0.1344116926, 0.1282883584, 0.1479993165, 0.1866249144, 0.1679080576,
-        0.4017377794, 0.7059401870, 0.8099305630, 0.8576748371, 0.9472914934,
-        0.9262548685, 0.8867758512, 0.9369788766
-    ],
-    [
-        0.0003929994, 0.0003814962, 0.0003239185, 0.0003813662, 0.0003346468,
-        0.0003407974, 0.0003134436, 0.0018580852, 0.0051743998, 0.0042446945,
-        0.0020919875, 0.0008395036, 0.0009720969, 0.0022215489, 0.0164537374,
-        0.0268084798, 0.0304496028, 0.0347784236, 0.0348459631, 0.1040892974,
-        0.1293376684, 0.1317017823, 0.1497088820, 0.1454682648, 0.1587384045,
-        0.3924314082, 0.6654744744, 0.7555466890, 0.8685158491, 0.8996613026,
-        0.9031388760, 0.8870322704, 0.9042488337
-    ],
-    [
-        0.0003973538, 0.0003536293, 0.0003342609, 0.0003510109, 0.0003673054,
-        0.0003974441, 0.0003675269, 0.0019702357, 0.0049794558, 0.0052262284,
-        0.0021251247, 0.0009704871, 0.0008602564, 0.0010116743, 0.0187834185,
-        0.0303209107, 0.0276855268, 0.0283079054, 0.0320790522, 0.1206512898,
-        0.1305209696, 0.1435597539, 0.1705819517, 0.1527288705, 0.1549825072,
-        0.3540990353, 0.6428939700, 0.7246891260, 0.8307071328, 0.8503981233,
-        0.9022480845, 0.8598812819, 0.8717908263
-    ],
-    [
-        0.0003942687, 0.0003471427, 0.0003632365, 0.0003989709, 0.0003639989,
-        0.0003766650, 0.0004263911, 0.0018351185, 0.0044790674, 0.0045664553,
-        0.0022788744, 0.0010953263, 0.0010398288, 0.0013286044, 0.0176020712,
-        0.0223976970, 0.0253153592, 0.0280318353, 0.1002453268, 0.1331086010,
-        0.2212354094, 0.2472490370, 0.1290012747, 0.1763025969, 0.1424174458,
-        0.3705645502, 0.6516649127, 0.7901706696, 0.9137423038, 0.9170246124,
-        0.9148909450, 0.9186254740, 0.8906500340
-    ],
-])
-fourth_frees = np.array([
-    [
-        0.0003266891, 0.0003451873, 0.0003510259, 0.0002751356, 0.0003338477,
-        0.0003036392, 0.0003313550, 0.0097557586, 0.0085086478, 0.0076791672,
-        0.0115174800, 0.0019274253, 0.0010656886, 0.0013357681, 0.0041376837,
-        0.0102894036, 0.0097223250, 0.0104909753, 0.0110745020, 0.0107155358,
-        0.0124227647, 0.0176001750, 0.0151530011, 0.0163248722, 0.0728147924,
-        0.2876947224, 0.5713416338, 0.6825607419, 0.7181949019, 0.7848248482,
-        0.7998983264, 0.7617022991, 0.8096957207
-    ],
-    [
-        0.0003327572, 0.0003128893, 0.0002975542, 0.0003128353, 0.0003064653,
-        0.0002892232, 0.0003122754, 0.0112515138, 0.0082265148, 0.0192301851,
-        0.0113378149, 0.0013439342, 0.0060060755, 0.0012321416, 0.0041970671,
-        0.0060369498, 0.0061228541, 0.0059925471, 0.0088631846, 0.0146814669,
-        0.0436302125, 0.2458986044, 0.0514084101, 0.1346458495, 0.1963365674,
-        0.2908695638, 0.6139058471, 0.7525209785, 0.7994223833, 0.8514876962,
-        0.8440335989, 0.8311017752, 0.8330425024
-    ],
-    [
-        0.0003396961, 0.0003204420, 0.0002753586, 0.0002559394, 0.0003157981,
-        0.0003109875, 0.0003245024, 0.0095333681, 0.0096450634, 0.0088470569,
-        0.0036663804, 0.0012296516, 0.0011863655, 0.0052179093, 0.0077709043,
-        0.0155779123, 0.0157338772, 0.0153061887, 0.0305940583, 0.0422805585,
-        0.0481442027, 0.0506079458, 0.0632826835, 0.0536257587, 0.0654142275,
-        0.2776640952, 0.5607418418, 0.6365581751, 0.7153202891, 0.7836985588,
-        0.7968031168, 0.7675200701, 0.7478401661
-    ],
-    [
-        0.0003338935, 0.0003127191, 0.0002939025, 0.0003474290, 0.0003262436,
-        0.0003248494, 0.0003145408, 0.0174969025, 0.0095715802, 0.0203317460,
-        0.0049525513, 0.0013927124, 0.0012739704, 0.0012743619, 0.0036386077,
-        0.0063386802, 0.0071843667, 0.0085231178, 0.0086914431, 0.0088244071,
-        0.0627756938, 0.0515320897, 0.0563628823, 0.0569374561, 0.2363358438,
-        0.2527658641, 0.5348797441, 0.6478666067, 0.7645668983, 0.8918096423,
-        0.9496920705, 0.9177178741, 0.8825222850
-    ],
-    [
-        0.0003244534, 0.0002936466, 0.0002484542, 0.0002785883, 0.0002400183,
-        0.0002754721, 0.0004714182, 0.0503162853, 0.0444399714, 0.0301748589,
-        0.0091205947, 0.0045412094, 0.0054578171, 0.0042049992, 0.0051306058,
-        0.0082119545, 0.0072087939, 0.0076987068, 0.0085160965, 0.0206623320,
-        0.0131945750, 0.0171291549, 0.0254772194, 0.0153977983, 0.0705980361,
-        0.2891503572, 0.6672619581, 0.7209544778, 0.8111600876, 0.8760944605,
-        0.9592394829, 0.8950446844, 0.9184275270
-    ],
-    [
-        0.0002249825, 0.0002379407, 0.0002427724, 0.0002315427, 0.0002459461,
-        0.0004087361, 0.0002417250, 0.0095129376, 0.0100271683, 0.0080647608,
-        0.0067848018, 0.0013141471, 0.0011140251, 0.0031993059, 0.0034375188,
-        0.0066446830, 0.0071451431, 0.0066825412, 0.0078108306, 0.0111812688,
-        0.0118683344, 0.0177464373, 0.0169077329, 0.0356044658, 0.0707476214,
-        0.3085572720, 0.6349703670, 0.7575919628, 0.8718566895, 0.9102668762,
-        0.9231269956, 0.9517008662, 0.9346997142
-    ],
-    [
-        0.0003098285, 0.0003296850, 0.0003099778, 0.0002954259, 0.0002869298,
-        0.0003210013, 0.0003163124, 0.0069303163, 0.0148404958, 0.0082140174,
-        0.0031188512, 0.0014285550, 0.0010664364, 0.0012784016, 0.0058508618,
-        0.0122295544, 0.0090945745, 0.0099236788, 0.0103202825, 0.0135219265,
-        0.0767658651, 0.0692240298, 0.1492986977, 0.0544546172, 0.0601935238,
-        0.2950032353, 0.6480782628, 0.7737479806, 0.9417963028, 0.8565579653,
-        0.9210691452, 0.9422829151, 0.9001762271
-    ],
-    [
-        0.0002525520, 0.0002894212, 0.0002737927, 0.0002993492, 0.0003215074,
-        0.0003814063, 0.0002984119, 0.0063761054, 0.0083633885, 0.0075696437,
-        0.0035279319, 0.0012570613, 0.0010719331, 0.0028603880, 0.0060466779,
-        0.0118053509, 0.0122507904, 0.0127773322, 0.0123024518, 0.0427294821,
-        0.1616847217, 0.0395129174, 0.0581647418, 0.0649507195, 0.0610633120,
-        0.3290790319, 0.6567012072, 0.7403492928, 0.8102782965, 0.8763493299,
-        0.8419724107, 0.9119759202, 0.8304042816
-    ],
-    [
-        0.0003192019, 0.0002762630, 0.0003097722, 0.0003316886, 0.0002914275,
-        0.0003015936, 0.0002950841, 0.0115081761, 0.0140318125, 0.0112072928,
-        0.0063430155, 0.0021927897, 0.0026129102, 0.0018469419, 0.0051494408,
-        0.0097793834, 0.0098017007, 0.0122089069, 0.0120207546, 0.0490711816,
-        0.0477680080, 0.0940173194, 0.0596682318, 0.1966329515, 0.0560150407,
-        0.3121500015, 0.5820990801, 0.7146042585, 0.7690748572, 0.8525295258,
-        0.8434151411, 0.8079043031, 0.8526373506
-    ],
-    [
-        0.0002757258, 0.0002899146, 0.0003070752, 0.0002637777, 0.0002921667,
-        0.0002559046, 0.0003045930, 0.0106418477, 0.0086324709, 0.0145986723,
-        0.0015131959, 0.0014489469, 0.0043354318, 0.0024287230, 0.0045478600,
-        0.0090533989, 0.0127013745, 0.0119473040, 0.0127238138, 0.0352130756,
-        0.0518321767, 0.0643614158, 0.0640928149, 0.0711506233, 0.0459609404,
-        0.2837982774, 0.6692241430, 0.7340474129, 0.8526480794, 0.9172404408,
-        0.8732880950, 0.8058629632, 0.8937624097
-    ],
-    [
-        0.0002867885, 0.0002840606, 0.0002346307, 0.0003107949, 0.0002771528,
-        0.0003423329, 0.0003544189, 0.0026974818, 0.0086505366, 0.0075599332,
-        0.0056931493, 0.0012065645, 0.0013114483, 0.0012926038, 0.0047399187,
-        0.0090093566, 0.0100853015, 0.0118267434, 0.0269101746, 0.0458203629,
-        0.0555990152, 0.0587994456, 0.0714051723, 0.0428129882, 0.0690385252,
-        0.2992933989, 0.6943101883, 0.7962158322, 0.8648512959, 0.9199252129,
-        0.9489496350, 0.9114101529, 0.8821952343
-    ],
-    [
-        0.0003125456, 0.0002770977, 0.0003019348, 0.0002474909, 0.0003163057,
-        0.0002678807, 0.0003212228, 0.0028796508, 0.0104014296, 0.0075620338,
-        0.0036123996, 0.0024092461, 0.0011757150, 0.0013225193, 0.0055298880,
-        0.0123275248, 0.0126086725, 0.0118668089, 0.0121038891, 0.0626062900,
-        0.0446428061, 0.0527700745, 0.0708035082, 0.0507233217, 0.0495953187,
-        0.3488887846, 0.6270774007, 0.7280470729, 0.9107071161, 0.8174842596,
-        0.9640243649, 0.9014027119, 0.8963814974
-    ],
-    [
-        0.0003391679, 0.0003197574, 0.0002794614, 0.0002980294, 0.0003136650,
-        0.0002612078, 0.0003182291, 0.0037530588, 0.0102366917, 0.0112092393,
-        0.0024992221, 0.0012233838, 0.0012236042, 0.0013516017, 0.0050817505,
-        0.0091658132, 0.0113466522, 0.0122148581, 0.0129204690, 0.0555229746,
-        0.0503199808, 0.0516630821, 0.0507695079, 0.0723272637, 0.0672696307,
-        0.3389416933, 0.6878621578, 0.8058536053, 0.8462762237, 0.9302967191,
-        0.9061358571, 0.8812256455, 0.9089610577
-    ],
-    [
-        0.0003279084, 0.0003216356, 0.0002815190, 0.0003173519, 0.0002747978,
-        0.0002917529, 0.0002640855, 0.0030843711, 0.0080369478, 0.0081783859,
-        0.0045309677, 0.0025445451, 0.0036149598, 0.0027107571, 0.0057046395,
-        0.0115795089, 0.0125651471, 0.0154641643, 0.0148394220, 0.0447901599,
-        0.0525714196, 0.0481256582, 0.0499440581, 0.0546537936, 0.0583770499,
-        0.3250369132, 0.6430063248, 0.7370098829, 0.8421826959, 0.8895857334,
-        0.8851205707, 0.8721601367, 0.8879996538
-    ],
-    [
-        0.0003250765, 0.0003223594, 0.0002826209, 0.0002951270, 0.0003090511,
-        0.0003359374, 0.0003133851, 0.0103483628, 0.0081410902, 0.0090414975,
-        0.0032624332, 0.0011255371, 0.0010849365, 0.0015431143, 0.0058245622,
-        0.0119969025, 0.0125658587, 0.0111084729, 0.0132796858, 0.0477353781,
-        0.0479997769, 0.0592313893, 0.0544172637, 0.0578019693, 0.0600010604,
-        0.2822490036, 0.6034147143, 0.7050653100, 0.8119108081, 0.8361408710,
-        0.8841407895, 0.8496641517, 0.8512833714
-    ],
-    [
-        0.0003388826, 0.0002810125, 0.0002959047, 0.0003217227, 0.0003038934,
-        0.0003123172, 0.0003316195, 0.0078161079, 0.0308511145, 0.0077159833,
-        0.0032204653, 0.0011962865, 0.0011175540, 0.0020352451, 0.0059198481,
-        0.0099899881, 0.0097836545, 0.0116193099, 0.0367714539, 0.0509226806,
-        0.0959690139, 0.1048553661, 0.0534167737, 0.0605590269, 0.0603723973,
-        0.3113039136, 0.6264143586, 0.7737535238, 0.8941500187, 0.8888264894,
-        0.8927363157, 0.9029220343, 0.8797065616
-    ],
-])
-fourth_tbballocs = np.array([
-    [
-        0.0003817847, 0.0003873981, 0.0004025129, 0.0004003150, 0.0004119062,
-        0.0004584120, 0.0003742038, 0.0004104811, 0.0004849036, 0.0005534019,
-        0.0007420043, 0.0012169477, 0.0025770171, 0.0034919239, 0.0033782134,
-        0.0035771183, 0.0035224364, 0.0044247247, 0.0268268120, 0.0176594574,
-        0.0875903666, 0.2641592324, 0.2415100932, 0.0519445278, 0.0561500490,
-        0.7977513075, 1.1542264223, 1.1830720901, 1.4444888830, 1.7181986570,
-        1.6556987762, 1.7912877798, 1.7788380384
-    ],
-    [
-        0.0003694094, 0.0003655982, 0.0003536318, 0.0003953639, 0.0004078957,
-        0.0004265287, 0.0004227214, 0.0004286165, 0.0004481513, 0.0005093939,
-        0.0014419886, 0.0012986476, 0.0025891806, 0.0058956342, 0.0043906192,
-        0.0081308801, 0.0087558413, 0.0065656980, 0.0052902382, 0.0205264688,
-        0.1051500589, 0.2819133103, 0.2413369417, 0.0753745437, 0.0687073991,
-        0.7943726778, 1.1210446358, 1.2341943979, 1.5180014372, 1.7210232019,
-        1.7745712996, 1.8356431723, 1.8002262115
-    ],
-    [
-        0.0003437682, 0.0003844217, 0.0004274303, 0.0004567521, 0.0004051252,
-        0.0004539370, 0.0004720880, 0.0004430438, 0.0005075581, 0.0005423013,
-        0.0007260442, 0.0011187228, 0.0026296359, 0.0044373386, 0.0042510349,
-        0.0036641657, 0.0039459267, 0.0056924033, 0.0051838653, 0.0238944162,
-        0.0989217460, 0.2807476521, 0.2339876592, 0.0542745478, 0.0501322746,
-        0.8056341410, 1.1119360924, 1.2249565125, 1.4935413599, 1.7302548885,
-        1.8021733761, 1.7690607309, 1.7913113832
-    ],
-    [
-        0.0003775128, 0.0003886671, 0.0004336199, 0.0004167426, 0.0004417075,
-        0.0004542895, 0.0004551102, 0.0004536739, 0.0004804385, 0.0004899061,
-        0.0007835925, 0.0012131508, 0.0027146505, 0.0035806410, 0.0031554152,
-        0.0037358901, 0.0040905788, 0.0057027428, 0.0070983539, 0.0128312744,
-        0.0963124037, 0.2531581521, 0.2660481632, 0.0508767031, 0.0552656949,
-        0.8123396635, 1.1432609558, 1.2323293686, 1.4616450071, 1.5747640133,
-        1.4365490675, 1.4057492018, 1.5006526709
-    ],
-    [
-        0.0003072773, 0.0004645199, 0.0003096642, 0.0003635920, 0.0003622127,
-        0.0003837895, 0.0003607634, 0.0003567402, 0.0003924847, 0.0004922355,
-        0.0010187494, 0.0029410627, 0.0201125536, 0.0038806612, 0.0034045910,
-        0.0037282626, 0.0188368820, 0.0102584856, 0.0146595659, 0.0515798107,
-        0.1011328697, 0.2986877263, 0.2812540531, 0.1060476601, 0.0789528266,
-        0.7650988698, 1.1657956839, 1.1378751993, 1.5081338882, 1.5575356483,
-        1.7449376583, 1.7724417448, 1.7172474861
-    ],
-    [
-        0.0002970824, 0.0003140405, 0.0003351541, 0.0003341901, 0.0003617109,
-        0.0003546269, 0.0003762908, 0.0003841758, 0.0004787867, 0.0005292356,
-        0.0006731957, 0.0015249611, 0.0024542750, 0.0034497282, 0.0053071366,
-        0.0035337182, 0.0046295370, 0.0041086390, 0.0054620262, 0.0191663075,
-        0.1035605669, 0.2607015967, 0.2081729025, 0.0648523048, 0.0635854080,
-        0.7816598415, 1.1023286581, 1.2679468393, 1.5094469786, 1.7388712168,
-        1.6440259218, 1.8029404879, 1.5897917747
-    ],
-    [
-        0.0003218290, 0.0003687644, 0.0003401507, 0.0003840296, 0.0003841917,
-        0.0004270246, 0.0004000498, 0.0004415734, 0.0004767489, 0.0004974470,
-        0.0007007550, 0.0020527877, 0.0026451477, 0.0035598089, 0.0038872871,
-        0.0034845634, 0.0106218783, 0.0050549265, 0.0071075163, 0.0237462576,
-        0.0688435659, 0.2737240791, 0.2566078305, 0.0484254919, 0.0544424206,
-        0.8073237538, 1.1471858025, 1.2623256445, 1.5106259584, 1.7683217525,
-        1.8077311516, 1.8047440052, 1.7471861839
-    ],
-    [
-        0.0003495332, 0.0003295844, 0.0004110198, 0.0004261675, 0.0003705820,
-        0.0004211442, 0.0004641862, 0.0004228651, 0.0004637914, 0.0004835922,
-        0.0007173180, 0.0009810614, 0.0029309459, 0.0047472557, 0.0035995161,
-        0.0034848230, 0.0040088873, 0.0120041976, 0.0071938979, 0.0179610979,
-        0.1078008413, 0.2818286121, 0.2273567617, 0.0921234488, 0.0751866996,
-        0.8315697908, 1.1456940174, 1.2266048193, 1.4921827316, 1.7777037621,
-        1.7851799726, 1.7910964489, 1.7801120281
-    ],
-    [
-        0.0003552744, 0.0003304381, 0.0003414670, 0.0010959078, 0.0003751772,
-        0.0004049565, 0.0004342987, 0.0004249092, 0.0004273390, 0.0005043268,
-        0.0007114316, 0.0029272062, 0.0031216783, 0.0036740368, 0.0035159329,
-        0.0034679840, 0.0039821384, 0.0048372392, 0.0067414218, 0.0145303896,
-        0.0786735192, 0.2025265992, 0.2498084754, 0.0556048676, 0.0561154559,
-        0.7982368469, 1.1493961811, 1.2599896193, 1.5284298658, 1.7607650757,
-        1.7680510283, 1.7642998695, 1.5311672688
-    ],
-    [
-        0.0003327653, 0.0003540871, 0.0003726333, 0.0003485575, 0.0003911425,
-        0.0004908587, 0.0003833700, 0.0005475626, 0.0004252825, 0.0005461566,
-        0.0009675397, 0.0013692121, 0.0027083992, 0.0036379315, 0.0034824170,
-        0.0039455672, 0.0039342502, 0.0070799049, 0.0085137896, 0.0178938434,
-        0.1049364954, 0.2317941040, 0.2194935977, 0.0654876009, 0.0486062020,
-        0.8116694689, 1.1915097237, 1.2253744602, 1.3296382427, 1.6850733757,
-        1.7425320148, 1.7439028025, 1.7034450769
-    ],
-    [
-        0.0003398825, 0.0003764339, 0.0004006853, 0.0003662846, 0.0006454930,
-        0.0004314125, 0.0004655105, 0.0004858481, 0.0004571110, 0.0005372995,
-        0.0007455219, 0.0020420889, 0.0026744034, 0.0038994581, 0.0035462505,
-        0.0044818916, 0.0038158139, 0.0048831319, 0.0058925292, 0.0177109614,
-        0.1107434407, 0.2521002889, 0.2143645138, 0.0504481308, 0.0805330202,
-        0.8108428121, 1.0321118832, 1.1966649294, 1.5360207558, 1.6578667164,
-        1.7548853159, 1.7393714190, 1.6990723610
-    ],
-    [
-        0.0003607571, 0.0003919383, 0.0003722024, 0.0003872513, 0.0003914954,
-        0.0003917386, 0.0004132344, 0.0004221620, 0.0004406981, 0.0005841163,
-        0.0007360821, 0.0020794852, 0.0027512591, 0.0033788905, 0.0037782742,
-        0.0034289150, 0.0040680114, 0.0046232110, 0.0123794163, 0.0231425837,
-        0.0920355991, 0.2843582630, 0.2280158401, 0.0786538199, 0.0571449436,
-        0.8178033829, 1.1127433777, 1.1455293894, 1.5632454157, 1.5652173758,
-        1.5742408037, 1.5843522549, 1.7031080723
-    ],
-    [
-        0.0003536881, 0.0003591075, 0.0003596970, 0.0004916874, 0.0003986546,
-        0.0004430605, 0.0004076174, 0.0004070922, 0.0004737495, 0.0004917253,
-        0.0007012542, 0.0017616013, 0.0076510943, 0.0035607170, 0.0049452297,
-        0.0050593023, 0.0055375909, 0.0061152596, 0.0098980442, 0.0284878667,
-        0.0828391686, 0.2730488181, 0.2277735621, 0.0763178840, 0.0957767591,
-        0.7693406940, 1.1459145546, 1.2480044365, 1.4871422052, 1.6458688974,
-        1.7665877342, 1.8110114336, 1.7764256001
-    ],
-    [
-        0.0003430122, 0.0003498629, 0.0003735746, 0.0003883155, 0.0004042323,
-        0.0004450565, 0.0003701627, 0.0004502568, 0.0004337224, 0.0005149845,
-        0.0012975112, 0.0011983787, 0.0026532819, 0.0044060233, 0.0053163604,
-        0.0032821689, 0.0037999139, 0.0047029811, 0.0063367034, 0.0140367076,
-        0.0946692452, 0.2538424432, 0.2380543053, 0.0578349233, 0.0803566948,
-        0.7946811914, 1.1654491425, 1.2434358597, 1.4713866711, 1.7317904234,
-        1.8118011951, 1.7472952604, 1.7771928310
-    ],
-    [
-        0.0003534558, 0.0003479189, 0.0003916842, 0.0004083553, 0.0003794213,
-        0.0004510162, 0.0004490145, 0.0004643752, 0.0004822463, 0.0005574043,
-        0.0007086942, 0.0011363637, 0.0025088692, 0.0045930236, 0.0042100423,
-        0.0037146490, 0.0037164122, 0.0057406398, 0.0070894985, 0.0165176336,
-        0.1285812557, 0.2311576903, 0.2676931322, 0.0583788939, 0.0529598929,
-        0.8272019625, 1.1507313251, 1.2202783823, 1.4740734100, 1.7428191900,
-        1.7037523985, 1.6889144182, 1.6868494749
-    ],
-    [
-        0.0003682653, 0.0003715058, 0.0003416449, 0.0003922008, 0.0004080753,
-        0.0004158908, 0.0003749106, 0.0004891368, 0.0004264748, 0.0005629727,
-        0.0007235384, 0.0032909021, 0.0055185743, 0.0044959113, 0.0037803820,
-        0.0037537389, 0.0041979658, 0.0042533465, 0.0078301067, 0.0186672006,
-        0.1018111184, 0.2638276815, 0.2377711236, 0.0764174163, 0.0800004080,
-        0.8444930315, 1.1423043013, 1.2833042145, 1.5309567451, 1.7347232103,
-        1.7175054550, 1.7567433119, 1.8341672421
-    ],
-])
-fourth_tbbfrees = np.array([
-    [
-        0.0003255667, 0.0003307302, 0.0003339305, 0.0003482061, 0.0003565376,
-        0.0003663774, 0.0002964328, 0.0003790925, 0.0005141630, 0.0009586105,
-        0.0018069113, 0.0026872074, 0.0011914351, 0.0008700273, 0.0010444624,
-        0.0012567921, 0.0014310189, 0.0019824444, 0.0038266163, 0.0040905164,
-        0.0071331831, 0.0075827017, 0.0055574947, 0.0069208089, 0.0061566555,
-        0.2216457427, 0.3011562526, 0.2974092364, 0.2592630386, 0.1954532117,
-        0.2253026813, 0.2084544003, 0.2286701947
-    ],
-    [
-        0.0003130164, 0.0003095554, 0.0002802172, 0.0003410343, 0.0003571356,
-        0.0003442609, 0.0003464145, 0.0003548702, 0.0004967743, 0.0009115528,
-        0.0017969684, 0.0027992516, 0.0011317173, 0.0008963029, 0.0009939444,
-        0.0012204571, 0.0016672695, 0.0018460422, 0.0019606892, 0.0054742582,
-        0.0076480750, 0.0129711386, 0.0055346442, 0.0069096899, 0.0088934088,
-        0.2219295353, 0.2874265909, 0.2963199914, 0.2368494719, 0.1926651895,
-        0.1949928403, 0.1875392348, 0.1935355663
-    ],
-    [
-        0.0002901108, 0.0003299744, 0.0003578068, 0.0003988818, 0.0003518994,
-        0.0003699907, 0.0003788164, 0.0003948193, 0.0005548053, 0.0010133573,
-        0.0017831053, 0.0024225062, 0.0011511206, 0.0010141479, 0.0010710800,
-        0.0012800952, 0.0016792822, 0.0018865858, 0.0024904909, 0.0058778622,
-        0.0063104490, 0.0106771179, 0.0057745758, 0.0075730169, 0.0085315146,
-        0.2310432494, 0.2904555202, 0.2999377549, 0.2442349941, 0.1913102567,
-        0.1932777613, 0.1958391964, 0.1979028434
-    ],
-    [
-        0.0003173700, 0.0003313444, 0.0003650077, 0.0003590076, 0.0003855023,
-        0.0003702453, 0.0003656830, 0.0004088028, 0.0005115820, 0.0008747732,
-        0.0022637551, 0.0021637231, 0.0011873867, 0.0009466144, 0.0008930087,
-        0.0013190506, 0.0017111968, 0.0018406062, 0.0025256674, 0.0051877373,
-        0.0088103022, 0.0133234579, 0.0069219535, 0.0050259754, 0.0058043525,
-        0.2307555079, 0.2868098617, 0.2909940779, 0.2834617794, 0.2938378751,
-        0.4182410240, 0.4332219362, 0.4244127274
-    ],
-    [
-        0.0002455787, 0.0003116255, 0.0002369288, 0.0003063176, 0.0002762914,
-        0.0002966627, 0.0002603671, 0.0004055264, 0.0004919316, 0.0011029342,
-        0.0019146636, 0.0046237819, 0.0011584731, 0.0007916631, 0.0009508115,
-        0.0012746823, 0.0014658205, 0.0020094698, 0.0032386759, 0.0059807408,
-        0.0065319412, 0.0101406807, 0.0058642882, 0.0109757585, 0.0061118598,
-        0.2258266658, 0.3154549301, 0.3281862736, 0.2491983324, 0.3237692714,
-        0.2461667657, 0.2745074630, 0.3305480480
-    ],
-    [
-        0.0002232901, 0.0002532406, 0.0002707809, 0.0002963972, 0.0003055338,
-        0.0002676334, 0.0003026153, 0.0003603355, 0.0005313773, 0.0008777186,
-        0.0017804347, 0.0028675888, 0.0011612260, 0.0008127298, 0.0012721107,
-        0.0011862697, 0.0016081901, 0.0017441263, 0.0020305424, 0.0051510148,
-        0.0086322725, 0.0105137788, 0.0058499230, 0.0089224605, 0.0066423244,
-        0.2261257917, 0.2902139127, 0.3135038912, 0.2715649605, 0.2400184125,
-        0.3126607537, 0.2342503071, 0.3548693359
-    ],
-    [
-        0.0002551118, 0.0003076440, 0.0002713882, 0.0003240116, 0.0003306092,
-        0.0003375751, 0.0003228402, 0.0004062265, 0.0005082129, 0.0009132365,
-        0.0018093031, 0.0029171966, 0.0013490024, 0.0008682650, 0.0009872044,
-        0.0011812027, 0.0021905757, 0.0021955261, 0.0022180525, 0.0042685689,
-        0.0091292690, 0.0112720011, 0.0058698393, 0.0048221308, 0.0050967191,
-        0.2304081619, 0.3053676188, 0.3218249381, 0.2513492107, 0.2182005942,
-        0.2388406992, 0.2567665577, 0.2594052851
-    ],
-    [
-        0.0003006427, 0.0002700422, 0.0003392853, 0.0003660084, 0.0003147983,
-        0.0003356500, 0.0003611697, 0.0003945047, 0.0004925899, 0.0010292430,
-        0.0017615957, 0.0028798748, 0.0012329333, 0.0008521646, 0.0009395143,
-        0.0014223171, 0.0016261176, 0.0018051087, 0.0026739337, 0.0040699379,
-        0.0076024570, 0.0108649498, 0.0076505430, 0.0107002174, 0.0057224343,
-        0.2341589183, 0.3155446649, 0.3199584782, 0.2914049327, 0.2264061719,
-        0.2192282975, 0.2233360410, 0.2332997173
-    ],
-    [
-        0.0002937715, 0.0002617367, 0.0003106659, 0.0003066404, 0.0003194330,
-        0.0003181569, 0.0003439155, 0.0003895414, 0.0004481230, 0.0009573609,
-        0.0020028772, 0.0034597078, 0.0014373799, 0.0008780704, 0.0009883944,
-        0.0012383339, 0.0016458784, 0.0019987784, 0.0022552453, 0.0043256157,
-        0.0060120812, 0.0107336491, 0.0064459755, 0.0074527264, 0.0068847034,
-        0.2212288231, 0.3064253330, 0.2955356240, 0.2577437758, 0.2212707102,
-        0.2129687667, 0.2631704211, 0.3647528589
-    ],
-    [
-        0.0002763611, 0.0002705222, 0.0003146390, 0.0002926906, 0.0003379981,
-        0.0003211848, 0.0003099765, 0.0004551158, 0.0005166332, 0.0010370559,
-        0.0018569565, 0.0028057252, 0.0011640975, 0.0008486353, 0.0010022145,
-        0.0012524157, 0.0016954744, 0.0020408113, 0.0021679166, 0.0050956882,
-        0.0093623297, 0.0078502381, 0.0043299682, 0.0067236908, 0.0059439703,
-        0.2275593877, 0.2879497111, 0.3205683231, 0.3191599250, 0.2471989691,
-        0.2494448125, 0.2283666730, 0.3076026738
-    ],
-    [
-        0.0003053216, 0.0002766470, 0.0002583572, 0.0003234096, 0.0003589845,
-        0.0003342541, 0.0003320302, 0.0004403092, 0.0004985713, 0.0009929365,
-        0.0018467533, 0.0028754810, 0.0011755208, 0.0009536488, 0.0010114332,
-        0.0011918859, 0.0014836234, 0.0020052823, 0.0023616534, 0.0050250324,
-        0.0061215507, 0.0089218365, 0.0059993309, 0.0070022293, 0.0073898216,
-        0.2330908179, 0.3122461736, 0.3227037489, 0.2690358460, 0.2977412045,
-        0.2562423944, 0.2675877213, 0.3599572182
-    ],
-    [
-        0.0002741299, 0.0003320310, 0.0003121220, 0.0003376774, 0.0003337382,
-        0.0003054796, 0.0003323273, 0.0003905602, 0.0005314805, 0.0010807859,
-        0.0019207111, 0.0024865933, 0.0011464012, 0.0008528886, 0.0011431333,
-        0.0011149271, 0.0015301909, 0.0019464507, 0.0025746478, 0.0041511036,
-        0.0062322565, 0.0124062244, 0.0069940346, 0.0096637197, 0.0065690386,
-        0.2284130007, 0.3195226490, 0.3133083284, 0.2733086348, 0.2979817986,
-        0.3506850004, 0.3707827926, 0.3203464150
-    ],
-    [
-        0.0002851662, 0.0002984484, 0.0002961132, 0.0003429614, 0.0003241920,
-        0.0003440063, 0.0003227879, 0.0003694174, 0.0005541384, 0.0009948418,
-        0.0018325208, 0.0035969303, 0.0011921478, 0.0008254049, 0.0009779772,
-        0.0012826313, 0.0015568959, 0.0019448242, 0.0023860740, 0.0052578440,
-        0.0059722215, 0.0100015448, 0.0052291458, 0.0069143651, 0.0092245452,
-        0.2205027193, 0.3060007393, 0.2991071045, 0.2517894804, 0.2596179843,
-        0.2216250002, 0.2231117189, 0.2544747889
-    ],
-    [
-        0.0002889906, 0.0002912431, 0.0006209115, 0.0003412168, 0.0003503253,
-        0.0003593245, 0.0003124579, 0.0004016776, 0.0004956138, 0.0010085886,
-        0.0018178384, 0.0024507027, 0.0012148049, 0.0008139809, 0.0009388462,
-        0.0011440869, 0.0015907439, 0.0018027517, 0.0021637147, 0.0052313586,
-        0.0052483506, 0.0092961248, 0.0057075033, 0.0070908200, 0.0079762908,
-        0.2267282307, 0.3011758626, 0.3047751784, 0.2585141361, 0.2195632905,
-        0.2224244922, 0.2267346978, 0.2448395342
-    ],
-    [
-        0.0002966424, 0.0002903377, 0.0003245941, 0.0003585079, 0.0003203985,
-        0.0003632480, 0.0003512675, 0.0004239746, 0.0005104661, 0.0009583440,
-        0.0019455068, 0.0023392180, 0.0011370261, 0.0008106550, 0.0010514440,
-        0.0012637981, 0.0015481026, 0.0018703009, 0.0020013580, 0.0044239047,
-        0.0117736151, 0.0081391763, 0.0069157225, 0.0055691814, 0.0059572319,
-        0.2228793651, 0.3023824990, 0.3047014773, 0.2584827542, 0.2515765429,
-        0.2586487234, 0.2688192725, 0.2934426665
-    ],
-    [
-        0.0003265589, 0.0003099004, 0.0002823950, 0.0003356865, 0.0003548189,
-        0.0003340382, 0.0003057350, 0.0004630588, 0.0004840405, 0.0010739412,
-        0.0018507466, 0.0034301728, 0.0013066691, 0.0009050812, 0.0011408735,
-        0.0012643290, 0.0016768638, 0.0019659351, 0.0022097586, 0.0040389751,
-        0.0100721978, 0.0121012703, 0.0065364661, 0.0080909617, 0.0073411069,
-        0.2326519042, 0.2996170223, 0.2973968685, 0.2610934377, 0.2276996076,
-        0.2240214199, 0.2384908944, 0.2178257853
-    ],
-])
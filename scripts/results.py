@@ -0,0 +1,116 @@
+"""Load the results files written by `main -r` or `main -o <file>`.
+
+    metadata, columns = results.load("results-20240101-120000.jsonl")
+    glibc = results.select(columns, test="lin-growth-direct-free", backend="glibc", threads=1)
+    plt.plot(glibc["size"], glibc["alloc_time_s"])
+
+Both formats give the same columns, one entry per test, thread count, size and backend.
+"""
+import json
+import struct
+
+import numpy as np
+
+MAGIC = b"ALLOCRES"
+
+# Type tags of the columnar format
+F64, I64, STRING = 0, 1, 2
+
+# Columns which hold integers in the JSON Lines format
+INTEGER_COLUMNS = ("threads", "size")
+
+
+def load(path):
+    """Return (metadata, columns), columns maps each name to a numpy array"""
+    with open(path, "rb") as f:
+        magic = f.read(len(MAGIC))
+
+    if magic == MAGIC:
+        return _load_columnar(path)
+    return _load_jsonl(path)
+
+
+def select(columns, **conditions):
+    """Rows of columns for which all given columns have the given values"""
+    mask = np.ones(len(next(iter(columns.values()))), dtype=bool)
+    for name, value in conditions.items():
+        mask &= columns[name] == value
+    return {name: values[mask] for name, values in columns.items()}
+
+
+def _load_jsonl(path):
+    metadata = {}
+    records = []
+
+    with open(path) as f:
+        for line in f:
+            record = json.loads(line)
+            if record.pop("type") == "run":
+                metadata = record
+            else:
+                records.append(record)
+
+    columns = {}
+    if not records:
+        return metadata, columns
+
+    for name, first in records[0].items():
+        values = [r[name] for r in records]
+        if isinstance(first, str):
+            columns[name] = np.array(values)
+        elif name in INTEGER_COLUMNS:
+            columns[name] = np.array(values, dtype=np.int64)
+        else:
+            # Values which weren't measured are null
+            columns[name] = np.array([np.nan if v is None else v for v in values], dtype=np.float64)
+    return metadata, columns
+
+
+def _load_columnar(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    offset = len(MAGIC)
+    version, num_columns, num_rows = struct.unpack_from("<IIQ", data, offset)
+    offset += 16
+    if version != 1:
+        raise ValueError(f"Unsupported results version {version}")
+
+    (length,) = struct.unpack_from("<I", data, offset)
+    offset += 4
+    metadata = json.loads(data[offset:offset + length])
+    metadata.pop("type")
+    offset += length
+
+    columns = {}
+    for _ in range(num_columns):
+        (length,) = struct.unpack_from("<H", data, offset)
+        offset += 2
+        name = data[offset:offset + length].decode()
+        offset += length
+
+        (kind,) = struct.unpack_from("<B", data, offset)
+        offset += 1
+
+        if kind in (F64, I64):
+            dtype = "<f8" if kind == F64 else "<i8"
+            columns[name] = np.frombuffer(data, dtype=dtype, count=num_rows, offset=offset)
+            offset += 8 * num_rows
+        elif kind == STRING:
+            (size,) = struct.unpack_from("<I", data, offset)
+            offset += 4
+
+            dictionary = []
+            for _ in range(size):
+                (length,) = struct.unpack_from("<H", data, offset)
+                offset += 2
+                dictionary.append(data[offset:offset + length].decode())
+                offset += length
+
+            index = np.frombuffer(data, dtype="<u4", count=num_rows, offset=offset)
+            offset += 4 * num_rows
+            columns[name] = np.array(dictionary)[index]
+        else:
+            raise ValueError(f"Unknown column type {kind} of column {name}")
+
+    return metadata, columns
@@ -0,0 +1,247 @@
+#include "arena.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+#include <sys/mman.h>
+
+struct Arena::Chunk {
+    Chunk*      next;
+    std::size_t size;
+};
+
+namespace
+{
+    /// Chunks shared by all arenas: spares nobody uses right now and chunks of exited threads,
+    /// which are only reclaimed at the next release(), as other threads may still use them
+    struct ChunkPool {
+        std::mutex    mutex;
+        Arena::Chunk* spare    = nullptr;
+        Arena::Chunk* orphaned = nullptr;
+
+        /// Bytes of all mapped chunks, and of those currently used by an arena
+        std::atomic<std::size_t> mapped{0};
+        std::atomic<std::size_t> in_use{0};
+    };
+
+    ChunkPool& chunk_pool()
+    {
+        static ChunkPool pool;
+        return pool;
+    }
+
+    Arena::Chunk* map_chunk(std::size_t size)
+    {
+        void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (memory == MAP_FAILED)
+            return nullptr;
+
+        chunk_pool().mapped.fetch_add(size, std::memory_order_relaxed);
+        return new (memory) Arena::Chunk{nullptr, size};
+    }
+
+    void unmap_chunk(Arena::Chunk* chunk)
+    {
+        chunk_pool().mapped.fetch_sub(chunk->size, std::memory_order_relaxed);
+        munmap(chunk, chunk->size);
+    }
+
+    /// Release a list of chunks which nobody uses any more, standard ones go to the spares
+    void recycle(Arena::Chunk* chunks, Arena::Chunk*& spare)
+    {
+        while (chunks) {
+            auto* next = chunks->next;
+            if (chunks->size == arena_chunk_size) {
+                chunks->next = spare;
+                spare        = chunks;
+            } else {
+                unmap_chunk(chunks);
+            }
+            chunks = next;
+        }
+    }
+
+    std::size_t align_up(std::size_t value, std::size_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+} // namespace
+
+Arena::~Arena()
+{
+    auto& pool = chunk_pool();
+
+    std::size_t used = 0;
+    for (auto* c = used_; c; c = c->next) {
+        used += c->size;
+    }
+    pool.in_use.fetch_sub(used, std::memory_order_relaxed);
+
+    // Blocks of this thread may still be in use by others, e.g. messages to a consumer
+    std::lock_guard lock(pool.mutex);
+    while (used_) {
+        auto* next    = used_->next;
+        used_->next   = pool.orphaned;
+        pool.orphaned = used_;
+        used_         = next;
+    }
+    recycle(spare_, pool.spare);
+}
+
+void* Arena::allocate(std::size_t size, std::size_t alignment)
+{
+    alignment = std::max<std::size_t>(alignment, 16);
+
+    // The size goes right in front of the block
+    auto block = reinterpret_cast<char*>(align_up(reinterpret_cast<std::uintptr_t>(top_) + sizeof(std::size_t), alignment));
+    if (!top_ || block + size > end_ || block + size < block) {
+        if (!next_chunk(size + alignment + sizeof(std::size_t)))
+            return nullptr;
+        block = reinterpret_cast<char*>(align_up(reinterpret_cast<std::uintptr_t>(top_) + sizeof(std::size_t), alignment));
+    }
+
+    std::memcpy(block - sizeof(std::size_t), &size, sizeof(size));
+    top_ = block + size;
+    return block;
+}
+
+void* Arena::allocate_zeroed(std::size_t size)
+{
+    void* block = allocate(size);
+    if (block && used_->size == arena_chunk_size) {
+        std::memset(block, 0, size);
+    }
+    return block;
+}
+
+void Arena::reset()
+{
+    std::size_t used = 0;
+    for (auto* c = used_; c; c = c->next) {
+        used += c->size;
+    }
+    chunk_pool().in_use.fetch_sub(used, std::memory_order_relaxed);
+
+    recycle(used_, spare_);
+    used_ = nullptr;
+    top_  = nullptr;
+    end_  = nullptr;
+}
+
+std::size_t Arena::block_size(const void* ptr)
+{
+    std::size_t size;
+    std::memcpy(&size, static_cast<const char*>(ptr) - sizeof(std::size_t), sizeof(size));
+    return size;
+}
+
+bool Arena::next_chunk(std::size_t size)
+{
+    auto& pool = chunk_pool();
+
+    const std::size_t needed = size + align_up(sizeof(Chunk), 16);
+    Chunk*            chunk  = nullptr;
+
+    if (needed <= arena_chunk_size) {
+        if (!spare_) {
+            std::lock_guard lock(pool.mutex);
+            if (pool.spare) {
+                spare_       = pool.spare;
+                pool.spare   = spare_->next;
+                spare_->next = nullptr;
+            }
+        }
+
+        if (spare_) {
+            chunk  = spare_;
+            spare_ = spare_->next;
+        } else {
+            chunk = map_chunk(arena_chunk_size);
+        }
+    } else {
+        chunk = map_chunk(align_up(needed, 4096));
+    }
+
+    if (!chunk)
+        return false;
+
+    pool.in_use.fetch_add(chunk->size, std::memory_order_relaxed);
+
+    chunk->next = used_;
+    used_       = chunk;
+    top_        = reinterpret_cast<char*>(chunk) + align_up(sizeof(Chunk), 16);
+    end_        = reinterpret_cast<char*>(chunk) + chunk->size;
+    return true;
+}
+
+namespace
+{
+    thread_local Arena thread_arena;
+
+    void* arena_malloc(std::size_t size)
+    {
+        return thread_arena.allocate(size);
+    }
+
+    void* arena_calloc(std::size_t count, std::size_t size)
+    {
+        if (size && count > SIZE_MAX / size)
+            return nullptr;
+
+        return thread_arena.allocate_zeroed(count * size);
+    }
+
+    void arena_free(void*)
+    {
+        // Released in bulk by arena_release()
+    }
+
+    void arena_free_sized(void*, std::size_t)
+    {
+    }
+
+    void* arena_realloc(void* ptr, std::size_t size)
+    {
+        void* block = thread_arena.allocate(size);
+        if (block && ptr) {
+            std::memcpy(block, ptr, std::min(size, Arena::block_size(ptr)));
+        }
+        return block;
+    }
+
+    void* arena_aligned_alloc(std::size_t alignment, std::size_t size)
+    {
+        return thread_arena.allocate(size, alignment);
+    }
+
+    void arena_release()
+    {
+        thread_arena.reset();
+
+        auto&           pool = chunk_pool();
+        std::lock_guard lock(pool.mutex);
+        recycle(pool.orphaned, pool.spare);
+        pool.orphaned = nullptr;
+    }
+
+    bool arena_heap_stats(HeapStats& stats)
+    {
+        // Only whole chunks are known, the bump pointers are private to their threads
+        stats.in_use = chunk_pool().in_use.load(std::memory_order_relaxed);
+        stats.mapped = chunk_pool().mapped.load(std::memory_order_relaxed);
+        return true;
+    }
+} // namespace
+
+Backend arena_backend()
+{
+    Backend backend{"arena", arena_malloc, arena_free, arena_realloc, arena_aligned_alloc, nullptr, nullptr, arena_heap_stats, "builtin"};
+    backend.release    = arena_release;
+    backend.calloc     = arena_calloc;
+    backend.free_sized = arena_free_sized;
+    return backend;
+}
@@ -0,0 +1,142 @@
+#include "backend.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include <gnu/libc-version.h>
+#include <malloc.h>
+
+#include <fmt/format.h>
+
+#include "tbb/scalable_allocator.h"
+
+#include "arena.h"
+#include "pool_allocator.h"
+
+// oneTBB moved the version macros out of tbb_stddef.h
+#if __has_include("tbb/version.h")
+#include "tbb/version.h"
+#else
+#include "tbb/tbb_stddef.h"
+#endif
+
+#ifdef HAVE_MIMALLOC
+#include <mimalloc.h>
+#endif
+
+namespace
+{
+    bool glibc_heap_stats(HeapStats& stats)
+    {
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 33)
+        const auto info = mallinfo2();
+#else
+        // The int fields of mallinfo wrap around above 2 GB
+        const auto info = mallinfo();
+#endif
+        // Chunks from mmap (hblkhd) aren't part of the arenas, so add them to both
+        stats.in_use = info.uordblks + info.hblkhd;
+        stats.mapped = info.arena + info.hblkhd;
+        return true;
+    }
+
+    void glibc_purge()
+    {
+        malloc_trim(0);
+    }
+
+    void* tbb_aligned_alloc(std::size_t alignment, std::size_t size)
+    {
+        // TBB takes the arguments the other way round
+        return scalable_aligned_malloc(size, alignment);
+    }
+
+    void tbb_thread_teardown()
+    {
+        // Release the thread local caches, this is what happens anyway once the thread exits
+        scalable_allocation_command(TBBMALLOC_CLEAN_THREAD_BUFFERS, nullptr);
+    }
+
+    void tbb_purge()
+    {
+        scalable_allocation_command(TBBMALLOC_CLEAN_ALL_BUFFERS, nullptr);
+    }
+
+#ifdef HAVE_MIMALLOC
+    void* mi_aligned_alloc_wrapper(std::size_t alignment, std::size_t size)
+    {
+        return mi_malloc_aligned(size, alignment);
+    }
+
+    bool mi_heap_stats(HeapStats& stats)
+    {
+        std::size_t elapsed, user, sys, rss, peak_rss, commit, peak_commit, faults;
+        mi_process_info(&elapsed, &user, &sys, &rss, &peak_rss, &commit, &peak_commit, &faults);
+
+        // mimalloc only knows how much it committed, not how much is in use
+        stats.in_use = commit;
+        stats.mapped = commit;
+        return true;
+    }
+
+    void mi_purge()
+    {
+        mi_collect(true);
+    }
+#endif
+
+    std::vector<Backend> builtin_backends()
+    {
+        std::vector<Backend> backends;
+
+        backends.push_back(
+            {"glibc", std::malloc, std::free, std::realloc, std::aligned_alloc, nullptr, nullptr, glibc_heap_stats, gnu_get_libc_version()});
+        backends.back().calloc = std::calloc;
+        backends.back().purge  = glibc_purge;
+
+        // TBB has no query for its heap size, and no sized free
+        backends.push_back({"tbb", scalable_malloc, scalable_free, scalable_realloc, tbb_aligned_alloc, nullptr, tbb_thread_teardown, nullptr,
+                            fmt::format("{}.{}", TBB_VERSION_MAJOR, TBB_VERSION_MINOR)});
+        backends.back().calloc = scalable_calloc;
+        backends.back().purge  = tbb_purge;
+
+#ifdef HAVE_MIMALLOC
+        backends.push_back({"mimalloc", mi_malloc, mi_free, mi_realloc, mi_aligned_alloc_wrapper, mi_thread_init, mi_thread_done,
+                            mi_heap_stats, fmt::format("{}", MI_MALLOC_VERSION)});
+        backends.back().calloc     = mi_calloc;
+        backends.back().free_sized = mi_free_size;
+        backends.back().purge      = mi_purge;
+#endif
+
+        backends.push_back(arena_backend());
+        backends.push_back(pool_backend());
+
+        return backends;
+    }
+} // namespace
+
+std::vector<Backend>& backend_registry()
+{
+    static std::vector<Backend> registry = builtin_backends();
+    return registry;
+}
+
+void register_backend(Backend backend)
+{
+    auto& registry = backend_registry();
+
+    auto it = std::find_if(registry.begin(), registry.end(), [&](const Backend& b) { return b.name == backend.name; });
+    if (it != registry.end()) {
+        *it = std::move(backend);
+    } else {
+        registry.push_back(std::move(backend));
+    }
+}
+
+const Backend* find_backend(std::string_view name)
+{
+    const auto& registry = backend_registry();
+
+    auto it = std::find_if(registry.begin(), registry.end(), [&](const Backend& b) { return b.name == name; });
+    return it != registry.end() ? &*it : nullptr;
+}
@@ -0,0 +1,216 @@
+#include "compare.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <set>
+#include <string_view>
+#include <tuple>
+
+#include <fmt/color.h>
+#include <fmt/format.h>
+
+#include "options.h"
+
+namespace
+{
+    /// A compared value of a record. Timed metrics have a median and a confidence interval from the
+    /// trials in the fields <field>_median_s, <field>_ci_low_s and <field>_ci_high_s, the others
+    /// are a single value in the field
+    struct Metric {
+        std::string_view name;
+        std::string_view field;
+        bool             timed            = false;
+        bool             higher_is_better = false;
+        /// Smallest value changes are relative to, so a footprint of almost nothing can't regress
+        /// by an arbitrary percentage
+        double floor = 0.0;
+    };
+
+    constexpr std::array<Metric, 8> compared_metrics{{
+        {"Alloc", "alloc", true},
+        {"Free", "free", true},
+        {"Total", "total", true},
+        {"Alloc p99", "alloc_p99_ns"},
+        {"Free p99", "free_p99_ns"},
+        {"Peak RSS", "peak_rss", false, false, megabyte},
+        {"Retained", "retained_rss", false, false, megabyte},
+        {"Allocs/s", "allocs_per_s", false, true},
+    }};
+
+    struct Change {
+        bool   compared    = false;
+        double relative    = 0.0;
+        bool   significant = false;
+        bool   regression  = false;
+    };
+
+    /// Relative change of the metric, positive is worse
+    Change compare_metric(const ResultRecord& baseline, const ResultRecord& current, const Metric& metric, double threshold)
+    {
+        const auto field = [&](const ResultRecord& r, std::string_view suffix) {
+            return r.field(metric.timed ? fmt::format("{}_{}", metric.field, suffix) : std::string(metric.field));
+        };
+
+        const double before = field(baseline, "median_s");
+        const double after  = field(current, "median_s");
+
+        Change change;
+        if (!std::isfinite(before) || !std::isfinite(after) || std::max(before, metric.floor) <= 0.0 || (metric.timed && !(after > 0.0)))
+            return change;
+
+        change.compared = true;
+        if (metric.higher_is_better) {
+            // Like a time, half the throughput is +100%
+            change.relative = after > 0.0 ? before / after - 1.0 : INFINITY;
+        } else {
+            change.relative = (after - before) / std::max(before, metric.floor);
+        }
+
+        // Without trials there's no interval, so the threshold alone decides
+        const bool intervals = metric.timed && field(baseline, "trials") > 1 && field(current, "trials") > 1;
+        if (intervals) {
+            change.significant = field(current, "ci_low_s") > field(baseline, "ci_high_s") || field(current, "ci_high_s") < field(baseline, "ci_low_s");
+        } else {
+            change.significant = std::abs(change.relative) > threshold;
+        }
+        change.regression = change.significant && change.relative > threshold;
+        return change;
+    }
+
+    void print_change(const Change& change)
+    {
+        // Worse is a positive change, so red
+        if (!change.compared) {
+            fmt::print(" {:^10} ", "-");
+        } else if (change.regression) {
+            fmt::print(fmt::emphasis::bold | fmt::fg(fmt::color::red), " {:>+9.2f}% ", change.relative * 100);
+        } else if (change.significant) {
+            fmt::print(fmt::fg(change.relative > 0 ? fmt::color::red : fmt::color::green), " {:>+9.2f}% ", change.relative * 100);
+        } else {
+            fmt::print(" {:>+9.2f}% ", change.relative * 100);
+        }
+        fmt::print("|");
+    }
+} // namespace
+
+CompareOutcome compare_results(const std::vector<ResultRecord>& baseline, const std::vector<ResultRecord>& current, double threshold)
+{
+    using Key = std::tuple<std::string, int, std::string, long>;
+
+    std::map<Key, const ResultRecord*> before;
+    for (const auto& r : baseline) {
+        before[{r.test, r.threads, r.backend, r.size}] = &r;
+    }
+
+    // Group the current records by test and thread count, keeping the order they ran in
+    std::vector<std::pair<std::string, int>> runs;
+    for (const auto& r : current) {
+        if (std::find(runs.begin(), runs.end(), std::pair{r.test, r.threads}) == runs.end()) {
+            runs.emplace_back(r.test, r.threads);
+        }
+    }
+
+    CompareOutcome outcome;
+    std::set<Key>  compared;
+
+    for (const auto& [test, threads] : runs) {
+        std::vector<std::string> backends;
+        std::vector<long>        sizes;
+        for (const auto& r : current) {
+            if (r.test != test || r.threads != threads)
+                continue;
+            if (std::find(backends.begin(), backends.end(), r.backend) == backends.end())
+                backends.push_back(r.backend);
+            if (std::find(sizes.begin(), sizes.end(), r.size) == sizes.end())
+                sizes.push_back(r.size);
+        }
+
+        fmt::print("\nChange against the baseline of {} with {} thread(s), positive is worse\n", test, threads);
+        fmt::print("|{:-^12}|", "");
+        for (const auto& b : backends) {
+            fmt::print("|{:-^{}}|", b, 13 * compared_metrics.size() - 1);
+        }
+        fmt::print("|\n");
+
+        fmt::print("|{:^12}|", "Size");
+        for (std::size_t i = 0; i < backends.size(); ++i) {
+            fmt::print("|");
+            for (const auto& metric : compared_metrics) {
+                fmt::print(" {:^10} |", metric.name);
+            }
+        }
+        fmt::print("|\n");
+
+        for (long size : sizes) {
+            fmt::print("| {:>10} |", size);
+
+            for (const auto& backend : backends) {
+                auto now = std::find_if(current.begin(), current.end(), [&](const ResultRecord& r) {
+                    return r.test == test && r.threads == threads && r.backend == backend && r.size == size;
+                });
+                auto then = before.find({test, threads, backend, size});
+
+                fmt::print("|");
+                if (now == current.end() || then == before.end()) {
+                    ++outcome.new_points;
+                    for (std::size_t i = 0; i < compared_metrics.size(); ++i) {
+                        fmt::print(" {:^10} |", "-");
+                    }
+                    continue;
+                }
+                compared.insert(then->first);
+
+                for (const auto& metric : compared_metrics) {
+                    const auto change = compare_metric(*then->second, *now, metric, threshold);
+                    outcome.regressions += change.regression;
+                    print_change(change);
+                }
+            }
+            fmt::print("|\n");
+        }
+    }
+
+    // A data point of the baseline which this run didn't produce can't be checked at all
+    for (const auto& [key, record] : before) {
+        if (!compared.count(key)) {
+            ++outcome.missing;
+        }
+    }
+
+    fmt::print("\n{} regression(s) beyond {:.1f}%", outcome.regressions, threshold * 100);
+    if (outcome.missing) {
+        fmt::print(", {} data point(s) of the baseline missing from this run", outcome.missing);
+    }
+    if (outcome.new_points) {
+        fmt::print(", {} data point(s) not in the baseline", outcome.new_points);
+    }
+    fmt::print("\n");
+
+    return outcome;
+}
+
+std::vector<std::string> rerun_arguments(const std::vector<std::string>& command)
+{
+    // Options which take a value as the next argument
+    constexpr std::array<std::string_view, 5> with_value{"-o", "--output", "--format", "--compare-baseline", "--regression-threshold"};
+    constexpr std::array<std::string_view, 2> without_value{"-r", "--report"};
+
+    std::vector<std::string> args;
+    for (std::size_t i = 1; i < command.size(); ++i) {
+        const std::string_view arg = command[i];
+
+        const auto name = arg.substr(0, arg.find('='));
+        if (std::find(with_value.begin(), with_value.end(), name) != with_value.end()) {
+            // "--output=file" carries its value, "--output file" has it in the next argument
+            i += arg.find('=') == std::string_view::npos;
+            continue;
+        }
+        if (std::find(without_value.begin(), without_value.end(), name) != without_value.end()) {
+            continue;
+        }
+        args.emplace_back(arg);
+    }
+    return args;
+}
@@ -0,0 +1,344 @@
+#include "containers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <list>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+#include "op_stream.h"
+#include "options.h"
+#include "perf_counters.h"
+#include "print.h"
+#include "runner.h"
+#include "timer.h"
+#include "util.h"
+
+void* BackendResource::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    void* ptr = alignment <= alignof(std::max_align_t) || !backend_.aligned_alloc ? backend_.malloc(bytes)
+                                                                                  : backend_.aligned_alloc(alignment, bytes);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void BackendResource::do_deallocate(void* ptr, std::size_t, std::size_t)
+{
+    backend_.free(ptr);
+}
+
+namespace
+{
+    /// The resource of a contender for one trial
+    class ContenderResource
+    {
+    public:
+        ContenderResource(const Contender& contender) : base_(contender.backend)
+        {
+            switch (contender.kind) {
+            case ResourceKind::backend:
+                break;
+            case ResourceKind::monotonic:
+                monotonic_.emplace(&base_);
+                break;
+            case ResourceKind::unsynchronized_pool:
+                unsynchronized_.emplace(&base_);
+                break;
+            case ResourceKind::synchronized_pool:
+                synchronized_.emplace(&base_);
+                break;
+            }
+        }
+
+        std::pmr::memory_resource* get()
+        {
+            if (monotonic_)
+                return &*monotonic_;
+            if (unsynchronized_)
+                return &*unsynchronized_;
+            if (synchronized_)
+                return &*synchronized_;
+            return &base_;
+        }
+
+        /// Give everything back to the backend
+        void release()
+        {
+            if (monotonic_)
+                monotonic_->release();
+            if (unsynchronized_)
+                unsynchronized_->release();
+            if (synchronized_)
+                synchronized_->release();
+        }
+
+    private:
+        BackendResource                                    base_;
+        std::optional<std::pmr::monotonic_buffer_resource> monotonic_;
+        std::optional<std::pmr::unsynchronized_pool_resource> unsynchronized_;
+        std::optional<std::pmr::synchronized_pool_resource>   synchronized_;
+    };
+
+    /// Time the three phases of a container workload
+    template <typename Build, typename Walk, typename Destroy>
+    BackendStats measure(Build&& build, Walk&& walk, Destroy&& destroy)
+    {
+        BackendStats result;
+
+        phase_begin(Phase::alloc);
+        auto build_start = timer_start();
+        build();
+        auto build_end = timer_stop();
+        phase_end(Phase::alloc);
+        result.alloc_elapsed = timer_elapsed(build_start, build_end);
+
+        auto walk_start = timer_start();
+        walk();
+        auto walk_end = timer_stop();
+        result.touch_elapsed = timer_elapsed(walk_start, walk_end);
+
+        phase_begin(Phase::free);
+        auto destroy_start = timer_start();
+        destroy();
+        auto destroy_end = timer_stop();
+        phase_end(Phase::free);
+        result.free_elapsed = timer_elapsed(destroy_start, destroy_end);
+
+        return result;
+    }
+
+    BackendStats map_churn(ContenderResource& resource, long n, std::mt19937_64& gen)
+    {
+        // Twice as many keys, the second half replaces erased ones
+        std::vector<std::uint64_t> keys(2 * n);
+        std::generate(keys.begin(), keys.end(), gen);
+
+        std::vector<long> erase_order(n);
+        std::iota(erase_order.begin(), erase_order.end(), 0);
+        std::shuffle(erase_order.begin(), erase_order.end(), gen);
+
+        std::optional<std::pmr::unordered_map<std::uint64_t, std::uint64_t>> map;
+        std::uint64_t                                                        sum = 0;
+
+        return measure(
+            [&] {
+                map.emplace(resource.get());
+                for (long i = 0; i < n; ++i) {
+                    map->emplace(keys[i], i);
+                }
+                for (long i = 0; i < n / 2; ++i) {
+                    map->erase(keys[erase_order[i]]);
+                    map->emplace(keys[n + i], i);
+                }
+            },
+            [&] {
+                for (const auto& [key, value] : *map) {
+                    sum += value;
+                }
+                escape(&sum);
+            },
+            [&] {
+                map.reset();
+                resource.release();
+            });
+    }
+
+    BackendStats vector_growth(ContenderResource& resource, long n, std::mt19937_64&)
+    {
+        // The vectors grow in turns, so their reallocations interleave
+        constexpr long vectors = 16;
+
+        std::optional<std::pmr::vector<std::pmr::vector<std::uint64_t>>> outer;
+        std::uint64_t                                                    sum = 0;
+
+        return measure(
+            [&] {
+                outer.emplace(vectors, resource.get());
+                for (long i = 0; i < n; ++i) {
+                    (*outer)[i % vectors].push_back(i);
+                }
+            },
+            [&] {
+                for (const auto& inner : *outer) {
+                    sum = std::accumulate(inner.begin(), inner.end(), sum);
+                }
+                escape(&sum);
+            },
+            [&] {
+                outer.reset();
+                resource.release();
+            });
+    }
+
+    BackendStats list_splice(ContenderResource& resource, long n, std::mt19937_64& gen)
+    {
+        // Steps between the nodes of the second list in the first one
+        std::vector<int> steps(n / 2);
+        std::uniform_int_distribution<int> step_dist(0, 3);
+        std::generate(steps.begin(), steps.end(), [&] { return step_dist(gen); });
+
+        std::optional<std::pmr::list<std::uint64_t>> a, b;
+        std::uint64_t                                sum = 0;
+
+        return measure(
+            [&] {
+                a.emplace(resource.get());
+                b.emplace(resource.get());
+                for (long i = 0; i < n; ++i) {
+                    (i % 2 ? *a : *b).push_back(i);
+                }
+
+                // Scatter the nodes of b over a, which takes no allocations but leaves a in an
+                // order which has little to do with the order of the allocations
+                auto position = a->begin();
+                for (long i = 0; !b->empty(); ++i) {
+                    for (int s = 0; s < steps[i] && position != a->end(); ++s) {
+                        ++position;
+                    }
+                    a->splice(position, *b, b->begin());
+                }
+            },
+            [&] {
+                sum = std::accumulate(a->begin(), a->end(), sum);
+                escape(&sum);
+            },
+            [&] {
+                a.reset();
+                b.reset();
+                resource.release();
+            });
+    }
+
+    BackendStats string_build(ContenderResource& resource, long n, std::mt19937_64& gen)
+    {
+        // Up to eight pieces of 1 to 32 characters per string, most outgrow the small string buffer
+        std::vector<std::uint8_t>             pieces(n);
+        std::vector<std::uint8_t>             lengths(8 * n);
+        std::uniform_int_distribution<int>    piece_dist(1, 8);
+        std::uniform_int_distribution<int>    length_dist(1, 32);
+        std::generate(pieces.begin(), pieces.end(), [&] { return piece_dist(gen); });
+        std::generate(lengths.begin(), lengths.end(), [&] { return length_dist(gen); });
+
+        std::optional<std::pmr::vector<std::pmr::string>> strings;
+        std::uint64_t                                     sum = 0;
+
+        return measure(
+            [&] {
+                strings.emplace(resource.get());
+                for (long i = 0; i < n; ++i) {
+                    auto& s = strings->emplace_back();
+                    for (int p = 0; p < pieces[i]; ++p) {
+                        s.append(lengths[8 * i + p], static_cast<char>('a' + p));
+                    }
+                }
+            },
+            [&] {
+                for (const auto& s : *strings) {
+                    sum += s.size() + static_cast<unsigned char>(s.back());
+                }
+                escape(&sum);
+            },
+            [&] {
+                strings.reset();
+                resource.release();
+            });
+    }
+
+    BackendStats container_round(const Contender& contender, ContainerWorkload workload, long n)
+    {
+        // The same elements for every contender
+        std::mt19937_64   gen(stream_seed(n, static_cast<int>(workload)));
+        ContenderResource resource(contender);
+
+        ThreadPerfCounters counters(use_perf_counters);
+
+        BackendStats result;
+        switch (workload) {
+        case ContainerWorkload::map_churn:
+            result = map_churn(resource, n, gen);
+            break;
+        case ContainerWorkload::vector_growth:
+            result = vector_growth(resource, n, gen);
+            break;
+        case ContainerWorkload::list_splice:
+            result = list_splice(resource, n, gen);
+            break;
+        case ContainerWorkload::string_build:
+            result = string_build(resource, n, gen);
+            break;
+        }
+
+        counters.read(result.alloc_counters, result.free_counters);
+
+        // Phase boundary for backends which release in bulk
+        if (contender.backend.release) {
+            contender.backend.release();
+        }
+        return result;
+    }
+} // namespace
+
+std::vector<Contender> container_contenders(const std::vector<Backend>& backends)
+{
+    std::vector<Contender> contenders;
+    for (const auto& backend : backends) {
+        contenders.push_back({backend, ResourceKind::backend});
+    }
+
+    const auto& upstream = backends.front();
+    for (const auto& [kind, name] : {std::pair{ResourceKind::monotonic, "monotonic"}, std::pair{ResourceKind::unsynchronized_pool, "unsync-pool"},
+                                     std::pair{ResourceKind::synchronized_pool, "sync-pool"}}) {
+        Contender contender{upstream, kind};
+        contender.backend.name    = fmt::format("{}({})", name, upstream.name);
+        contender.backend.version = fmt::format("std::pmr on {} {}", upstream.name, upstream.version);
+        contenders.push_back(std::move(contender));
+    }
+    return contenders;
+}
+
+std::vector<Stats> container_alloc(const std::vector<Contender>& contenders, ContainerWorkload workload)
+{
+    std::vector<Backend> backends;
+    for (const auto& c : contenders) {
+        backends.push_back(c.backend);
+    }
+
+    print_container_header(backends);
+
+    std::vector<Stats> statistics;
+    statistics.reserve(max_container_power);
+
+    for (long n = 4; n <= max_container_power; ++n) {
+        long N = std::pow(2, n);
+
+        Stats stats{N, {}};
+        stats.backends.reserve(contenders.size());
+
+        for (const auto& contender : contenders) {
+            BackendThreadScope scope(contender.backend);
+            stats.backends.push_back(run_trials([&] { return container_round(contender, workload, N); }));
+        }
+
+        print_container_round(N, stats.backends, print_round_time);
+
+        statistics.emplace_back(std::move(stats));
+    }
+
+    if (print_trial_summary) {
+        print_trials(backends, statistics);
+    }
+
+    if (use_perf_counters) {
+        print_perf_counters(backends, statistics);
+    }
+
+    return statistics;
+}
@@ -0,0 +1,104 @@
+#include "dl_backend.h"
+
+#include <dlfcn.h>
+#include <link.h>
+
+#include <fmt/format.h>
+
+namespace
+{
+    /// Derive a backend name from the library path, i.e. "path/to/libhoard.so.1" -> "hoard"
+    std::string name_from_path(std::string_view path)
+    {
+        if (auto slash = path.rfind('/'); slash != std::string_view::npos) {
+            path.remove_prefix(slash + 1);
+        }
+
+        if (path.substr(0, 3) == "lib") {
+            path.remove_prefix(3);
+        }
+
+        if (auto dot = path.find('.'); dot != std::string_view::npos) {
+            path = path.substr(0, dot);
+        }
+
+        return std::string{path};
+    }
+
+    /// File name of the loaded library, as dladdr reports it for its symbols
+    std::string library_file(void* handle)
+    {
+        link_map* map = nullptr;
+        if (dlinfo(handle, RTLD_DI_LINKMAP, &map) != 0 || !map || !map->l_name)
+            return {};
+        return map->l_name;
+    }
+
+    /// dlsym also searches the dependencies of the library, so a symbol it doesn't export itself
+    /// would come from another allocator, usually libc. Those count as not exported
+    template <typename Fn>
+    Fn lookup(void* handle, const std::string& library, std::string_view prefix, std::string_view symbol)
+    {
+        auto  name    = fmt::format("{}{}", prefix, symbol);
+        void* address = dlsym(handle, name.c_str());
+
+        Dl_info info;
+        if (!address || !dladdr(address, &info) || !info.dli_fname || library != info.dli_fname)
+            return nullptr;
+        return reinterpret_cast<Fn>(address);
+    }
+} // namespace
+
+std::optional<Backend> load_backend(std::string_view spec, std::string& error)
+{
+    std::string_view path   = spec;
+    std::string_view prefix = "";
+
+    if (auto colon = spec.rfind(':'); colon != std::string_view::npos) {
+        path   = spec.substr(0, colon);
+        prefix = spec.substr(colon + 1);
+    }
+
+    const std::string path_str{path};
+
+    // Each backend gets its own namespace, with its own copy of libc. This way a malloc exported
+    // from the library doesn't interpose the one of the main program
+    void* handle = dlmopen(LM_ID_NEWLM, path_str.c_str(), RTLD_NOW | RTLD_LOCAL);
+
+    if (!handle) {
+        fmt::print("Loading '{}' into a new namespace failed ({}), falling back to dlopen\n", path, dlerror());
+        handle = dlopen(path_str.c_str(), RTLD_NOW | RTLD_LOCAL | RTLD_DEEPBIND);
+    }
+
+    if (!handle) {
+        error = dlerror();
+        return std::nullopt;
+    }
+
+    // The handle is deliberately never closed, the backend is used until the program exits
+    const auto library = library_file(handle);
+
+    Backend backend;
+    backend.name    = name_from_path(path);
+    backend.version = std::string(path);
+    backend.malloc  = lookup<void* (*)(std::size_t)>(handle, library, prefix, "malloc");
+    backend.free    = lookup<void (*)(void*)>(handle, library, prefix, "free");
+    backend.realloc = lookup<void* (*)(void*, std::size_t)>(handle, library, prefix, "realloc");
+
+    // memalign takes the same arguments as aligned_alloc and is exported by more allocators
+    backend.aligned_alloc = lookup<void* (*)(std::size_t, std::size_t)>(handle, library, prefix, "aligned_alloc");
+    if (!backend.aligned_alloc) {
+        backend.aligned_alloc = lookup<void* (*)(std::size_t, std::size_t)>(handle, library, prefix, "memalign");
+    }
+
+    // Both are optional, C23 names the sized free free_sized
+    backend.calloc     = lookup<void* (*)(std::size_t, std::size_t)>(handle, library, prefix, "calloc");
+    backend.free_sized = lookup<void (*)(void*, std::size_t)>(handle, library, prefix, "free_sized");
+
+    if (!backend.malloc || !backend.free) {
+        error = fmt::format("'{}' doesn't export '{}malloc' and '{}free' itself", path, prefix, prefix);
+        return std::nullopt;
+    }
+
+    return backend;
+}
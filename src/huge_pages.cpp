@@ -0,0 +1,82 @@
+#include "huge_pages.h"
+
+#include <cstdint>
+#include <fstream>
+
+#include <sys/mman.h>
+
+#include "tbb/scalable_allocator.h"
+
+namespace
+{
+    /// The value in brackets of a sysfs selection like "always [madvise] never"
+    std::string read_selection(const char* path)
+    {
+        std::ifstream file(path);
+        std::string   line;
+        if (!file || !std::getline(file, line))
+            return "unavailable";
+
+        const auto open  = line.find('[');
+        const auto close = line.find(']', open);
+        if (open == std::string::npos || close == std::string::npos)
+            return line;
+        return line.substr(open + 1, close - open - 1);
+    }
+
+    std::size_t huge_page_size()
+    {
+        static const std::size_t size = read_thp_settings().huge_page_size;
+        return size;
+    }
+} // namespace
+
+bool parse_huge_page_policy(std::string_view name, HugePagePolicy& policy)
+{
+    if (name == "system") {
+        policy = HugePagePolicy::system;
+    } else if (name == "huge") {
+        policy = HugePagePolicy::huge;
+    } else if (name == "nohuge") {
+        policy = HugePagePolicy::nohuge;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+ThpSettings read_thp_settings()
+{
+    ThpSettings settings;
+    settings.enabled = read_selection("/sys/kernel/mm/transparent_hugepage/enabled");
+    settings.defrag  = read_selection("/sys/kernel/mm/transparent_hugepage/defrag");
+
+    std::ifstream file("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size");
+    if (!(file >> settings.huge_page_size) || settings.huge_page_size == 0) {
+        settings.huge_page_size = 2 * 1024 * 1024;
+    }
+    return settings;
+}
+
+void apply_huge_page_policy()
+{
+    // TBB maps its large blocks with huge pages if asked to and the system supports them
+    if (huge_page_policy != HugePagePolicy::system) {
+        scalable_allocation_mode(TBBMALLOC_USE_HUGE_PAGES, huge_page_policy == HugePagePolicy::huge ? 1 : 0);
+    }
+}
+
+void advise_huge_pages(void* block, std::size_t size)
+{
+    if (huge_page_policy == HugePagePolicy::system || !block)
+        return;
+
+    const auto page  = huge_page_size();
+    const auto start = (reinterpret_cast<std::uintptr_t>(block) + page - 1) & ~(page - 1);
+    const auto end   = (reinterpret_cast<std::uintptr_t>(block) + size) & ~(page - 1);
+    if (start >= end)
+        return;
+
+    // Fails for memory which isn't anonymous, nothing to do about it
+    madvise(reinterpret_cast<void*>(start), end - start, huge_page_policy == HugePagePolicy::huge ? MADV_HUGEPAGE : MADV_NOHUGEPAGE);
+}
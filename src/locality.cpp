@@ -0,0 +1,357 @@
+#include "locality.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <random>
+
+#include <fmt/format.h>
+
+#include <unistd.h>
+
+#include "op_stream.h"
+#include "options.h"
+#include "perf_counters.h"
+#include "print.h"
+#include "runner.h"
+#include "timer.h"
+#include "util.h"
+
+namespace
+{
+    /// All nodes are 32 bytes, two of them fit into a cache line if the backend packs them
+    struct ListNode {
+        ListNode*     next;
+        std::uint64_t value;
+        std::uint64_t padding[2];
+    };
+
+    struct TreeNode {
+        TreeNode*     left;
+        TreeNode*     right;
+        std::uint64_t key;
+        std::uint64_t value;
+    };
+
+    struct HashNode {
+        HashNode*     next;
+        std::uint64_t key;
+        std::uint64_t value;
+        std::uint64_t padding;
+    };
+
+    /// Blocks of random size, half of them freed again, which leaves holes all over the heap
+    class Churn
+    {
+    public:
+        Churn(const Backend& backend, long n, std::mt19937_64& gen) : backend_(backend)
+        {
+            std::uniform_int_distribution<std::size_t> size_dist(16, 256);
+
+            blocks_.resize(2 * n);
+            for (auto& block : blocks_) {
+                block = backend_.malloc(size_dist(gen));
+                escape(block);
+            }
+
+            std::shuffle(blocks_.begin(), blocks_.end(), gen);
+            for (long i = 0; i < n; ++i) {
+                backend_.free(blocks_[i]);
+            }
+            blocks_.erase(blocks_.begin(), blocks_.begin() + n);
+        }
+
+        ~Churn()
+        {
+            for (auto* block : blocks_) {
+                backend_.free(block);
+            }
+        }
+
+        Churn(const Churn&) = delete;
+        Churn& operator=(const Churn&) = delete;
+
+    private:
+        const Backend&     backend_;
+        std::vector<void*> blocks_;
+    };
+
+    /// Count the distinct cache lines and pages the nodes lie on
+    template <typename Node>
+    void count_spread(const std::vector<Node*>& nodes, BackendStats& result)
+    {
+        static const std::uintptr_t page_size = sysconf(_SC_PAGESIZE);
+
+        std::vector<std::uintptr_t> lines, pages;
+        lines.reserve(2 * nodes.size());
+        pages.reserve(2 * nodes.size());
+
+        for (const auto* node : nodes) {
+            const auto first = reinterpret_cast<std::uintptr_t>(node);
+            const auto last  = first + sizeof(Node) - 1;
+            for (auto line = first / cache_line_size; line <= last / cache_line_size; ++line) {
+                lines.push_back(line);
+            }
+            for (auto page = first / page_size; page <= last / page_size; ++page) {
+                pages.push_back(page);
+            }
+        }
+
+        for (auto* v : {&lines, &pages}) {
+            std::sort(v->begin(), v->end());
+            v->erase(std::unique(v->begin(), v->end()), v->end());
+        }
+        result.walked_lines = lines.size();
+        result.walked_pages = pages.size();
+    }
+
+    /// Time building, walking and destroying a structure. Inspect runs untimed between the walk
+    /// and the destruction
+    template <typename Build, typename Walk, typename Inspect, typename Destroy>
+    BackendStats measure(Build&& build, Walk&& walk, Inspect&& inspect, Destroy&& destroy)
+    {
+        BackendStats result;
+
+        phase_begin(Phase::alloc);
+        auto build_start = timer_start();
+        build();
+        auto build_end = timer_stop();
+        phase_end(Phase::alloc);
+        result.alloc_elapsed = timer_elapsed(build_start, build_end);
+
+        auto walk_start = timer_start();
+        walk();
+        auto walk_end = timer_stop();
+        result.touch_elapsed = timer_elapsed(walk_start, walk_end);
+
+        inspect(result);
+
+        phase_begin(Phase::free);
+        auto destroy_start = timer_start();
+        destroy();
+        auto destroy_end = timer_stop();
+        phase_end(Phase::free);
+        result.free_elapsed = timer_elapsed(destroy_start, destroy_end);
+
+        return result;
+    }
+
+    BackendStats list_walk(const Backend& backend, long n, std::mt19937_64&)
+    {
+        ListNode*              head = nullptr;
+        std::vector<ListNode*> order;
+        std::uint64_t          sum = 0;
+
+        return measure(
+            [&] {
+                ListNode** tail = &head;
+                for (long i = 0; i < n; ++i) {
+                    auto* node = static_cast<ListNode*>(backend.malloc(sizeof(ListNode)));
+                    node->next  = nullptr;
+                    node->value = i;
+                    *tail       = node;
+                    tail        = &node->next;
+                }
+            },
+            [&] {
+                for (auto* node = head; node; node = node->next) {
+                    sum += node->value;
+                }
+                escape(&sum);
+            },
+            [&](BackendStats& result) {
+                order.reserve(n);
+                for (auto* node = head; node; node = node->next) {
+                    order.push_back(node);
+                }
+                count_spread(order, result);
+            },
+            [&] {
+                for (auto* node : order) {
+                    backend.free(node);
+                }
+            });
+    }
+
+    /// Call visit for the nodes of the tree in key order, stack is kept to avoid allocations
+    template <typename Visit>
+    void in_order(TreeNode* node, std::vector<TreeNode*>& stack, Visit&& visit)
+    {
+        while (node || !stack.empty()) {
+            if (node) {
+                stack.push_back(node);
+                node = node->left;
+            } else {
+                node = stack.back();
+                stack.pop_back();
+                visit(node);
+                node = node->right;
+            }
+        }
+    }
+
+    BackendStats tree_walk(const Backend& backend, long n, std::mt19937_64& gen)
+    {
+        std::vector<std::uint64_t> keys(n);
+        std::generate(keys.begin(), keys.end(), gen);
+
+        TreeNode*              root = nullptr;
+        std::vector<TreeNode*> stack, order;
+        std::uint64_t          sum = 0;
+
+        // An unbalanced tree of random keys is about 3 log2(n) deep
+        stack.reserve(64 + 4 * static_cast<std::size_t>(std::log2(n)));
+
+        return measure(
+            [&] {
+                for (long i = 0; i < n; ++i) {
+                    auto* node  = static_cast<TreeNode*>(backend.malloc(sizeof(TreeNode)));
+                    node->left  = nullptr;
+                    node->right = nullptr;
+                    node->key   = keys[i];
+                    node->value = i;
+
+                    TreeNode** link = &root;
+                    while (*link) {
+                        link = keys[i] < (*link)->key ? &(*link)->left : &(*link)->right;
+                    }
+                    *link = node;
+                }
+            },
+            [&] {
+                // In order, like iterating over a std::map
+                in_order(root, stack, [&](TreeNode* node) { sum += node->value; });
+                escape(&sum);
+            },
+            [&](BackendStats& result) {
+                order.reserve(n);
+                in_order(root, stack, [&](TreeNode* node) { order.push_back(node); });
+                count_spread(order, result);
+            },
+            [&] {
+                for (auto* node : order) {
+                    backend.free(node);
+                }
+            });
+    }
+
+    BackendStats hash_chains_walk(const Backend& backend, long n, std::mt19937_64& gen)
+    {
+        // Four nodes per chain on average
+        const long buckets = std::max(1L, n / 4);
+
+        std::vector<std::uint64_t> keys(n);
+        std::generate(keys.begin(), keys.end(), gen);
+
+        HashNode**             table = nullptr;
+        std::vector<HashNode*> order;
+        std::uint64_t          sum = 0;
+
+        return measure(
+            [&] {
+                table = static_cast<HashNode**>(backend.malloc(buckets * sizeof(HashNode*)));
+                std::fill(table, table + buckets, nullptr);
+                for (long i = 0; i < n; ++i) {
+                    auto* node  = static_cast<HashNode*>(backend.malloc(sizeof(HashNode)));
+                    auto& chain = table[keys[i] % buckets];
+                    node->next  = chain;
+                    node->key   = keys[i];
+                    node->value = i;
+                    chain       = node;
+                }
+            },
+            [&] {
+                for (long b = 0; b < buckets; ++b) {
+                    for (auto* node = table[b]; node; node = node->next) {
+                        sum += node->value;
+                    }
+                }
+                escape(&sum);
+            },
+            [&](BackendStats& result) {
+                order.reserve(n);
+                for (long b = 0; b < buckets; ++b) {
+                    for (auto* node = table[b]; node; node = node->next) {
+                        order.push_back(node);
+                    }
+                }
+                count_spread(order, result);
+            },
+            [&] {
+                for (auto* node : order) {
+                    backend.free(node);
+                }
+                backend.free(table);
+            });
+    }
+
+    BackendStats locality_round(const Backend& backend, LocalityStructure structure, bool churned, long n)
+    {
+        // The same keys and churn for every backend
+        std::mt19937_64 gen(stream_seed(n, 2 * static_cast<int>(structure) + churned));
+
+        std::optional<Churn> churn;
+        if (churned) {
+            churn.emplace(backend, n, gen);
+        }
+
+        ThreadPerfCounters counters(use_perf_counters);
+
+        BackendStats result;
+        switch (structure) {
+        case LocalityStructure::list:
+            result = list_walk(backend, n, gen);
+            break;
+        case LocalityStructure::tree:
+            result = tree_walk(backend, n, gen);
+            break;
+        case LocalityStructure::hash_chains:
+            result = hash_chains_walk(backend, n, gen);
+            break;
+        }
+
+        counters.read(result.alloc_counters, result.free_counters);
+        churn.reset();
+
+        // Phase boundary for backends which release in bulk
+        if (backend.release) {
+            backend.release();
+        }
+        return result;
+    }
+} // namespace
+
+std::vector<Stats> locality_alloc(const std::vector<Backend>& backends, LocalityStructure structure, bool churned)
+{
+    print_locality_header(backends);
+
+    std::vector<Stats> statistics;
+    statistics.reserve(max_locality_power);
+
+    for (long n = 10; n <= max_locality_power; ++n) {
+        long N = std::pow(2, n);
+
+        Stats stats{N, {}};
+        stats.backends.reserve(backends.size());
+
+        for (const auto& backend : backends) {
+            BackendThreadScope scope(backend);
+            stats.backends.push_back(run_trials([&] { return locality_round(backend, structure, churned, N); }));
+        }
+
+        print_locality_round(N, stats.backends, print_round_time);
+
+        statistics.emplace_back(std::move(stats));
+    }
+
+    if (print_trial_summary) {
+        print_trials(backends, statistics);
+    }
+
+    if (use_perf_counters) {
+        print_perf_counters(backends, statistics);
+    }
+
+    return statistics;
+}
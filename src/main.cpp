@@ -8,437 +8,589 @@
 #include <thread>
 #include <mutex>
 #include <string_view>
+#include <string>
+#include <numeric>
+#include <optional>
 #include <assert.h>
 #include <cstdio>
+#include <cstring>
+#include <ctime>
 
 #include <fmt/format.h>
 #include <fmt/color.h>
 #include <fmt/ranges.h>
 
-#include "tbb/scalable_allocator.h"
-
 #include "cxxopts.hpp"
 
 // Some includes to just clean this file up a bit
+#include "backend.h"
+#include "compare.h"
+#include "containers.h"
+#include "dl_backend.h"
+#include "huge_pages.h"
+#include "locality.h"
+#include "memory_return.h"
+#include "memory_stats.h"
+#include "perf_counters.h"
+#include "pool_allocator.h"
 #include "print.h"
+#include "producer_consumer.h"
+#include "replay.h"
+#include "results.h"
+#include "runner.h"
+#include "soak.h"
+#include "thread_pool.h"
+#include "timer.h"
+#include "numa.h"
+#include "op_stream.h"
 #include "options.h"
 #include "types.h"
 #include "util.h"
+#include "workload_model.h"
 
-template <typename Malloc, typename Free>
-auto basic_alloc_free_impl(long ipow, Malloc malloc, Free free) -> std::pair<fsec, fsec>
-{
-    long N = std::pow(2, ipow);
-
-    fsec alloc_time{};
-    fsec free_time{};
-
-    for (int i = 0; i < repeat; ++i) {
-        auto       alloc_start = stdclock::now();
-        std::byte* buf         = static_cast<std::byte*>(malloc(N * sizeof(std::byte)));
-        auto       alloc_end   = stdclock::now();
-
-        alloc_time += (alloc_end - alloc_start);
-
-        // Here we just tell the compiler, we used it somehow and therefore
-        // can't assume anything.  This actually matters! Without it, the
-        // result times are pretty much constant and most
-        // likely garbage
-        escape(buf);
-
-        auto free_start = stdclock::now();
-        free(buf);
-        auto free_end = stdclock::now();
-
-        free_time += (free_end - free_start);
-    }
-
-    return {alloc_time, free_time};
-}
-
-template <typename Malloc, typename Free>
-auto alloc_permuted_free_impl(long ipow, Malloc malloc, Free free) -> std::pair<fsec, fsec>
+/// Run stream with the entry points of backend which path selects, the ones the backend doesn't
+/// have are emulated
+BackendStats run_backend_stream(const OpStream& stream, const Backend& backend, AllocPath path, const StopSignal* stop)
 {
-    long N = std::pow(2, ipow);
+    auto realloc = [&](void* ptr, std::size_t old_size, std::size_t size) {
+        if (backend.realloc)
+            return backend.realloc(ptr, size);
 
-    std::vector<std::byte*> buffers;
-    buffers.reserve(repeat);
-
-    auto alloc_start = stdclock::now();
-    for (int i = 0; i < repeat; ++i) {
-        auto buf = static_cast<std::byte*>(malloc(N));
-        buffers.push_back(std::move(buf));
+        void* block = backend.malloc(size);
+        if (block && ptr) {
+            std::memcpy(block, ptr, std::min(old_size, size));
+        }
+        backend.free(ptr);
+        return block;
+    };
+    auto free = [&](void* ptr, std::size_t) { backend.free(ptr); };
+
+    switch (path) {
+    case AllocPath::calloc:
+        return run_stream(
+            stream,
+            [&](std::size_t size) {
+                if (backend.calloc)
+                    return backend.calloc(1, size);
+
+                void* block = backend.malloc(size);
+                if (block) {
+                    std::memset(block, 0, size);
+                }
+                return block;
+            },
+            realloc, free, backend.release, stop);
+    case AllocPath::aligned_64:
+    case AllocPath::aligned_4k: {
+        const std::size_t alignment = path == AllocPath::aligned_64 ? 64 : 4096;
+        return run_stream(
+            stream,
+            [&](std::size_t size) { return backend.aligned_alloc ? backend.aligned_alloc(alignment, size) : backend.malloc(size); },
+            realloc, free, backend.release, stop);
     }
-    auto alloc_end     = stdclock::now();
-    fsec alloc_elapsed = (alloc_end - alloc_start);
-
-    // Create random permutation, with default seed, else create std::random_device and use it as
-    // seed
-    std::shuffle(std::begin(buffers), std::end(buffers), std::mt19937{});
-
-    auto free_start = stdclock::now();
-    for (auto buf : buffers) {
-        free(buf);
+    case AllocPath::sized_free:
+        return run_stream(
+            stream, backend.malloc, realloc,
+            [&](void* ptr, std::size_t size) {
+                if (backend.free_sized) {
+                    backend.free_sized(ptr, size);
+                } else {
+                    backend.free(ptr);
+                }
+            },
+            backend.release, stop);
+    case AllocPath::plain:
+        break;
     }
-    auto free_end     = stdclock::now();
-    fsec free_elapsed = (free_end - free_start);
-
-    return {alloc_elapsed, free_elapsed};
+    return run_stream(stream, backend.malloc, realloc, free, backend.release, stop);
 }
 
-template <typename Malloc, typename Free>
-auto random_alloc_permuted_free_impl(long ipow, Malloc malloc, Free free) -> std::pair<fsec, fsec>
+/// Generate the stream of workload and run it in the current thread. With '--perf' the alloc and
+/// free phases are counted with their own perf counter groups, with '--memory' the workload reports
+/// its live bytes to memory. Inside a worker pool, the workload starts together with the other
+/// workers, after every worker generated its stream. With a stop signal, the workload is repeated
+/// for run_duration seconds, the last worker to start arms it
+BackendStats run_instrumented(const Workload& workload, long n, const Backend& backend, MemoryTracker* memory, StopSignal* stop,
+                              WorkerPool* pool = nullptr, int thread_id = 0)
 {
-    long N  = std::pow(2, ipow);
-    long lb = std::pow(2, ipow - 1);
-    long ub = std::pow(2, ipow + 1);
-
-    std::vector<std::byte*> buffers;
-    buffers.reserve(repeat);
+    const auto stream = workload.generate(n, stream_seed(n, thread_id));
 
-    fsec alloc_elapsed = fsec{};
+    ThreadPerfCounters counters(use_perf_counters);
 
-    for (int i = 0; i < repeat; ++i) {
-        // Create random number
-        std::random_device                  rd;
-        std::mt19937                        gen(rd());
-        std::uniform_int_distribution<long> distrib(lb, ub);
-        auto                                N = distrib(gen);
+    thread_memory     = memory;
+    thread_live_bytes = 0;
 
-        // Measure time of allocation
-        auto alloc_start = stdclock::now();
-        auto buf         = static_cast<std::byte*>(malloc(N));
-        auto alloc_end   = stdclock::now();
-        alloc_elapsed    = (alloc_end - alloc_start);
-
-        escape(buf);
-
-        buffers.push_back(std::move(buf));
+    const bool started = pool ? pool->start_together() : true;
+    if (stop && started) {
+        stop->arm(run_duration);
     }
 
-    // Create random permutation, with default seed, else create std::random_device and use it as
-    // seed
-    std::shuffle(std::begin(buffers), std::end(buffers), std::mt19937{});
+    const auto start  = stdclock::now();
+    auto       result = run_backend_stream(stream, backend, workload.path, stop);
 
-    auto free_start = stdclock::now();
-    for (auto buf : buffers) {
-        escape(buf);
-        free(buf);
+    if (pool) {
+        pool->finish(thread_id);
+    } else {
+        result.wall_elapsed = stdclock::now() - start;
     }
-    auto free_end     = stdclock::now();
-    fsec free_elapsed = (free_end - free_start);
 
-    return {alloc_elapsed, free_elapsed};
+    thread_memory = nullptr;
+    counters.read(result.alloc_counters, result.free_counters);
+
+    return result;
 }
 
-template <typename Malloc, typename Free>
-auto random_alloc_random_permuted_free_impl(long ipow, Malloc malloc, Free free) -> std::pair<fsec, fsec>
+/// Run a workload for all sizes from 2^min_power to 2^max_power of the workload on each backend in turn
+auto single_threaded_alloc(const std::vector<Backend>& backends, const Workload& workload)
 {
-    std::random_device rd;
-    std::mt19937       alloc_gen(rd());
-    std::mt19937       free_gen(rd());
+    print_header(backends, print_total_time, workload.row_label);
 
-    long N  = std::pow(2, ipow);
-    long lb = std::pow(2, ipow - 1);
-    long ub = std::pow(2, ipow + 1);
-
-    std::vector<std::byte*> buffers;
-    buffers.reserve(repeat);
+    std::vector<Stats> statistics;
+    statistics.reserve(workload.max_power);
 
-    fsec alloc_elapsed = fsec{};
-    fsec free_elapsed  = fsec{};
+    for (long n = workload.min_power; n <= workload.max_power; ++n) {
+        long N = std::pow(2, n);
 
-    for (int i = 0; i < repeat; ++i) {
-        // Create random number of how many new allocations should be performed
-        std::uniform_int_distribution<> alloc_dist(min_num_random_allocs, max_num_random_allocs);
-        auto                            num_allocs = alloc_dist(alloc_gen);
+        Stats stats{N, {}};
+        stats.backends.reserve(backends.size());
 
-        // Grow buffers by it's current size + num_allocs
-        buffers.reserve(buffers.size() + num_allocs);
-        for (int j = 0; j < num_allocs; j++) {
-            // Create number of new
-            std::mt19937                        gen(rd());
-            std::uniform_int_distribution<long> distrib(lb, ub);
+        for (const auto& backend : backends) {
+            BackendThreadScope scope(backend);
 
-            // Size of new allocation
-            auto N = distrib(gen);
+            stats.backends.push_back(run_trials([&] {
+                std::optional<MemoryTracker> memory;
+                if (track_memory) {
+                    memory.emplace(backend);
+                }
 
-            // Measure time of allocation
-            auto alloc_start = stdclock::now();
-            auto buf         = static_cast<std::byte*>(malloc(N));
-            auto alloc_end   = stdclock::now();
-            alloc_elapsed += (alloc_end - alloc_start);
+                std::optional<StopSignal> stop;
+                if (run_duration > 0) {
+                    stop.emplace();
+                }
 
-            // Escpae it, an tell the optimizer to not optimize it away
-            escape(buf);
+                auto result = run_instrumented(workload, n, backend, memory ? &*memory : nullptr, stop ? &*stop : nullptr);
 
-            buffers.push_back(std::move(buf));
+                if (memory) {
+                    result.memory = memory->finish();
+                }
+                return result;
+            }, run_duration > 0));
         }
 
-        // Create random permutation, with default seed, else create std::random_device and use it
-        // as seed
-        std::shuffle(std::begin(buffers), std::end(buffers), std::mt19937{});
-
-        // Randomly choose the number of frees we're performing this round
-        std::uniform_int_distribution<> free_dist(0, buffers.size());
-        auto                            num_frees = free_dist(free_gen);
+        print_round(N, stats.backends, print_round_time, print_total_time);
 
-        for (int j = 0; j < num_frees; j++) {
-            // Measure time of free
-            auto free_start = stdclock::now();
-            free(buffers[j]);
-            auto free_end = stdclock::now();
-            free_elapsed += (free_end - free_start);
-        }
-
-        // Shorten the vector by num_frees
-        std::vector<decltype(buffers)::value_type>(buffers.begin() + num_frees, buffers.end()).swap(buffers);
+        // Log this to create nice copyable and easyly plotable stuff
+        statistics.emplace_back(std::move(stats));
     }
 
-    // Clean up, free all remaining chunks
-    for (auto buf : buffers) {
-        auto free_start = stdclock::now();
-        free(buf);
-        auto free_end = stdclock::now();
-        free_elapsed += (free_end - free_start);
+    if (run_duration > 0) {
+        print_throughput(backends, statistics, 1, workload.row_label);
     }
 
-    return {alloc_elapsed, free_elapsed};
-}
-
+    print_reallocs(backends, statistics);
 
-/// Perform linearly growing allocations and directly free the allocated memory afterwards
-auto linear_growth_alloc()
-{
-    print_header(print_total_time);
+    if (touch_policy != TouchPolicy::none) {
+        print_touch(backends, statistics);
+    }
 
-    std::vector<Stats> statistics;
-    statistics.reserve(max_size_power);
+    if (print_trial_summary) {
+        print_trials(backends, statistics);
+    }
 
-    // Perform allocations from 1 byte to 1 GB
-    for (long n = 1; n <= max_size_power; ++n) {
-        long N                                     = std::pow(2, n);
-        auto [tbb_alloc_elapsed, tbb_free_elapsed] = basic_alloc_free_impl(n, scalable_malloc, scalable_free);
-        auto [alloc_elapsed, free_elapsed]         = basic_alloc_free_impl(n, std::malloc, std::free);
+    if (print_latency_percentiles) {
+        print_latencies(backends, statistics);
+    }
 
-        print_round(N, alloc_elapsed, free_elapsed, tbb_alloc_elapsed, tbb_free_elapsed, print_round_time, print_total_time);
+    if (use_perf_counters) {
+        print_perf_counters(backends, statistics);
+    }
 
-        // Log this to create nice copyable and easyly plotable stuff
-        Stats stats = {N, alloc_elapsed, free_elapsed, tbb_alloc_elapsed, tbb_free_elapsed};
-        statistics.emplace_back(stats);
+    if (track_memory) {
+        print_memory(backends, statistics);
     }
 
     return statistics;
 }
 
-/// Perform linearly growing allocations, but first perform many allocations and then free them
-/// afterwards in a permuted (i.e not the order of allocation)
-auto linear_growth_permuted_free()
+/// Same as single_threaded_alloc(), but every backend runs the workload in num_threads threads at
+/// once. The threads are created once and pinned according to worker_affinity, and every round
+/// starts in all of them at the same time. The reported times are the average over all threads,
+/// the throughput is the aggregate over all threads in wall clock time
+auto threaded_alloc(const std::vector<Backend>& backends, int num_threads, const Workload& workload)
 {
-    print_header(print_total_time);
+    print_header(backends, print_total_time, workload.row_label);
+
+    WorkerPool pool(num_threads, worker_affinity);
 
     std::vector<Stats> statistics;
-    statistics.reserve(max_size_power);
+    statistics.reserve(workload.max_power);
 
-    for (long n = 1; n <= max_size_power; ++n) {
-        long N                                     = std::pow(2, n);
-        auto [alloc_elapsed, free_elapsed]         = alloc_permuted_free_impl(n, std::malloc, std::free);
-        auto [tbb_alloc_elapsed, tbb_free_elapsed] = alloc_permuted_free_impl(n, scalable_malloc, scalable_free);
+    for (long n = workload.min_power; n <= workload.max_power; ++n) {
+        long N = std::pow(2, n);
 
-        print_round(N, alloc_elapsed, free_elapsed, tbb_alloc_elapsed, tbb_free_elapsed, print_round_time, print_total_time);
+        Stats stats{N, {}};
+        stats.backends.reserve(backends.size());
 
-        // Log this to create nice copyable and easyly plotable stuff
-        Stats stats = {N, alloc_elapsed, free_elapsed, tbb_alloc_elapsed, tbb_free_elapsed};
-        statistics.emplace_back(stats);
-    }
+        for (const auto& backend : backends) {
+            stats.backends.push_back(run_trials([&] {
+                std::vector<BackendStats> times(num_threads);
 
-    return statistics;
-}
+                std::optional<StopSignal> stop;
+                if (run_duration > 0) {
+                    stop.emplace();
+                }
 
-/// Allocate random sizes which varie to the next lower power of 2 and the next larger power of
-/// two So for a given N = 2^n, allocations are in [2^(n-1), 2^(n+1)[ Then again allocate
-/// everything and randomly free them
-auto random_alloc_permuted_free()
-{
-    print_header(print_total_time);
+                // All threads report into the same tracker, as the process footprint is shared
+                std::optional<MemoryTracker> memory;
+                if (track_memory) {
+                    memory.emplace(backend);
+                }
 
-    std::vector<Stats> statistics;
-    statistics.reserve(max_size_power);
+                // Every thread writes only its own entry
+                pool.run([&](int thread_id) {
+                    BackendThreadScope scope(backend);
+                    times[thread_id] = run_instrumented(workload, n, backend, memory ? &*memory : nullptr, stop ? &*stop : nullptr, &pool,
+                                                        thread_id);
+                });
+
+                // Sum time of all threads, and merge the latency histograms
+                BackendStats merged;
+                for (const auto& t : times) {
+                    merged.alloc_elapsed += t.alloc_elapsed;
+                    merged.free_elapsed += t.free_elapsed;
+                    merged.alloc_latency.merge(t.alloc_latency);
+                    merged.free_latency.merge(t.free_latency);
+                    merged.alloc_counters.merge(t.alloc_counters);
+                    merged.free_counters.merge(t.free_counters);
+                    merged.bytes += t.bytes;
+                    merged.touch_elapsed += t.touch_elapsed;
+                    merged.touched_pages += t.touched_pages;
+                    merged.minor_faults += t.minor_faults;
+                    merged.major_faults += t.major_faults;
+                    merged.reallocs += t.reallocs;
+                    merged.in_place_reallocs += t.in_place_reallocs;
+                }
 
-    // Iterate over 2^1 to 2^20
-    for (long n = 1; n <= max_size_power; ++n) {
-        // Calculate lower and upper bound
-        long N = std::pow(2, n);
+                merged.wall_elapsed = pool.wall_elapsed();
 
-        auto [alloc_elapsed, free_elapsed]         = random_alloc_permuted_free_impl(n, std::malloc, std::free);
-        auto [tbb_alloc_elapsed, tbb_free_elapsed] = random_alloc_permuted_free_impl(n, scalable_malloc, scalable_free);
+                // Divide by the number of threads. Fixed duration runs report the time per
+                // operation instead, which run_trials() gets by dividing by the merged count
+                if (run_duration <= 0) {
+                    merged.alloc_elapsed /= num_threads;
+                    merged.free_elapsed /= num_threads;
+                }
+
+                if (memory) {
+                    merged.memory = memory->finish();
+                }
+                return merged;
+            }, run_duration > 0));
+        }
 
-        print_round(N, alloc_elapsed, free_elapsed, tbb_alloc_elapsed, tbb_free_elapsed, print_round_time, print_total_time);
+        print_round(N, stats.backends, print_round_time, print_total_time, num_threads);
 
         // Log this to create nice copyable and easyly plotable stuff
-        Stats stats = {N, alloc_elapsed, free_elapsed, tbb_alloc_elapsed, tbb_free_elapsed};
-        statistics.emplace_back(stats);
+        statistics.emplace_back(std::move(stats));
     }
 
-    return statistics;
-}
-
-/// Similar to random_alloc_permuted_free(), but now don't free everything, free a random number
-/// of buffers and then start allocating random sizes again and do it over and over again.
-/// This should mimic a programm with many different allocations and common frees
-auto random_alloc_random_permuted_free()
-{
-    print_header(print_total_time);
+    print_throughput(backends, statistics, num_threads, workload.row_label);
+    print_reallocs(backends, statistics);
 
-    std::vector<Stats> statistics;
-    statistics.reserve(max_size_power);
+    if (touch_policy != TouchPolicy::none) {
+        print_touch(backends, statistics);
+    }
 
-    // Iterate over 2^1 to 2^20
-    for (long n = 1; n <= max_size_power; ++n) {
-        // Calculate lower and upper bound
-        long N = std::pow(2, n);
+    if (print_trial_summary) {
+        print_trials(backends, statistics);
+    }
 
-        auto [alloc_elapsed, free_elapsed]         = random_alloc_random_permuted_free_impl(n, std::malloc, std::free);
-        auto [tbb_alloc_elapsed, tbb_free_elapsed] = random_alloc_random_permuted_free_impl(n, scalable_malloc, scalable_free);
+    if (print_latency_percentiles) {
+        print_latencies(backends, statistics);
+    }
 
-        print_round(N, alloc_elapsed, free_elapsed, tbb_alloc_elapsed, tbb_free_elapsed, print_round_time, print_total_time);
+    if (use_perf_counters) {
+        print_perf_counters(backends, statistics);
+    }
 
-        // Log this to create nice copyable and easyly plotable stuff
-        Stats stats = {N, alloc_elapsed, free_elapsed, tbb_alloc_elapsed, tbb_free_elapsed};
-        statistics.emplace_back(stats);
+    if (track_memory) {
+        print_memory(backends, statistics);
     }
 
     return statistics;
 }
 
-using Callback = std::pair<fsec, fsec> (*)(long, void* (*) (std::size_t), void free(void*));
-
-auto threaded_alloc(int num_threads, Callback func)
+/// Run one test either single threaded, threaded or as scaling test from 1 to num_threads threads
+/// and add the results to the results file (if there is one)
+void run_test(ResultsWriter* results, std::string_view test, const std::vector<Backend>& backends, const Workload& workload, bool threaded,
+              bool run_scaling, int num_threads)
 {
-    print_header(print_total_time);
-
-    std::vector<Stats> statistics;
-    statistics.reserve(max_size_power);
-
-    // for (long N = 1; N <= gigabyte; N *= 2) {
-    for (long n = 1; n <= max_size_power; ++n) {
-        std::vector<std::thread>           threads;
-        std::vector<std::pair<fsec, fsec>> times(num_threads);
-        std::mutex                         mtx;
-
-        long N  = std::pow(2, n);
-        auto lb = std::pow(2, n - 1);
-        auto ub = std::pow(2, n + 1);
-
-        for (int i = 0; i < num_threads; ++i) {
-            // Create a thread
-            threads.emplace_back([&func, &mtx, &times, i, thread_id = i, n]() {
-                // Save pair into tmp
-                // auto tmp = alloc_permuted_free(N, std::malloc, std::free);
-                auto tmp = func(n, std::malloc, std::free);
-
-                // Lock and save pair into vector, just to be save
-                std::scoped_lock _(mtx);
-                times[thread_id] = tmp;
-            });
+    if (!threaded) {
+        auto stats = single_threaded_alloc(backends, workload);
+        if (results) {
+            results->record(test, 1, backends, stats);
         }
+        return;
+    }
 
-        // Join all threads
-        for (auto&& t : threads) {
-            t.join();
+    const int first = run_scaling ? 1 : num_threads;
+    for (int nthreads = first; nthreads <= num_threads; ++nthreads) {
+        auto stats = threaded_alloc(backends, nthreads, workload);
+        if (results) {
+            results->record(test, nthreads, backends, stats);
         }
+    }
+}
 
-        // Sum time for the first run
-        fsec alloc_elapsed{};
-        fsec free_elapsed{};
-        for (auto [alloc_time, free_time] : times) {
-            alloc_elapsed += alloc_time;
-            free_elapsed += free_time;
-        }
+/// Replay a recorded allocation trace with every backend
+void run_replay(ResultsWriter* results, const std::vector<Backend>& backends, const std::string& path, bool strict)
+{
+    ReplayTrace trace;
+    std::string error;
+    if (!load_trace(path, trace, error)) {
+        fmt::print("Could not load trace '{}': {}\n", path, error);
+        exit(1);
+    }
 
-        // Divide by the number of threads
-        alloc_elapsed /= num_threads;
-        free_elapsed /= num_threads;
-
-        // Clear threads and times
-        threads.clear();
-        times.clear();
-        threads.reserve(num_threads);
-        times.resize(num_threads);
-
-        for (int i = 0; i < num_threads; ++i) {
-            threads.emplace_back([&func, &mtx, &times, i, thread_id = i, n]() {
-                // Save pair into tmp
-                // auto tmp = alloc_permuted_free(N, scalable_malloc, scalable_free);
-                auto tmp = func(n, scalable_malloc, scalable_free);
-
-                // Lock and save pair into vector, just to be save
-                std::scoped_lock _(mtx);
-                times[thread_id] = tmp;
-            });
-        }
+    fmt::print("{:=^50}\n", "");
+    fmt::print("Replay {} operations of {} threads from '{}'", trace.num_ops, trace.threads.size(), path);
+    fmt::print(" ({} skipped, as their allocation wasn't traced)\n", trace.skipped);
+    fmt::print("{:=^50}\n\n", "");
 
-        for (auto&& t : threads) {
-            t.join();
-        }
+    // One "size" holding the total number of requested bytes, so the usual output can be reused
+    std::vector<Stats> statistics(1);
+    statistics[0].num_bytes = trace.total_bytes;
 
-        // Sum time for the first run
-        fsec tbb_alloc_elapsed{};
-        fsec tbb_free_elapsed{};
-        for (auto [alloc_time, free_time] : times) {
-            tbb_alloc_elapsed += alloc_time;
-            tbb_free_elapsed += free_time;
-        }
+    for (const auto& backend : backends) {
+        statistics[0].backends.push_back(run_trials([&] { return replay_trace(trace, backend, strict); }));
+    }
 
-        // Divide by the number of threads
-        tbb_alloc_elapsed /= num_threads;
-        tbb_free_elapsed /= num_threads;
+    print_totals(backends, statistics[0].backends);
 
-        print_round(N, alloc_elapsed, free_elapsed, tbb_alloc_elapsed, tbb_free_elapsed, print_round_time, print_total_time);
+    if (print_trial_summary) {
+        print_trials(backends, statistics);
+    }
 
-        // Log this to create nice copyable and easyly plotable stuff
-        Stats stats = {N, alloc_elapsed, free_elapsed, tbb_alloc_elapsed, tbb_free_elapsed};
-        statistics.emplace_back(stats);
+    if (print_latency_percentiles) {
+        print_latencies(backends, statistics);
     }
 
-    return statistics;
+    if (use_perf_counters) {
+        print_perf_counters(backends, statistics);
+    }
+
+    if (results) {
+        results->record("replay", static_cast<int>(trace.threads.size()), backends, statistics);
+    }
+}
+
+/// Compare the results of this run against the baseline, if there is one. Returns the exit code of
+/// the program, 2 if anything regressed and 3 if data points of the baseline are missing
+int compare_baseline(const std::vector<ResultRecord>& baseline, const ResultsWriter* results, double threshold)
+{
+    if (baseline.empty() || !results)
+        return 0;
+
+    fmt::print("\n\n{:=^50}\n", "");
+    fmt::print("Comparison against the baseline\n");
+    fmt::print("{:=^50}\n", "");
+
+    const auto outcome = compare_results(baseline, results->records(), threshold);
+    if (outcome.regressions > 0)
+        return 2;
+    return outcome.missing > 0 ? 3 : 0;
 }
 
-void loop_body() {}
+/// Value of "--name value" or "--name=value" in the raw arguments, empty if not given
+std::string raw_option(const std::vector<std::string>& args, std::string_view name)
+{
+    for (std::size_t i = 1; i < args.size(); ++i) {
+        if (args[i] == name && i + 1 < args.size()) {
+            return args[i + 1];
+        }
+        if (args[i].size() > name.size() && args[i].compare(0, name.size(), name) == 0 && args[i][name.size()] == '=') {
+            return args[i].substr(name.size() + 1);
+        }
+    }
+    return {};
+}
 
 int main(int argc, char** argv)
 {
-    cxxopts::Options options(argv[0], "Test defaul std::malloc vs TBB scalable malloc");
+    cxxopts::Options options(argv[0], "Compare the performance of different allocators");
 
     options.add_options()("h,help", "Display Help message", cxxopts::value<bool>());
     options.add_options()("v,verbose", "Verbose output (v: Round time output, vv: Round time with total time difference)",
                           cxxopts::value<bool>());
-    options.add_options()("q,quiet", "Don't print output each round, but only numpy output", cxxopts::value<bool>());
-    options.add_options()("r,report", "Report numpy arrays to further use in plotting", cxxopts::value<bool>());
+    options.add_options()("q,quiet", "Don't print output each round, only the final tables and the results file", cxxopts::value<bool>());
+    options.add_options()("r,report", "Write all results to results-<date>.jsonl, or the file given with '--output'", cxxopts::value<bool>());
+    options.add_options()("o,output", "Write all results to this file", cxxopts::value<std::string>());
+    options.add_options()("format", "Format of the results file (jsonl, columnar), default is columnar for '.col' files and jsonl otherwise",
+                          cxxopts::value<std::string>());
+    options.add_options()("l,latencies", "Print latency percentiles (p50, p90, p99, p99.9, max) after each test",
+                          cxxopts::value<bool>());
 
+    options.add_options()("perf", "Capture hardware performance counters of the alloc and free phases", cxxopts::value<bool>());
+    options.add_options()("memory", "Sample RSS, PSS and the backend's heap size against the requested bytes", cxxopts::value<bool>());
+    options.add_options()("timer", "Timer used for the measurements (steady, tsc)", cxxopts::value<std::string>()->default_value("steady"));
+    options.add_options()("batch", "Number of operations timed together, use it to measure tiny allocations more accurately",
+                          cxxopts::value<long>()->default_value("1"));
+
+    options.add_options()("touch", "Write to every allocated block, timed separately (none, page, memset, stream)",
+                          cxxopts::value<std::string>()->default_value("none"));
+    options.add_options()("thp", "Transparent huge page advice for the allocated blocks (system, huge, nohuge)",
+                          cxxopts::value<std::string>()->default_value("system"));
+    options.add_options()("duration", "Repeat every workload for this many seconds per data point and report the throughput, "
+                          "instead of running it once", cxxopts::value<double>()->default_value("0"));
+    options.add_options()("warmup", "Rounds run and thrown away before the trials of every data point",
+                          cxxopts::value<int>()->default_value("1"));
+    options.add_options()("trials", "Independent trials per data point, the reported times are their median",
+                          cxxopts::value<int>()->default_value("5"));
+    options.add_options()("max-trials", "Upper bound of trials when extending them to reach '--ci-target'",
+                          cxxopts::value<int>()->default_value("50"));
+    options.add_options()("ci-target", "Add trials until the confidence interval is narrower than this fraction of the median (e.g. 0.05)",
+                          cxxopts::value<double>()->default_value("0"));
+    options.add_options()("confidence", "Confidence level of the intervals", cxxopts::value<double>()->default_value("0.95"));
+    options.add_options()("s,summary", "Print median, MAD and confidence interval of the trials after each test", cxxopts::value<bool>());
+    options.add_options()("seed", "Seed of the generated workloads, a random one is used (and printed) if not given",
+                          cxxopts::value<std::uint64_t>());
     options.add_options()("n,num-threads", "Number of threads", cxxopts::value<int>()->default_value("4"));
 
+    options.add_options()("b,backends", "Comma separated list of backends to compare, the first one is the baseline",
+                          cxxopts::value<std::vector<std::string>>()->default_value("glibc,tbb"));
+    options.add_options()("backend", "Load an allocator from a shared library as additional backend (path/to/lib.so[:prefix])",
+                          cxxopts::value<std::vector<std::string>>());
+    options.add_options()("pool-cache", "Blocks the pool backend caches per thread and size class",
+                          cxxopts::value<int>()->default_value("64"));
+    options.add_options()("pool-batch", "Blocks the pool backend moves between thread caches and its depot at once",
+                          cxxopts::value<int>()->default_value("32"));
+    options.add_options()("pool-classes", "Size class spacing of the pool backend (pow2, quarter)",
+                          cxxopts::value<std::string>()->default_value("quarter"));
+    options.add_options()("list-backends", "List all available backends", cxxopts::value<bool>());
+
     options.add_options()("m,min-allocs", "Minimum number of allocs done for random alloc tests",
                           cxxopts::value<int>()->default_value("200"));
     options.add_options()("M,max-allocs", "Maximum number of allocs done for random alloc tests",
                           cxxopts::value<int>()->default_value("500"));
 
+    options.add_options()("replay", "Replay an allocation trace recorded with liballoc_trace.so instead of running the tests",
+                          cxxopts::value<std::string>());
+    options.add_options()("replay-strict", "Replay all operations in exactly the recorded order, instead of only per thread",
+                          cxxopts::value<bool>());
+
     options.add_options()("a,all", "Run all tests", cxxopts::value<bool>()->default_value("true"));
     options.add_options()("lin-growth-direct-free", "Linearly growing chunks, direct free", cxxopts::value<bool>());
     options.add_options()("lin-growth-permuted-free", "Linearly growing chunks, delayed permuted free", cxxopts::value<bool>());
     options.add_options()("random-alloc-permuted-free", "random sized chunks (in ranges), delayed permuted free", cxxopts::value<bool>());
     options.add_options()("random-alloc-random-free", "random sized chunks (in ranges), random delayed permuted free",
                           cxxopts::value<bool>());
+    options.add_options()("realloc-growth", "Grow buffers with realloc, counts the reallocs which stay in place (not part of --all)",
+                          cxxopts::value<bool>());
+    options.add_options()("calloc", "Allocate zeroed chunks with calloc and free them right away (not part of --all)", cxxopts::value<bool>());
+    options.add_options()("aligned", "Allocate 64 byte and 4 KiB aligned chunks and free them permuted (not part of --all)",
+                          cxxopts::value<bool>());
+    options.add_options()("sized-free", "Random chunks freed with the sized free of the backend (not part of --all)", cxxopts::value<bool>());
+    options.add_options()("modeled", "Sizes and lifetimes drawn from the models of '--sizes' and '--lifetimes' (not part of --all)",
+                          cxxopts::value<bool>());
+    options.add_options()("sizes", "Size distribution of the modeled workload (lognormal:<median>:<sigma>, zipf:<exponent>[:<largest>], "
+                          "hist:<file>)", cxxopts::value<std::string>()->default_value("lognormal:64:1.5"));
+    options.add_options()("lifetimes", "Lifetimes of the modeled workload in allocations (exp:<mean>, pareto:<alpha>:<minimum>, "
+                          "gen:<short fraction>:<short mean>[:<long mean>])", cxxopts::value<std::string>()->default_value("exp:1000"));
+    options.add_options()("soak", "Replace blocks with sizes from '--sizes' in num-threads threads for a long time and print a time series "
+                          "of throughput, latencies and RSS (not part of --all)", cxxopts::value<bool>());
+    options.add_options()("soak-duration", "Seconds every backend runs in the soak test", cxxopts::value<double>()->default_value("60"));
+    options.add_options()("soak-interval", "Seconds between the samples of the soak test", cxxopts::value<double>()->default_value("1"));
+    options.add_options()("soak-blocks", "Live blocks per thread in the soak test", cxxopts::value<long>()->default_value("16384"));
+    options.add_options()("memory-return", "Free a peak working set and follow how fast the RSS goes down, idle, under a trickle "
+                          "of allocations and with an explicit purge (not part of --all)", cxxopts::value<bool>());
+    options.add_options()("return-peak", "Peak working set of the memory return test in MB", cxxopts::value<long>()->default_value("512"));
+    options.add_options()("return-duration", "Seconds the RSS is followed after the free in the memory return test",
+                          cxxopts::value<double>()->default_value("5"));
+    options.add_options()("producer-consumer", "Producers allocate messages, consumers free them in other threads (not part of --all)",
+                          cxxopts::value<bool>());
+    options.add_options()("producers", "Number of producer threads", cxxopts::value<int>()->default_value("1"));
+    options.add_options()("consumers", "Number of consumer threads", cxxopts::value<int>()->default_value("1"));
+    options.add_options()("pc-batch", "Messages handed over from producer to consumer at once", cxxopts::value<long>()->default_value("1"));
+    options.add_options()("messages", "Messages each producer allocates per size", cxxopts::value<long>()->default_value("10000"));
+    options.add_options()("numa", "Allocate on one NUMA node, touch and free on another, for all pairs of nodes (not part of --all)",
+                          cxxopts::value<bool>());
+    options.add_options()("containers", "Build, walk and destroy standard containers through std::pmr resources (not part of --all)",
+                          cxxopts::value<bool>());
+    options.add_options()("locality", "Build linked structures, fresh and after churning the heap, and time walks over them (not part of --all)",
+                          cxxopts::value<bool>());
     options.add_options()("threaded", "Run the specified tests threaded", cxxopts::value<bool>());
     options.add_options()("scaling", "Run all tests from 1 to num-threads", cxxopts::value<bool>());
+    options.add_options()("affinity", "Pin the threads of threaded tests (none, compact, scatter, numa)",
+                          cxxopts::value<std::string>()->default_value("none"));
+
+    options.add_options()("compare-baseline",
+                          "Rerun the workloads of a results file and compare against it, exits with 2 on regressions and 3 if data "
+                          "points of it are missing",
+                          cxxopts::value<std::string>());
+    options.add_options()("regression-threshold", "Change for the worse which counts as regression, if it's significant",
+                          cxxopts::value<double>()->default_value("0.05"));
+
+    // Without any workload options, a baseline comparison reruns the command line of the baseline
+    std::vector<std::string> arguments(argv, argv + argc);
+    std::vector<ResultRecord> baseline;
+
+    const auto baseline_path = raw_option(arguments, "--compare-baseline");
+    if (!baseline_path.empty()) {
+        RunMetadata run;
+        std::string error;
+        if (!load_results(baseline_path, run, baseline, error)) {
+            fmt::print("Could not load baseline '{}': {}\n", baseline_path, error);
+            exit(1);
+        }
+
+        if (rerun_arguments(arguments).empty()) {
+            auto rerun = rerun_arguments(run.command);
+            arguments.insert(arguments.end(), rerun.begin(), rerun.end());
+            fmt::print("Rerunning the baseline: {}\n", fmt::join(rerun, " "));
+        }
 
-    auto result = options.parse(argc, argv);
+        // Generate the same operation streams as the baseline, unless another seed is given
+        auto seed = std::find_if(run.options.begin(), run.options.end(), [](const auto& option) { return option.first == "seed"; });
+        if (seed != run.options.end() && raw_option(arguments, "--seed").empty()) {
+            arguments.insert(arguments.end(), {"--seed", seed->second});
+        }
+    }
+
+    std::vector<char*> raw_arguments;
+    for (auto& arg : arguments) {
+        raw_arguments.push_back(arg.data());
+    }
+    int    num_arguments = raw_arguments.size();
+    char** argument_ptr  = raw_arguments.data();
+
+    auto result = options.parse(num_arguments, argument_ptr);
 
     if (result.count("help")) {
         fmt::print("{}", options.help());
         exit(0);
     }
 
+    // Load runtime backends first, so they can also be selected and listed by name
+    std::vector<std::string> loaded_backends;
+    if (result.count("backend")) {
+        for (const auto& spec : result["backend"].as<std::vector<std::string>>()) {
+            std::string error;
+            auto        backend = load_backend(spec, error);
+            if (!backend) {
+                fmt::print("Could not load backend '{}': {}\n", spec, error);
+                exit(1);
+            }
+            loaded_backends.push_back(backend->name);
+            register_backend(std::move(*backend));
+        }
+    }
+
+    if (result.count("list-backends")) {
+        for (const auto& backend : backend_registry()) {
+            fmt::print("{}\n", backend.name);
+        }
+        exit(0);
+    }
+
     if (result.count("quiet") && result.count("verbose")) {
         fmt::print("Specified both '-q/--quiet' and '-v/--verbose'\n");
     }
@@ -458,17 +610,170 @@ int main(int argc, char** argv)
     if (result.count("verbose") >= 2) {
         print_total_time = true;
     }
-    std::FILE* file_handle = nullptr; 
-    if (result["report"].as<bool>()) {
-        print_statistics = true;
-        file_handle      = std::fopen("report.py", "w");
-    } else {
-        print_statistics = false;
+
+    print_latency_percentiles = result["latencies"].as<bool>();
+    use_perf_counters         = result["perf"].as<bool>();
+    track_memory              = result["memory"].as<bool>();
+
+    std::vector<Backend> backends;
+    for (const auto& name : result["backends"].as<std::vector<std::string>>()) {
+        const auto* backend = find_backend(name);
+        if (!backend) {
+            fmt::print("Unknown backend '{}', see '--list-backends' for all available ones\n", name);
+            exit(1);
+        }
+        backends.push_back(*backend);
+    }
+
+    // Everything loaded via '--backend' is compared as well, even if not mentioned in '--backends'
+    for (const auto& name : loaded_backends) {
+        auto selected = std::find_if(backends.begin(), backends.end(), [&](const Backend& b) { return b.name == name; });
+        if (selected == backends.end()) {
+            backends.push_back(*find_backend(name));
+        }
+    }
+
+    if (backends.empty()) {
+        fmt::print("No backend selected\n");
+        exit(1);
+    }
+
+    TimerSource timer;
+    if (!parse_timer_source(result["timer"].as<std::string>(), timer)) {
+        fmt::print("Unknown timer '{}', use 'steady' or 'tsc'\n", result["timer"].as<std::string>());
+        exit(1);
+    }
+    init_timer(timer);
+
+    if (!parse_affinity(result["affinity"].as<std::string>(), worker_affinity)) {
+        fmt::print("Unknown affinity '{}', use 'none', 'compact', 'scatter' or 'numa'\n", result["affinity"].as<std::string>());
+        exit(1);
     }
 
+    if (!parse_touch_policy(result["touch"].as<std::string>(), touch_policy)) {
+        fmt::print("Unknown touch policy '{}', use 'none', 'page', 'memset' or 'stream'\n", result["touch"].as<std::string>());
+        exit(1);
+    }
+
+    if (!parse_huge_page_policy(result["thp"].as<std::string>(), huge_page_policy)) {
+        fmt::print("Unknown huge page policy '{}', use 'system', 'huge' or 'nohuge'\n", result["thp"].as<std::string>());
+        exit(1);
+    }
+    apply_huge_page_policy();
+
+    std::string model_error;
+    if (!parse_size_distribution(result["sizes"].as<std::string>(), model_sizes, model_error)) {
+        fmt::print("Invalid size distribution '{}': {}\n", result["sizes"].as<std::string>(), model_error);
+        exit(1);
+    }
+    if (!parse_lifetime_model(result["lifetimes"].as<std::string>(), model_lifetimes, model_error)) {
+        fmt::print("Invalid lifetime model '{}': {}\n", result["lifetimes"].as<std::string>(), model_error);
+        exit(1);
+    }
+
+    const auto thp = read_thp_settings();
+    fmt::print("Transparent huge pages: enabled '{}', defrag '{}', policy '{}'\n", thp.enabled, thp.defrag, result["thp"].as<std::string>());
+
+    if (!parse_pool_spacing(result["pool-classes"].as<std::string>(), pool_spacing)) {
+        fmt::print("Unknown size class spacing '{}', use 'pow2' or 'quarter'\n", result["pool-classes"].as<std::string>());
+        exit(1);
+    }
+    pool_cache_size = std::max(1, result["pool-cache"].as<int>());
+    pool_batch_size = std::clamp(result["pool-batch"].as<int>(), 1, pool_cache_size);
+
     // Set some globals
+    timer_batch_size      = std::max(1L, result["batch"].as<long>());
     min_num_random_allocs = result["min-allocs"].as<int>();
     max_num_random_allocs = result["max-allocs"].as<int>();
+    warmup_rounds         = std::max(0, result["warmup"].as<int>());
+    num_trials            = std::max(1, result["trials"].as<int>());
+    max_trials            = std::max(num_trials, result["max-trials"].as<int>());
+    ci_target             = result["ci-target"].as<double>();
+    confidence_level      = result["confidence"].as<double>();
+    print_trial_summary   = result["summary"].as<bool>();
+    run_duration          = std::max(0.0, result["duration"].as<double>());
+
+    if (result.count("seed")) {
+        workload_seed = result["seed"].as<std::uint64_t>();
+    } else {
+        std::random_device rd;
+        workload_seed = (static_cast<std::uint64_t>(rd()) << 32) | rd();
+    }
+    fmt::print("Seed of the workloads: {}\n", workload_seed);
+
+    if (confidence_level <= 0.0 || confidence_level >= 1.0) {
+        fmt::print("Confidence level has to be between 0 and 1\n");
+        exit(1);
+    }
+
+    // Every run gets its own results file, unless one is given. For a baseline comparison without
+    // a results file, the results are only kept in memory
+    std::optional<ResultsWriter> results;
+    if (result["report"].as<bool>() || result.count("output") || result.count("compare-baseline")) {
+        std::string path;
+        if (result.count("output")) {
+            path = result["output"].as<std::string>();
+        } else if (result["report"].as<bool>()) {
+            char       date[32];
+            const auto now = std::time(nullptr);
+            std::strftime(date, sizeof(date), "%Y%m%d-%H%M%S", std::localtime(&now));
+            path = fmt::format("results-{}.jsonl", date);
+        }
+
+        ResultsFormat format = path.size() > 4 && path.compare(path.size() - 4, 4, ".col") == 0 ? ResultsFormat::columnar : ResultsFormat::jsonl;
+        if (result.count("format") && !parse_results_format(result["format"].as<std::string>(), format)) {
+            fmt::print("Unknown results format '{}', use 'jsonl' or 'columnar'\n", result["format"].as<std::string>());
+            exit(1);
+        }
+
+        auto metadata    = collect_run_metadata(raw_arguments.size(), raw_arguments.data(), backends);
+        metadata.options = {
+            {"timer", result["timer"].as<std::string>()},
+            {"batch", std::to_string(timer_batch_size)},
+            {"repeat", std::to_string(repeat)},
+            {"duration", std::to_string(run_duration)},
+            {"touch", result["touch"].as<std::string>()},
+            {"thp", result["thp"].as<std::string>()},
+            {"thp_enabled", thp.enabled},
+            {"thp_defrag", thp.defrag},
+            {"sizes", result["sizes"].as<std::string>()},
+            {"lifetimes", result["lifetimes"].as<std::string>()},
+            {"soak_duration", std::to_string(result["soak-duration"].as<double>())},
+            {"soak_interval", std::to_string(result["soak-interval"].as<double>())},
+            {"soak_blocks", std::to_string(result["soak-blocks"].as<long>())},
+            {"return_peak", std::to_string(result["return-peak"].as<long>())},
+            {"return_duration", std::to_string(result["return-duration"].as<double>())},
+            {"num_threads", std::to_string(result["num-threads"].as<int>())},
+            {"affinity", result["affinity"].as<std::string>()},
+            {"seed", std::to_string(workload_seed)},
+            {"min_allocs", std::to_string(min_num_random_allocs)},
+            {"max_allocs", std::to_string(max_num_random_allocs)},
+            {"warmup", std::to_string(warmup_rounds)},
+            {"trials", std::to_string(num_trials)},
+            {"max_trials", std::to_string(max_trials)},
+            {"ci_target", std::to_string(ci_target)},
+            {"confidence", std::to_string(confidence_level)},
+            {"pool_cache", std::to_string(pool_cache_size)},
+            {"pool_batch", std::to_string(pool_batch_size)},
+            {"pool_classes", result["pool-classes"].as<std::string>()},
+            {"perf", use_perf_counters ? "true" : "false"},
+            {"memory", track_memory ? "true" : "false"},
+        };
+
+        results.emplace(path, format, metadata);
+        if (!results->ok()) {
+            fmt::print("Could not open results file '{}'\n", path);
+            exit(1);
+        }
+        if (!path.empty()) {
+            fmt::print("Writing results to '{}'\n", path);
+        }
+    }
+
+    if (result.count("replay")) {
+        run_replay(results ? &*results : nullptr, backends, result["replay"].as<std::string>(), result["replay-strict"].as<bool>());
+        return compare_baseline(baseline, results ? &*results : nullptr, result["regression-threshold"].as<double>());
+    }
 
     const auto threaded = result.count("threaded");
 
@@ -481,7 +786,12 @@ int main(int argc, char** argv)
 
     const bool run_all = result["all"].as<bool>()
                          && !(result["lin-growth-direct-free"].as<bool>() || result["lin-growth-permuted-free"].as<bool>()
-                              || result["random-alloc-permuted-free"].as<bool>() || result["random-alloc-random-free"].as<bool>());
+                              || result["random-alloc-permuted-free"].as<bool>() || result["random-alloc-random-free"].as<bool>()
+                              || result["realloc-growth"].as<bool>() || result["calloc"].as<bool>() || result["aligned"].as<bool>()
+                              || result["sized-free"].as<bool>() || result["producer-consumer"].as<bool>() || result["numa"].as<bool>()
+                              || result["containers"].as<bool>() || result["modeled"].as<bool>()
+                              || result["soak"].as<bool>() || result["memory-return"].as<bool>()
+                              || result["locality"].as<bool>());
 
     const bool run_scaling = result["scaling"].as<bool>();
 
@@ -493,12 +803,6 @@ int main(int argc, char** argv)
         fmt::print("Running scaling test from {} to {} threads\n", 1, num_threads);
     }
 
-    std::vector<int> range_threads(num_threads);
-    std::iota(range_threads.begin(), range_threads.end(), 1);
-
-    // threaded_linear_growth_alloc(3);
-    const bool verbose = result["verbose"].as<bool>();
-
     if (result["lin-growth-direct-free"].as<bool>() || run_all) {
 
         fmt::print("{:=^50}\n", "");
@@ -506,26 +810,8 @@ int main(int argc, char** argv)
         fmt::print("Rather syntethic benchmark. No real(TM) application just allocates");
         fmt::print("sizes in power of 2 and then releasaed them right away.\n\n");
         fmt::print("{:=^50}\n\n", "");
-        if (threaded) {
-            if (run_scaling) {
-
-                std::vector<std::vector<Stats>> stats;
-                stats.reserve(num_threads);
-
-                for (int nthreads = 1; nthreads <= num_threads; ++nthreads) {
-                    auto tmp_stats = threaded_alloc(num_threads, basic_alloc_free_impl);
-                    stats.emplace_back(std::move(tmp_stats));
-                }
 
-                print_stats(file_handle, range_threads, stats);
-            } else {
-                auto stats = threaded_alloc(num_threads, basic_alloc_free_impl);
-                print_stats(file_handle, stats);
-            }
-        } else {
-            auto stats = linear_growth_alloc();
-            print_stats(file_handle, stats);
-        }
+        run_test(results ? &*results : nullptr, "lin-growth-direct-free", backends, {basic_alloc_free_stream}, threaded, run_scaling, num_threads);
     }
 
     if (result["lin-growth-permuted-free"].as<bool>() || run_all) {
@@ -537,24 +823,7 @@ int main(int argc, char** argv)
         fmt::print("allocate a bunch at the beginning and then free it at the end\n\n");
         fmt::print("{:=^50}\n\n", "");
 
-        if (threaded) {
-            if (run_scaling) {
-                std::vector<std::vector<Stats>> stats;
-                stats.reserve(num_threads);
-
-                for (int nthreads = 1; nthreads <= num_threads; ++nthreads) {
-                    auto tmp_stats = threaded_alloc(num_threads, alloc_permuted_free_impl);
-                    stats.emplace_back(std::move(tmp_stats));
-                }
-                print_stats(file_handle, range_threads, stats);
-            } else {
-                auto stats = threaded_alloc(num_threads, alloc_permuted_free_impl);
-                print_stats(file_handle, stats);
-            }
-        } else {
-            auto stats = linear_growth_permuted_free();
-            print_stats(file_handle, stats);
-        }
+        run_test(results ? &*results : nullptr, "lin-growth-permuted-free", backends, {alloc_permuted_free_stream}, threaded, run_scaling, num_threads);
     }
 
     if (result["random-alloc-permuted-free"].as<bool>() || run_all) {
@@ -566,24 +835,7 @@ int main(int argc, char** argv)
         fmt::print("allocate a bunch at the beginning and then free it at the end\n\n");
         fmt::print("{:=^50}\n\n", "");
 
-        if (threaded) {
-            if (run_scaling) {
-                std::vector<std::vector<Stats>> stats;
-                stats.reserve(num_threads);
-
-                for (int nthreads = 1; nthreads <= num_threads; ++nthreads) {
-                    auto tmp_stats = threaded_alloc(num_threads, random_alloc_permuted_free_impl);
-                    stats.emplace_back(std::move(tmp_stats));
-                }
-                print_stats(file_handle, range_threads, stats);
-            } else {
-                auto stats = threaded_alloc(num_threads, random_alloc_permuted_free_impl);
-                print_stats(file_handle, stats);
-            }
-        } else {
-            auto stats = random_alloc_permuted_free();
-            print_stats(file_handle, stats);
-        }
+        run_test(results ? &*results : nullptr, "random-alloc-permuted-free", backends, {random_alloc_permuted_free_stream}, threaded, run_scaling, num_threads);
     }
 
     if (result["random-alloc-random-free"].as<bool>() || run_all) {
@@ -595,32 +847,206 @@ int main(int argc, char** argv)
         fmt::print("allocate a bunch and then free a part of it and then allocate again and so on\n\n");
         fmt::print("{:=^50}\n\n", "");
 
-        if (threaded) {
-            if (run_scaling) {
+        run_test(results ? &*results : nullptr, "random-alloc-random-free", backends, {random_alloc_random_free_stream}, threaded, run_scaling, num_threads);
+    }
+
+    if (result["realloc-growth"].as<bool>()) {
+        fmt::print("\n\n{:=^50}\n", "");
+        fmt::print("Grow 8 buffers in turns with realloc, by half of their size each step, up to the given size, ");
+        fmt::print("then free them\n\n");
+
+        fmt::print("Mimicks vectors and string builders which grow with realloc, the alloc time is the time ");
+        fmt::print("per realloc. A realloc which stays in place saves the copy\n\n");
+        fmt::print("{:=^50}\n\n", "");
+
+        run_test(results ? &*results : nullptr, "realloc-growth", backends, {realloc_growth_stream, AllocPath::plain, max_realloc_size_power},
+                 threaded, run_scaling, num_threads);
+    }
+
+    if (result["calloc"].as<bool>()) {
+        fmt::print("\n\n{:=^50}\n", "");
+        fmt::print("Allocate a fixed size with calloc and release it directly, up to {} times and 4 GB per size. ", repeat);
+        fmt::print("Allocations grow exponentionally\n\n");
+
+        fmt::print("Compare with lin-growth-direct-free for the cost of zeroing. Reused blocks have to be ");
+        fmt::print("cleared, fresh pages from the kernel are zero already\n\n");
+        fmt::print("{:=^50}\n\n", "");
+
+        run_test(results ? &*results : nullptr, "calloc-direct-free", backends, {zeroed_alloc_free_stream, AllocPath::calloc, max_calloc_size_power}, threaded,
+                 run_scaling, num_threads);
+    }
+
+    if (result["aligned"].as<bool>()) {
+        for (const auto& [path, alignment] : {std::pair{AllocPath::aligned_64, 64}, std::pair{AllocPath::aligned_4k, 4096}}) {
+            fmt::print("\n\n{:=^50}\n", "");
+            fmt::print("Allocate {} fixed size chunks aligned to {} bytes, randomly shuffle them, ", repeat, alignment);
+            fmt::print(" and free them in the new order\n\n");
+
+            fmt::print("Mimicks SIMD (64 bytes) and direct IO (4 KiB) buffers, small chunks pay for the ");
+            fmt::print("alignment with padding\n\n");
+            fmt::print("{:=^50}\n\n", "");
+
+            run_test(results ? &*results : nullptr, fmt::format("aligned-{}-permuted-free", alignment), backends,
+                     {alloc_permuted_free_stream, path}, threaded, run_scaling, num_threads);
+        }
+    }
+
+    if (result["sized-free"].as<bool>()) {
+        fmt::print("\n\n{:=^50}\n", "");
+        fmt::print("Same as random-alloc-random-free, but every chunk is freed with its size, ");
+        fmt::print("like sized operator delete\n\n");
+
+        fmt::print("Backends with a sized free can skip looking up the size class of the chunk. ");
+        fmt::print("Backends without one use free\n\n");
+        for (const auto& backend : backends) {
+            if (!backend.free_sized) {
+                fmt::print("{} has no sized free\n", backend.name);
+            }
+        }
+        fmt::print("{:=^50}\n\n", "");
+
+        run_test(results ? &*results : nullptr, "sized-free", backends, {random_alloc_random_free_stream, AllocPath::sized_free}, threaded,
+                 run_scaling, num_threads);
+    }
+
+    if (result["modeled"].as<bool>()) {
+        fmt::print("\n\n{:=^50}\n", "");
+        fmt::print("Allocate chunks with sizes from '{}', each one is freed after a lifetime ", result["sizes"].as<std::string>());
+        fmt::print("from '{}', counted in allocations\n\n", result["lifetimes"].as<std::string>());
+
+        fmt::print("Mimicks the heap of a service with the given profile. The rows are the number of ");
+        fmt::print("allocations, the times are per operation. What's live at the end is freed in the order of its lifetime\n\n");
+        fmt::print("{:=^50}\n\n", "");
+
+        run_test(results ? &*results : nullptr, "modeled", backends,
+                 {modeled_stream, AllocPath::plain, max_modeled_allocs_power, min_modeled_allocs_power, "Allocs"}, threaded, run_scaling, num_threads);
+    }
+
+    if (result["soak"].as<bool>()) {
+        SoakConfig config;
+        config.duration    = std::max(0.0, result["soak-duration"].as<double>());
+        config.interval    = std::max(0.01, result["soak-interval"].as<double>());
+        config.threads     = std::max(1, result["num-threads"].as<int>());
+        config.live_blocks = std::max(1L, result["soak-blocks"].as<long>());
+
+        fmt::print("\n\n{:=^50}\n", "");
+        fmt::print("Soak test: {} thread(s) keep replacing {} live blocks each with sizes from '{}', ", config.threads,
+                   config.live_blocks, result["sizes"].as<std::string>());
+        fmt::print("for {} seconds per backend\n\n", config.duration);
+
+        fmt::print("Every row covers the last {} seconds. Allocators whose heaps age show falling throughput, ", config.interval);
+        fmt::print("growing tail latencies or creeping RSS\n\n");
+        fmt::print("{:=^50}\n\n", "");
+
+        soak_alloc(backends, config, results ? &*results : nullptr);
+    }
+
+    if (result["memory-return"].as<bool>()) {
+        ReturnConfig config;
+        config.peak     = std::max(1L, result["return-peak"].as<long>()) * megabyte;
+        config.duration = std::max(0.0, result["return-duration"].as<double>());
+
+        fmt::print("\n\n{:=^50}\n", "");
+        fmt::print("Allocate and touch a working set, free it and follow the RSS, once idle and once with a trickle of ");
+        fmt::print("small allocations. Then time the explicit purge of the backend\n\n");
+
+        fmt::print("Kept is the RSS above the state before the working set at the end, 50% and 90% the seconds until ");
+        fmt::print("that much was returned. p99 are the allocation latencies in ns before and after the purge\n\n");
+        for (const auto& backend : backends) {
+            if (!backend.purge) {
+                fmt::print("{} has no explicit purge\n", backend.name);
+            }
+        }
+        fmt::print("{:=^50}\n\n", "");
+
+        memory_return(backends, config, results ? &*results : nullptr);
+    }
+
+    if (result["producer-consumer"].as<bool>()) {
+        PipelineConfig config;
+        config.producers = std::max(1, result["producers"].as<int>());
+        config.consumers = std::max(1, result["consumers"].as<int>());
+        config.batch     = std::max(1L, result["pc-batch"].as<long>());
+        config.messages  = std::max(1L, result["messages"].as<long>());
+
+        fmt::print("\n\n{:=^50}\n", "");
+        fmt::print("Producers allocate fixed size messages and pass them through a queue to consumers, ");
+        fmt::print("which free them. Every free happens in another thread than the alloc\n\n");
+
+        fmt::print("Mimicks pipelines and message passing servers, where the remote free path of ");
+        fmt::print("the allocator dominates\n\n");
+        fmt::print("{:=^50}\n\n", "");
+
+        auto stats = producer_consumer_alloc(backends, config);
+        if (results) {
+            results->record("producer-consumer", config.producers + config.consumers, backends, stats);
+        }
+    }
 
-                std::vector<std::vector<Stats>> stats;
-                stats.reserve(num_threads);
+    if (result["numa"].as<bool>()) {
+        const auto nodes = numa_topology();
 
-                for (int nthreads = 1; nthreads <= num_threads; ++nthreads) {
-                    auto tmp_stats = threaded_alloc(num_threads, random_alloc_random_permuted_free_impl);
-                    stats.emplace_back(std::move(tmp_stats));
+        fmt::print("\n\n{:=^50}\n", "");
+        fmt::print("Allocate on a thread of one NUMA node, touch and free the memory on a thread of another node, ");
+        fmt::print("then allocate again on the second node\n\n");
+
+        fmt::print("Shows where the backends place the pages (Local %) and whether memory freed by a remote ");
+        fmt::print("thread comes back to the local allocations (Reuse %)\n\n");
+        fmt::print("{} NUMA node(s) with CPUs, memory policy '{}'\n", nodes.size(), memory_policy_name());
+        for (const auto& node : nodes) {
+            fmt::print("  node {}: CPUs {}\n", node.id, fmt::join(node.cpus, ","));
+        }
+        fmt::print("{:=^50}\n\n", "");
+
+        for (const auto& alloc_node : nodes) {
+            for (const auto& free_node : nodes) {
+                auto stats = numa_alloc(backends, alloc_node, free_node);
+                if (results) {
+                    results->record(fmt::format("numa-{}-{}", alloc_node.id, free_node.id), 1, backends, stats);
                 }
+                fmt::print("\n");
+            }
+        }
+    }
 
-                print_stats(file_handle, range_threads, stats);
+    if (result["containers"].as<bool>()) {
+        const auto contenders = container_contenders(backends);
 
-            } else {
-                auto stats = threaded_alloc(num_threads, random_alloc_random_permuted_free_impl);
-                print_stats(file_handle, stats);
+        for (const auto& [workload, name] : container_workloads) {
+            fmt::print("\n\n{:=^50}\n", "");
+            fmt::print("Container test {}: build the containers, walk them once and destroy them, ", name);
+            fmt::print("with every backend as memory resource and the standard resources on top of {}\n", backends.front().name);
+            fmt::print("{:=^50}\n\n", "");
+
+            auto stats = container_alloc(contenders, workload);
+            if (results) {
+                std::vector<Backend> names;
+                for (const auto& c : contenders) {
+                    names.push_back(c.backend);
+                }
+                results->record(fmt::format("containers-{}", name), 1, names, stats);
             }
-        } else {
-            auto stats = random_alloc_random_permuted_free();
-            print_stats(file_handle, stats);
         }
     }
-    if (result["report"].as<bool>() && file_handle) {
-        std::fclose(file_handle);
+
+    if (result["locality"].as<bool>()) {
+        for (const auto& [structure, name] : locality_structures) {
+            for (const bool churned : {false, true}) {
+                fmt::print("\n\n{:=^50}\n", "");
+                fmt::print("Locality test {}{}: build it from 32 byte nodes, walk it once and destroy it\n\n", name,
+                           churned ? " after churn" : "");
+
+                fmt::print("Lines/n and Pages/n are the distinct cache lines and pages per node, 0.5 and 0.0078 at best. ");
+                fmt::print("Scattered nodes make the walk slower\n");
+                fmt::print("{:=^50}\n\n", "");
+
+                auto stats = locality_alloc(backends, structure, churned);
+                if (results) {
+                    results->record(fmt::format("locality-{}{}", name, churned ? "-churned" : ""), 1, backends, stats);
+                }
+            }
+        }
     }
 
-    return 0;
+    return compare_baseline(baseline, results ? &*results : nullptr, result["regression-threshold"].as<double>());
 }
-
@@ -0,0 +1,286 @@
+#include "memory_return.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+
+#include <fmt/format.h>
+
+#include <unistd.h>
+
+#include "memory_stats.h"
+#include "op_stream.h"
+#include "options.h"
+#include "timer.h"
+#include "util.h"
+
+namespace
+{
+    /// Sizes of the blocks of a working set
+    struct BlockRange {
+        std::size_t min;
+        std::size_t max;
+    };
+
+    /// Small blocks, which come from the heap of every backend, and large blocks around the mmap
+    /// threshold of glibc
+    constexpr std::array<BlockRange, 2> working_sets{{{16, 1024}, {32 * kilobyte, 512 * kilobyte}}};
+
+    /// RSS following the free of a working set
+    struct Decay {
+        /// RSS before the working set was allocated and with all of it allocated
+        std::size_t        before = 0;
+        std::size_t        peak   = 0;
+        std::size_t        bytes  = 0;
+        long               blocks = 0;
+        stdclock::duration free_elapsed{};
+        /// Seconds since the free and the RSS at that point
+        std::vector<std::pair<double, std::size_t>> series;
+
+        /// Seconds until the given fraction of the working set was returned, NaN if it never was
+        double returned_after(double fraction) const
+        {
+            const double target = peak - fraction * (peak - std::min(before, peak));
+            for (const auto& [seconds, rss] : series) {
+                if (rss <= target)
+                    return seconds;
+            }
+            return NAN;
+        }
+
+        /// RSS above the state before the working set at the end
+        std::size_t kept() const
+        {
+            const auto rss = series.empty() ? peak : series.back().second;
+            return rss > before ? rss - before : 0;
+        }
+    };
+
+    /// The explicit purge of a backend after a working set was freed
+    struct Purge {
+        fsec        elapsed{};
+        std::size_t before = 0;
+        std::size_t after  = 0;
+        /// Allocations right before and right after the purge
+        BackendStats warm;
+        BackendStats cold;
+    };
+
+    std::size_t current_rss()
+    {
+        return read_process_memory().rss;
+    }
+
+    /// Write one byte on every page of the block, so the whole block counts to the RSS
+    void touch_pages(void* block, std::size_t size)
+    {
+        static const std::size_t page_size = sysconf(_SC_PAGESIZE);
+
+        auto* bytes = static_cast<char*>(block);
+        for (std::size_t offset = 0; offset < size; offset += page_size) {
+            bytes[offset] = 1;
+        }
+        bytes[size - 1] = 1;
+        escape(block);
+    }
+
+    /// Allocate blocks of random size within range until peak bytes are live, untimed
+    std::vector<void*> build_working_set(const Backend& backend, BlockRange range, std::size_t peak, std::mt19937_64& gen, Decay& decay)
+    {
+        std::uniform_int_distribution<std::size_t> size_dist(range.min, range.max);
+
+        std::vector<void*> blocks;
+        while (decay.bytes < peak) {
+            const auto size = size_dist(gen);
+            void*      block = backend.malloc(size);
+            if (!block)
+                break;
+
+            touch_pages(block, size);
+            blocks.push_back(block);
+            decay.bytes += size;
+        }
+        decay.blocks = blocks.size();
+        return blocks;
+    }
+
+    /// Allocate and free count blocks of the range, the allocations are timed one by one
+    void trickle_load(const Backend& backend, BlockRange range, long count, std::mt19937_64& gen, BackendStats* result)
+    {
+        std::uniform_int_distribution<std::size_t> size_dist(range.min, range.max);
+
+        std::vector<void*> blocks(count);
+        for (auto& block : blocks) {
+            const auto size        = size_dist(gen);
+            auto       alloc_start = timer_start();
+            block                  = backend.malloc(size);
+            auto alloc_end         = timer_stop();
+            if (result) {
+                result->record_alloc(timer_elapsed(alloc_start, alloc_end));
+            }
+            if (block) {
+                touch_pages(block, size);
+            }
+        }
+        for (auto* block : blocks) {
+            backend.free(block);
+        }
+    }
+
+    /// Before is the RSS before the first working set of the backend, so what one phase keeps
+    /// counts against the next one
+    Decay follow_decay(const Backend& backend, BlockRange range, const ReturnConfig& config, bool trickle, std::size_t before,
+                       std::mt19937_64& gen)
+    {
+        Decay decay;
+        decay.before = before;
+
+        auto blocks = build_working_set(backend, range, config.peak, gen, decay);
+        decay.peak  = current_rss();
+
+        auto free_start = timer_start();
+        for (auto* block : blocks) {
+            backend.free(block);
+        }
+        auto free_end      = timer_stop();
+        decay.free_elapsed = timer_elapsed(free_start, free_end);
+
+        // The trickle of small blocks runs right after every sample, the idle backend is left alone
+        // until the next
+        const auto start = stdclock::now();
+        for (long i = 0; i * config.interval <= config.duration; ++i) {
+            std::this_thread::sleep_until(start + std::chrono::duration_cast<stdclock::duration>(fsec(i * config.interval)));
+            decay.series.emplace_back(fsec(stdclock::now() - start).count(), current_rss());
+
+            if (trickle) {
+                trickle_load(backend, working_sets[0], config.trickle, gen, nullptr);
+            }
+        }
+        return decay;
+    }
+
+    /// Phase boundary for backends which release in bulk
+    void release_phase(const Backend& backend)
+    {
+        if (backend.release) {
+            backend.release();
+        }
+    }
+
+    Purge measure_purge(const Backend& backend, BlockRange range, const ReturnConfig& config, std::mt19937_64& gen)
+    {
+        Purge purge;
+        trickle_load(backend, range, config.trickle, gen, &purge.warm);
+
+        purge.before     = current_rss();
+        auto purge_start = timer_start();
+        backend.purge();
+        auto purge_end = timer_stop();
+        purge.elapsed  = timer_elapsed(purge_start, purge_end);
+        purge.after    = current_rss();
+
+        trickle_load(backend, range, config.trickle, gen, &purge.cold);
+        return purge;
+    }
+
+    std::string seconds_or_dash(double seconds)
+    {
+        return std::isnan(seconds) ? std::string("-") : fmt::format("{:.2f}", seconds);
+    }
+
+    double to_mb(std::size_t bytes)
+    {
+        return static_cast<double>(bytes) / megabyte;
+    }
+
+    void print_return_header()
+    {
+        fmt::print("|{:-^12}|{:-^21}||{:-^29}||{:-^29}||{:-^41}||\n", "", "", "Idle", "Trickle", "Purge");
+        fmt::print("|{:^12}| {:^8} | {:^8} |", "Backend", "Peak MB", "Free ms");
+        for (int i = 0; i < 2; ++i) {
+            fmt::print("| {:^7} | {:^7} | {:^7} |", "Kept MB", "50% s", "90% s");
+        }
+        fmt::print("| {:^7} | {:^7} | {:^9} | {:^9} ||\n", "ms", "Kept MB", "p99 warm", "p99 after");
+    }
+
+    void print_return_row(const Backend& backend, const Decay& idle, const Decay& trickle, const Purge* purge)
+    {
+        fmt::print("| {:>10} | {:>8.1f} | {:>8.2f} |", backend.name, to_mb(idle.peak > idle.before ? idle.peak - idle.before : 0),
+                   fsec(idle.free_elapsed).count() * 1e3);
+        for (const auto* decay : {&idle, &trickle}) {
+            fmt::print("| {:>7.1f} | {:>7} | {:>7} |", to_mb(decay->kept()), seconds_or_dash(decay->returned_after(0.5)),
+                       seconds_or_dash(decay->returned_after(0.9)));
+        }
+        if (purge) {
+            fmt::print("| {:>7.2f} | {:>7.1f} | {:>9} | {:>9} ||\n", purge->elapsed.count() * 1e3,
+                       to_mb(purge->after > trickle.before ? purge->after - trickle.before : 0), purge->warm.alloc_latency.percentile(99),
+                       purge->cold.alloc_latency.percentile(99));
+        } else {
+            fmt::print("| {:>7} | {:>7} | {:>9} | {:>9} ||\n", "-", "-", "-", "-");
+        }
+    }
+
+    BackendStats decay_stats(const Decay& decay)
+    {
+        BackendStats result;
+        result.record_free(decay.free_elapsed, decay.blocks);
+        result.bytes                 = decay.bytes;
+        result.wall_elapsed          = fsec(decay.returned_after(0.9));
+        result.memory.samples        = decay.series.size();
+        result.memory.peak_requested = decay.bytes;
+        result.memory.peak_rss       = decay.peak > decay.before ? decay.peak - decay.before : 0;
+        result.memory.retained_rss   = decay.kept();
+        return result;
+    }
+} // namespace
+
+void memory_return(const std::vector<Backend>& backends, const ReturnConfig& config, ResultsWriter* results)
+{
+    for (const auto& range : working_sets) {
+        fmt::print("Working set of {} MB in blocks of {} to {} bytes, followed for {} seconds\n", config.peak / megabyte, range.min, range.max,
+                   config.duration);
+        print_return_header();
+
+        for (const auto& backend : backends) {
+            BackendThreadScope scope(backend);
+
+            // The same block sizes for every backend
+            std::mt19937_64 gen(stream_seed(static_cast<long>(range.max), 0));
+
+            const auto before = current_rss();
+
+            const auto idle = follow_decay(backend, range, config, false, before, gen);
+            release_phase(backend);
+            const auto trickle = follow_decay(backend, range, config, true, before, gen);
+            release_phase(backend);
+
+            std::optional<Purge> purge;
+            if (backend.purge) {
+                purge = measure_purge(backend, range, config, gen);
+            }
+
+            print_return_row(backend, idle, trickle, purge ? &*purge : nullptr);
+
+            if (results) {
+                const long size = range.max;
+                results->record("memory-return-idle", 1, {backend}, {Stats{size, {decay_stats(idle)}}});
+                results->record("memory-return-trickle", 1, {backend}, {Stats{size, {decay_stats(trickle)}}});
+
+                if (purge) {
+                    BackendStats stats        = purge->cold;
+                    stats.free_elapsed        = purge->elapsed;
+                    stats.memory.samples      = 2;
+                    stats.memory.peak_rss     = purge->before > trickle.before ? purge->before - trickle.before : 0;
+                    stats.memory.retained_rss = purge->after > trickle.before ? purge->after - trickle.before : 0;
+                    results->record("memory-return-purge", 1, {backend}, {Stats{size, {stats}}});
+                }
+            }
+        }
+        fmt::print("\n");
+    }
+}
@@ -0,0 +1,135 @@
+#include "memory_stats.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include "backend.h"
+
+namespace
+{
+    /// Read a small proc file into buf. This deliberately doesn't use iostreams, as their buffers
+    /// would come from the glibc heap which is measured at the same time
+    std::size_t read_proc_file(const char* path, char* buf, std::size_t size)
+    {
+        int fd = open(path, O_RDONLY);
+        if (fd < 0)
+            return 0;
+
+        std::size_t total = 0;
+        ssize_t     n;
+        while (total + 1 < size && (n = read(fd, buf + total, size - 1 - total)) > 0) {
+            total += n;
+        }
+        close(fd);
+
+        buf[total] = '\0';
+        return total;
+    }
+
+    /// Value of a "Key:   1234 kB" line in bytes
+    std::size_t kb_field(const char* text, const char* key)
+    {
+        const char* pos = std::strstr(text, key);
+        return pos ? std::strtoull(pos + std::strlen(key), nullptr, 10) * 1024 : 0;
+    }
+} // namespace
+
+ProcessMemory read_process_memory()
+{
+    ProcessMemory memory;
+    char          buf[4096];
+
+    if (read_proc_file("/proc/self/smaps_rollup", buf, sizeof(buf)) > 0) {
+        memory.rss       = kb_field(buf, "\nRss:");
+        memory.pss       = kb_field(buf, "\nPss:");
+        memory.anon_huge = kb_field(buf, "\nAnonHugePages:");
+        return memory;
+    }
+
+    if (read_proc_file("/proc/self/statm", buf, sizeof(buf)) > 0) {
+        char*      end      = nullptr;
+        const auto size     = std::strtoull(buf, &end, 10);
+        const auto resident = std::strtoull(end, nullptr, 10);
+
+        static_cast<void>(size);
+        memory.rss = resident * sysconf(_SC_PAGESIZE);
+        memory.pss = memory.rss;
+    }
+    return memory;
+}
+
+PageFaults read_thread_faults()
+{
+    rusage usage{};
+    if (getrusage(RUSAGE_THREAD, &usage) != 0)
+        return {};
+    return {usage.ru_minflt, usage.ru_majflt};
+}
+
+namespace
+{
+    std::size_t heap_mapped(const Backend& backend)
+    {
+        HeapStats heap;
+        if (backend.heap_stats && backend.heap_stats(heap)) {
+            return heap.mapped;
+        }
+        return 0;
+    }
+
+    std::size_t above(std::size_t value, std::size_t baseline)
+    {
+        return value > baseline ? value - baseline : 0;
+    }
+} // namespace
+
+MemoryTracker::MemoryTracker(const Backend& backend) : backend_(backend)
+{
+    baseline_      = read_process_memory();
+    baseline_heap_ = heap_mapped(backend_);
+}
+
+void MemoryTracker::sample(std::size_t live_bytes, bool steady)
+{
+    std::scoped_lock _(mtx_);
+
+    // Replace the previous contribution of this thread with the new one
+    live_bytes_       = live_bytes_ - thread_live_bytes + live_bytes;
+    thread_live_bytes = live_bytes;
+
+    const auto memory = read_process_memory();
+    const auto rss    = above(memory.rss, baseline_.rss);
+    const auto pss    = above(memory.pss, baseline_.pss);
+    const auto heap   = above(heap_mapped(backend_), baseline_heap_);
+    const auto huge   = above(memory.anon_huge, baseline_.anon_huge);
+
+    stats_.samples += 1;
+    stats_.peak_requested = std::max(stats_.peak_requested, live_bytes_);
+    stats_.peak_rss       = std::max(stats_.peak_rss, rss);
+    stats_.peak_pss       = std::max(stats_.peak_pss, pss);
+    stats_.peak_heap      = std::max(stats_.peak_heap, heap);
+    stats_.peak_anon_huge = std::max(stats_.peak_anon_huge, huge);
+
+    if (live_bytes_ > 0) {
+        const double overhead = static_cast<double>(rss) / live_bytes_;
+        stats_.peak_overhead  = std::max(stats_.peak_overhead, overhead);
+
+        if (steady) {
+            stats_.steady_overhead_sum += overhead;
+            stats_.steady_samples += 1;
+        }
+    }
+}
+
+MemoryStats MemoryTracker::finish()
+{
+    std::scoped_lock _(mtx_);
+
+    stats_.retained_rss = above(read_process_memory().rss, baseline_.rss);
+    return stats_;
+}
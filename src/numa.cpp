@@ -0,0 +1,297 @@
+#include "numa.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <map>
+#include <thread>
+
+#include <fmt/format.h>
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "options.h"
+#include "perf_counters.h"
+#include "print.h"
+#include "runner.h"
+#include "thread_pool.h"
+#include "timer.h"
+#include "topology.h"
+#include "util.h"
+
+namespace
+{
+    // From <numaif.h>, which is part of libnuma and not always installed
+    constexpr int mpol_default    = 0;
+    constexpr int mpol_preferred  = 1;
+    constexpr int mpol_bind       = 2;
+    constexpr int mpol_interleave = 3;
+    constexpr int mpol_local      = 4;
+    constexpr int mpol_f_node     = 1 << 0;
+    constexpr int mpol_f_addr     = 1 << 1;
+
+    long get_mempolicy(int* mode, unsigned long* nodemask, unsigned long maxnode, void* addr, unsigned long flags)
+    {
+        return syscall(SYS_get_mempolicy, mode, nodemask, maxnode, addr, flags);
+    }
+
+    long move_pages(unsigned long count, void** pages, int* status)
+    {
+        // Without target nodes, move_pages only reports where the pages are
+        return syscall(SYS_move_pages, 0, count, pages, nullptr, status, 0);
+    }
+
+    long page_size()
+    {
+        static const long size = sysconf(_SC_PAGESIZE);
+        return size;
+    }
+
+    /// Write one byte on every page of the blocks, so they are faulted in. Returns the number of pages
+    long touch_pages(const std::vector<std::byte*>& blocks, long N)
+    {
+        long pages = 0;
+        for (auto* block : blocks) {
+            if (!block)
+                continue;
+
+            for (long offset = 0; offset < N; offset += page_size()) {
+                block[offset] = std::byte{1};
+                ++pages;
+            }
+            escape(block);
+        }
+        return pages;
+    }
+
+    /// Allocate count blocks of N bytes, timed in batches
+    void allocate(const Backend& backend, long N, std::vector<std::byte*>& blocks, BackendStats* result)
+    {
+        const long count = blocks.size();
+        for (long i = 0; i < count; i += timer_batch_size) {
+            const long batch = std::min(timer_batch_size, count - i);
+
+            phase_begin(Phase::alloc);
+            auto alloc_start = timer_start();
+            for (long j = i; j < i + batch; ++j) {
+                blocks[j] = static_cast<std::byte*>(backend.malloc(N));
+            }
+            auto alloc_end = timer_stop();
+            phase_end(Phase::alloc);
+
+            if (result) {
+                result->record_alloc(timer_elapsed(alloc_start, alloc_end), batch);
+            }
+        }
+    }
+
+    /// Free all blocks, timed in batches
+    void release(const Backend& backend, std::vector<std::byte*>& blocks, BackendStats* result)
+    {
+        const long count = blocks.size();
+        for (long i = 0; i < count; i += timer_batch_size) {
+            const long batch = std::min(timer_batch_size, count - i);
+
+            phase_begin(Phase::free);
+            auto free_start = timer_start();
+            for (long j = i; j < i + batch; ++j) {
+                backend.free(blocks[j]);
+            }
+            auto free_end = timer_stop();
+            phase_end(Phase::free);
+
+            if (result) {
+                result->record_free(timer_elapsed(free_start, free_end), batch);
+            }
+        }
+    }
+
+    /// Run f in a new thread pinned to the CPUs of node and wait for it
+    template <typename F>
+    void run_on(const NumaNode& node, const Backend& backend, F&& f)
+    {
+        std::thread t([&] {
+            pin_current_thread(node.cpus);
+            BackendThreadScope scope(backend);
+            f();
+        });
+        t.join();
+    }
+
+    BackendStats numa_round(const Backend& backend, long N, const NumaNode& alloc_node, const NumaNode& free_node)
+    {
+        // Enough blocks to span many pages, without holding more than 256 MB
+        const long count = std::clamp(256 * megabyte / N, 1L, static_cast<long>(repeat));
+
+        BackendStats            result;
+        std::vector<std::byte*> blocks(count);
+
+        run_on(alloc_node, backend, [&] {
+            ThreadPerfCounters counters(use_perf_counters);
+            PerfCounts         unused;
+
+            allocate(backend, N, blocks, &result);
+
+            // First touch happens here, so a NUMA aware allocator has them on alloc_node
+            touch_pages(blocks, N);
+            result.first_placement = page_placement(blocks, N, alloc_node.id);
+
+            counters.read(result.alloc_counters, unused);
+        });
+
+        run_on(free_node, backend, [&] {
+            ThreadPerfCounters counters(use_perf_counters);
+            PerfCounts         unused;
+
+            auto touch_start = timer_start();
+            result.touched_pages += touch_pages(blocks, N);
+            auto touch_end = timer_stop();
+            result.touch_elapsed += timer_elapsed(touch_start, touch_end);
+
+            release(backend, blocks, &result);
+            counters.read(unused, result.free_counters);
+
+            // Phase boundary for backends which release in bulk, nothing of the first thread is
+            // live any more
+            if (backend.release) {
+                backend.release();
+            }
+
+            // Memory freed by a remote thread may come back to this node's allocations
+            allocate(backend, N, blocks, nullptr);
+            touch_pages(blocks, N);
+            result.reuse_placement = page_placement(blocks, N, free_node.id);
+            release(backend, blocks, nullptr);
+
+            if (backend.release) {
+                backend.release();
+            }
+        });
+
+        result.bytes = count * N;
+        return result;
+    }
+} // namespace
+
+std::vector<NumaNode> numa_topology()
+{
+    std::map<int, std::vector<int>> cpus;
+    for (const auto& c : read_cpu_topology()) {
+        cpus[c.node].push_back(c.cpu);
+    }
+
+    std::vector<NumaNode> nodes;
+    for (auto& [id, list] : cpus) {
+        nodes.push_back({id, std::move(list)});
+    }
+
+    if (nodes.empty()) {
+        nodes.push_back({0, {}});
+    }
+    return nodes;
+}
+
+std::string memory_policy_name()
+{
+    int mode = 0;
+    if (get_mempolicy(&mode, nullptr, 0, nullptr, 0) != 0) {
+        return errno == ENOSYS ? "unsupported" : "unknown";
+    }
+
+    switch (mode) {
+    case mpol_default:
+        return "default";
+    case mpol_preferred:
+        return "preferred";
+    case mpol_bind:
+        return "bind";
+    case mpol_interleave:
+        return "interleave";
+    case mpol_local:
+        return "local";
+    default:
+        return fmt::format("mode {}", mode);
+    }
+}
+
+PagePlacement page_placement(const std::vector<std::byte*>& blocks, long N, int local_node)
+{
+    // Small blocks share pages, so every page is only asked for once
+    std::vector<void*> pages;
+    for (auto* block : blocks) {
+        if (!block)
+            continue;
+
+        const auto first = reinterpret_cast<std::uintptr_t>(block) & ~(page_size() - 1);
+        const auto last  = reinterpret_cast<std::uintptr_t>(block) + N - 1;
+        for (auto page = first; page <= last; page += page_size()) {
+            pages.push_back(reinterpret_cast<void*>(page));
+        }
+    }
+
+    std::sort(pages.begin(), pages.end());
+    pages.erase(std::unique(pages.begin(), pages.end()), pages.end());
+
+    std::vector<int> status(pages.size(), -1);
+    if (!pages.empty() && move_pages(pages.size(), pages.data(), status.data()) != 0) {
+        for (std::size_t i = 0; i < pages.size(); ++i) {
+            int node = -1;
+            if (get_mempolicy(&node, nullptr, 0, pages[i], mpol_f_node | mpol_f_addr) != 0) {
+                node = -1;
+            }
+            status[i] = node;
+        }
+    }
+
+    PagePlacement placement;
+    for (int node : status) {
+        if (node < 0) {
+            ++placement.unknown;
+        } else if (node == local_node) {
+            ++placement.local;
+        } else {
+            ++placement.remote;
+        }
+    }
+    return placement;
+}
+
+std::vector<Stats> numa_alloc(const std::vector<Backend>& backends, const NumaNode& alloc_node, const NumaNode& free_node)
+{
+    fmt::print("Allocate on node {}, touch and free on node {}\n\n", alloc_node.id, free_node.id);
+
+    print_numa_header(backends);
+
+    std::vector<Stats> statistics;
+    statistics.reserve(max_numa_size_power);
+
+    for (long n = 1; n <= max_numa_size_power; ++n) {
+        long N = std::pow(2, n);
+
+        Stats stats{N, {}};
+        stats.backends.reserve(backends.size());
+
+        for (const auto& backend : backends) {
+            stats.backends.push_back(run_trials([&] { return numa_round(backend, N, alloc_node, free_node); }));
+        }
+
+        print_numa_round(N, stats.backends, print_round_time);
+
+        statistics.emplace_back(std::move(stats));
+    }
+
+    if (print_trial_summary) {
+        print_trials(backends, statistics);
+    }
+
+    if (print_latency_percentiles) {
+        print_latencies(backends, statistics);
+    }
+
+    if (use_perf_counters) {
+        print_perf_counters(backends, statistics);
+    }
+
+    return statistics;
+}
@@ -0,0 +1,301 @@
+#include "op_stream.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <random>
+
+#include <unistd.h>
+
+#include "options.h"
+
+void OpStream::push(OpKind kind, std::uint32_t slot, std::uint64_t size)
+{
+    if (batches.empty() || batches.back().count == 0 || batches.back().kind != kind
+        || batches.back().count >= static_cast<std::uint64_t>(timer_batch_size)) {
+        batches.push_back({kind, false, 0, 0});
+    }
+    ++batches.back().count;
+
+    ops.push_back({size, slot, kind});
+    if (kind == OpKind::alloc) {
+        requested += size;
+    }
+    num_slots = std::max<std::size_t>(num_slots, slot + 1);
+}
+
+void OpStream::sample(std::uint64_t live_bytes, bool steady)
+{
+    // Only worth a batch if someone listens
+    if (track_memory) {
+        batches.push_back({OpKind::alloc, steady, 0, live_bytes});
+    }
+}
+
+bool parse_touch_policy(std::string_view name, TouchPolicy& policy)
+{
+    if (name == "none") {
+        policy = TouchPolicy::none;
+    } else if (name == "page") {
+        policy = TouchPolicy::page;
+    } else if (name == "memset") {
+        policy = TouchPolicy::memset;
+    } else if (name == "stream") {
+        policy = TouchPolicy::stream;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+long touch_block(void* block, std::size_t size)
+{
+    static const std::size_t page_size = sysconf(_SC_PAGESIZE);
+
+    if (!block || size == 0)
+        return 0;
+
+    auto* bytes = static_cast<char*>(block);
+
+    // Pages the block spans, a small block shares its page with others
+    const auto first = reinterpret_cast<std::uintptr_t>(bytes) / page_size;
+    const auto last  = (reinterpret_cast<std::uintptr_t>(bytes) + size - 1) / page_size;
+
+    switch (touch_policy) {
+    case TouchPolicy::none:
+        return 0;
+    case TouchPolicy::page:
+        for (std::size_t offset = 0; offset < size; offset += page_size) {
+            bytes[offset] = 1;
+        }
+        break;
+    case TouchPolicy::memset:
+        std::memset(bytes, 1, size);
+        break;
+    case TouchPolicy::stream: {
+#if defined(__SSE2__)
+        // Plain stores up to the first and after the last 16 byte boundary
+        auto* aligned = reinterpret_cast<char*>((reinterpret_cast<std::uintptr_t>(bytes) + 15) & ~std::uintptr_t(15));
+        auto* end     = bytes + size;
+        if (aligned >= end) {
+            std::memset(bytes, 1, size);
+            break;
+        }
+        std::memset(bytes, 1, aligned - bytes);
+
+        const __m128i ones = _mm_set1_epi8(1);
+        for (; aligned + 16 <= end; aligned += 16) {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(aligned), ones);
+        }
+        std::memset(aligned, 1, end - aligned);
+        _mm_sfence();
+#else
+        std::memset(bytes, 1, size);
+#endif
+        break;
+    }
+    }
+
+    escape(block);
+    return static_cast<long>(last - first + 1);
+}
+
+StopSignal::~StopSignal()
+{
+    if (timer_.joinable()) {
+        timer_.join();
+    }
+}
+
+void StopSignal::arm(double seconds)
+{
+    timer_ = std::thread([this, seconds] {
+        std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+        stopped_.store(true, std::memory_order_relaxed);
+    });
+}
+
+std::uint64_t stream_seed(long ipow, int thread_id)
+{
+    std::seed_seq seq{static_cast<std::uint32_t>(workload_seed), static_cast<std::uint32_t>(workload_seed >> 32),
+                      static_cast<std::uint32_t>(ipow), static_cast<std::uint32_t>(thread_id)};
+
+    std::uint32_t seed[2];
+    seq.generate(seed, seed + 2);
+    return (static_cast<std::uint64_t>(seed[0]) << 32) | seed[1];
+}
+
+namespace
+{
+    /// Allocate count chunks of N bytes, each one is freed right away
+    OpStream alloc_free_stream(std::uint64_t N, long count)
+    {
+        OpStream stream;
+        stream.ops.reserve(2 * count);
+
+        // With batching, timer_batch_size buffers are allocated and then freed again
+        for (long i = 0; i < count; i += timer_batch_size) {
+            const long batch = std::min(timer_batch_size, count - i);
+
+            for (long j = 0; j < batch; ++j) {
+                stream.push(OpKind::alloc, j, N);
+            }
+            stream.sample(N * batch, true);
+            for (long j = 0; j < batch; ++j) {
+                stream.push(OpKind::free, j);
+            }
+        }
+
+        return stream;
+    }
+} // namespace
+
+OpStream basic_alloc_free_stream(long ipow, std::uint64_t)
+{
+    return alloc_free_stream(1UL << ipow, repeat);
+}
+
+OpStream zeroed_alloc_free_stream(long ipow, std::uint64_t)
+{
+    // Allocators which clear every block write all of it, so the large sizes run less often
+    const std::uint64_t N = 1UL << ipow;
+    return alloc_free_stream(N, std::clamp<long>(4 * gigabyte / N, 1, repeat));
+}
+
+OpStream alloc_permuted_free_stream(long ipow, std::uint64_t seed)
+{
+    const std::uint64_t N = 1UL << ipow;
+
+    OpStream stream;
+    stream.ops.reserve(2 * repeat);
+
+    for (long i = 0; i < repeat; ++i) {
+        stream.push(OpKind::alloc, i, N);
+    }
+
+    // Everything is allocated, so this is the peak
+    stream.sample(N * repeat, false);
+
+    std::vector<std::uint32_t> order(repeat);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), std::mt19937_64{seed});
+
+    for (auto slot : order) {
+        stream.push(OpKind::free, slot);
+    }
+
+    return stream;
+}
+
+OpStream random_alloc_permuted_free_stream(long ipow, std::uint64_t seed)
+{
+    std::mt19937_64                              gen(seed);
+    std::uniform_int_distribution<std::uint64_t> size_dist(1UL << (ipow - 1), 1UL << (ipow + 1));
+
+    OpStream stream;
+    stream.ops.reserve(2 * repeat);
+
+    for (long i = 0; i < repeat; ++i) {
+        stream.push(OpKind::alloc, i, size_dist(gen));
+    }
+
+    // Everything is allocated, so this is the peak
+    stream.sample(stream.requested, false);
+
+    std::vector<std::uint32_t> order(repeat);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), gen);
+
+    for (auto slot : order) {
+        stream.push(OpKind::free, slot);
+    }
+
+    return stream;
+}
+
+OpStream random_alloc_random_free_stream(long ipow, std::uint64_t seed)
+{
+    std::mt19937_64                              gen(seed);
+    std::uniform_int_distribution<std::uint64_t> size_dist(1UL << (ipow - 1), 1UL << (ipow + 1));
+    std::uniform_int_distribution<>              alloc_dist(min_num_random_allocs, max_num_random_allocs);
+
+    OpStream stream;
+
+    // Live slots with their size, slots of freed chunks are handed out again first
+    std::vector<std::pair<std::uint32_t, std::uint64_t>> live;
+    std::vector<std::uint32_t>                           unused;
+    std::uint64_t                                        live_bytes = 0;
+
+    for (long i = 0; i < repeat; ++i) {
+        const auto num_allocs = alloc_dist(gen);
+
+        for (int j = 0; j < num_allocs; ++j) {
+            std::uint32_t slot = live.size() + unused.size();
+            if (!unused.empty()) {
+                slot = unused.back();
+                unused.pop_back();
+            }
+
+            const auto size = size_dist(gen);
+            stream.push(OpKind::alloc, slot, size);
+            live.emplace_back(slot, size);
+            live_bytes += size;
+        }
+
+        // The second half of the rounds is considered steady state
+        stream.sample(live_bytes, i >= repeat / 2);
+
+        // Free a random number of the live chunks in random order
+        std::shuffle(live.begin(), live.end(), gen);
+        const auto num_frees = std::uniform_int_distribution<std::size_t>(0, live.size())(gen);
+
+        for (std::size_t j = 0; j < num_frees; ++j) {
+            stream.push(OpKind::free, live[j].first);
+            unused.push_back(live[j].first);
+            live_bytes -= live[j].second;
+        }
+        live.erase(live.begin(), live.begin() + num_frees);
+    }
+
+    // Clean up, free all remaining chunks
+    for (const auto& [slot, size] : live) {
+        stream.push(OpKind::free, slot);
+    }
+
+    return stream;
+}
+
+OpStream realloc_growth_stream(long ipow, std::uint64_t)
+{
+    constexpr std::uint32_t buffers = 8;
+
+    const std::uint64_t N = 1UL << ipow;
+
+    // Moving reallocs copy everything, so the large sizes run less rounds
+    const long rounds = std::clamp<long>(256 * megabyte / (buffers * N), 1, repeat);
+
+    OpStream stream;
+
+    for (long r = 0; r < rounds; ++r) {
+        std::uint64_t size = std::min<std::uint64_t>(16, N);
+        for (std::uint32_t b = 0; b < buffers; ++b) {
+            stream.push(OpKind::alloc, b, size);
+        }
+
+        // All buffers grow in turns, so each one has the others as neighbours
+        while (size < N) {
+            size = std::min(N, (size + size / 2 + 15) & ~std::uint64_t(15));
+            for (std::uint32_t b = 0; b < buffers; ++b) {
+                stream.push(OpKind::realloc, b, size);
+            }
+        }
+
+        stream.sample(buffers * N, false);
+
+        for (std::uint32_t b = 0; b < buffers; ++b) {
+            stream.push(OpKind::free, b);
+        }
+    }
+
+    return stream;
+}
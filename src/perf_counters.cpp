@@ -0,0 +1,187 @@
+#include "perf_counters.h"
+
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+namespace
+{
+    int perf_event_paranoid()
+    {
+        std::ifstream file("/proc/sys/kernel/perf_event_paranoid");
+        int           level = 2;
+        file >> level;
+        return level;
+    }
+
+    perf_event_attr attr_for(PerfEvent event)
+    {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+
+        constexpr auto cache_miss = [](std::uint64_t cache) {
+            return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        };
+
+        switch (event) {
+            case perf_cycles:
+                attr.type   = PERF_TYPE_HARDWARE;
+                attr.config = PERF_COUNT_HW_CPU_CYCLES;
+                break;
+            case perf_instructions:
+                attr.type   = PERF_TYPE_HARDWARE;
+                attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+                break;
+            case perf_l1d_misses:
+                attr.type   = PERF_TYPE_HW_CACHE;
+                attr.config = cache_miss(PERF_COUNT_HW_CACHE_L1D);
+                break;
+            case perf_llc_misses:
+                attr.type   = PERF_TYPE_HARDWARE;
+                attr.config = PERF_COUNT_HW_CACHE_MISSES;
+                break;
+            case perf_dtlb_misses:
+                attr.type   = PERF_TYPE_HW_CACHE;
+                attr.config = cache_miss(PERF_COUNT_HW_CACHE_DTLB);
+                break;
+            case perf_page_faults:
+                attr.type   = PERF_TYPE_SOFTWARE;
+                attr.config = PERF_COUNT_SW_PAGE_FAULTS;
+                break;
+            case perf_context_switches:
+                attr.type   = PERF_TYPE_SOFTWARE;
+                attr.config = PERF_COUNT_SW_CONTEXT_SWITCHES;
+                break;
+            default:
+                break;
+        }
+
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        attr.disabled    = 1;
+        attr.exclude_hv  = 1;
+
+        // Above level 1 unprivileged users may only measure user space
+        static const bool user_only = perf_event_paranoid() > 1 && geteuid() != 0;
+        attr.exclude_kernel         = user_only;
+
+        return attr;
+    }
+
+    int open_event(perf_event_attr& attr, int group_fd)
+    {
+        // Count the calling thread on any cpu
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+    }
+
+    void warn_once(std::string_view what)
+    {
+        static std::once_flag flag;
+        std::call_once(flag, [&] {
+            fmt::print("Some performance counters are not available ({}), check /proc/sys/kernel/perf_event_paranoid\n", what);
+        });
+    }
+} // namespace
+
+PerfCounters::PerfCounters()
+{
+    for (auto& group : groups_) {
+        group.fds.fill(-1);
+
+        for (int e = 0; e < perf_event_count; ++e) {
+            auto attr = attr_for(static_cast<PerfEvent>(e));
+            int  fd   = open_event(attr, group.leader);
+
+            if (fd < 0) {
+                warn_once(fmt::format("{}: {}", perf_event_names[e], std::strerror(errno)));
+                continue;
+            }
+
+            ioctl(fd, PERF_EVENT_IOC_ID, &group.ids[e]);
+            group.fds[e] = fd;
+
+            if (group.leader < 0) {
+                group.leader = fd;
+            }
+        }
+    }
+}
+
+PerfCounters::~PerfCounters()
+{
+    if (thread_counters == this) {
+        thread_counters = nullptr;
+    }
+
+    for (auto& group : groups_) {
+        for (int fd : group.fds) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+    }
+}
+
+void PerfCounters::enable(Phase phase)
+{
+    const auto& group = groups_[static_cast<int>(phase)];
+    if (group.leader >= 0) {
+        ioctl(group.leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+}
+
+void PerfCounters::disable(Phase phase)
+{
+    const auto& group = groups_[static_cast<int>(phase)];
+    if (group.leader >= 0) {
+        ioctl(group.leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    }
+}
+
+PerfCounts PerfCounters::read(Phase phase) const
+{
+    PerfCounts counts;
+
+    const auto& group = groups_[static_cast<int>(phase)];
+    if (group.leader < 0)
+        return counts;
+
+    // Layout of PERF_FORMAT_GROUP: nr, time_enabled, time_running, then {value, id} per event
+    std::vector<std::uint64_t> buffer(3 + 2 * perf_event_count);
+    if (::read(group.leader, buffer.data(), buffer.size() * sizeof(std::uint64_t)) <= 0)
+        return counts;
+
+    const auto nr           = buffer[0];
+    const auto time_enabled = buffer[1];
+    const auto time_running = buffer[2];
+
+    // A group which never got onto the PMU (multiplexed out, the other PMU of a hybrid CPU, a VM)
+    // counted nothing, which isn't a count of zero
+    if (time_running == 0)
+        return counts;
+
+    // If the group didn't fit on the PMU all the time, extrapolate
+    const double scale = static_cast<double>(time_enabled) / time_running;
+
+    for (std::uint64_t i = 0; i < nr; ++i) {
+        const auto value = buffer[3 + 2 * i];
+        const auto id    = buffer[3 + 2 * i + 1];
+
+        for (int e = 0; e < perf_event_count; ++e) {
+            if (group.fds[e] >= 0 && group.ids[e] == id) {
+                counts.values[e]    = static_cast<std::uint64_t>(value * scale);
+                counts.available[e] = true;
+            }
+        }
+    }
+
+    return counts;
+}
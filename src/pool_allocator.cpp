@@ -0,0 +1,398 @@
+#include "pool_allocator.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include <sys/mman.h>
+
+#include "queue.h"
+
+namespace
+{
+    /// The first bytes of every superblock and every direct mapping
+    struct Superblock {
+        std::uint32_t size_class;
+        std::size_t   mapping_size;
+    };
+
+    constexpr std::size_t   superblock_header = 64;
+    constexpr std::uint32_t large_class       = UINT32_MAX;
+
+    /// A batch of free blocks on its way between a thread cache and the depot. Magazines are never
+    /// released, so a stale pointer in a concurrent pop is always safe to read
+    struct Magazine {
+        Magazine*     next;
+        std::uint32_t count;
+        void*         blocks[1];
+    };
+
+    /// Treiber stack of magazines. The upper 16 bits of the head count the changes, which keeps a
+    /// pop from succeeding after the same magazine was popped and pushed again in between (ABA).
+    /// User space addresses fit in the lower 48 bits on x86-64 and AArch64
+    class MagazineStack
+    {
+    public:
+        void push(Magazine* magazine)
+        {
+            auto head = head_.load(std::memory_order_relaxed);
+            do {
+                magazine->next = pointer(head);
+            } while (!head_.compare_exchange_weak(head, tagged(magazine, head), std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        Magazine* pop()
+        {
+            auto head = head_.load(std::memory_order_acquire);
+            while (pointer(head)) {
+                if (head_.compare_exchange_weak(head, tagged(pointer(head)->next, head), std::memory_order_acquire, std::memory_order_acquire))
+                    return pointer(head);
+            }
+            return nullptr;
+        }
+
+    private:
+        static constexpr std::uint64_t pointer_mask = (std::uint64_t(1) << 48) - 1;
+
+        static Magazine* pointer(std::uint64_t head) { return reinterpret_cast<Magazine*>(head & pointer_mask); }
+
+        static std::uint64_t tagged(Magazine* magazine, std::uint64_t previous)
+        {
+            return ((previous & ~pointer_mask) + (pointer_mask + 1)) | reinterpret_cast<std::uint64_t>(magazine);
+        }
+
+        alignas(cache_line_size) std::atomic<std::uint64_t> head_{0};
+    };
+
+    /// Size classes, settings and the depot shared by all threads
+    struct Pool {
+        Pool()
+        {
+            cache_size = std::max(1, pool_cache_size);
+            batch_size = std::clamp(pool_batch_size, 1, cache_size);
+
+            for (std::size_t p = 16; p <= pool_max_class_size; p *= 2) {
+                for (std::size_t q = 0; q < (pool_spacing == PoolSpacing::quarter ? 4 : 1); ++q) {
+                    // Everything stays 16 byte aligned, which merges the first quarter steps
+                    const std::size_t size = (p + q * p / 4 + 15) & ~std::size_t(15);
+                    if (size <= pool_max_class_size && (class_sizes.empty() || size > class_sizes.back())) {
+                        class_sizes.push_back(size);
+                    }
+                }
+            }
+
+            for (std::size_t i = 0; i < small_classes.size(); ++i) {
+                small_classes[i] = std::lower_bound(class_sizes.begin(), class_sizes.end(), i * 16) - class_sizes.begin();
+            }
+
+            full = std::make_unique<MagazineStack[]>(class_sizes.size());
+        }
+
+        std::uint32_t class_of(std::size_t size) const
+        {
+            if (size <= 1024)
+                return small_classes[(size + 15) / 16];
+            if (size > pool_max_class_size)
+                return large_class;
+            return std::lower_bound(class_sizes.begin(), class_sizes.end(), size) - class_sizes.begin();
+        }
+
+        Magazine* empty_magazine()
+        {
+            if (auto* magazine = empty.pop())
+                return magazine;
+            return static_cast<Magazine*>(std::malloc(sizeof(Magazine) + (batch_size - 1) * sizeof(void*)));
+        }
+
+        int                              cache_size;
+        int                              batch_size;
+        std::vector<std::size_t>         class_sizes;
+        std::array<std::uint32_t, 65>    small_classes;
+        std::unique_ptr<MagazineStack[]> full;
+        MagazineStack                    empty;
+
+        std::atomic<std::size_t> mapped{0};
+    };
+
+    Pool& pool()
+    {
+        static Pool instance;
+        return instance;
+    }
+
+    Superblock* superblock_of(const void* ptr)
+    {
+        return reinterpret_cast<Superblock*>(reinterpret_cast<std::uintptr_t>(ptr) & ~(pool_superblock_size - 1));
+    }
+
+    /// Map size bytes (a multiple of the page size) aligned to the superblock size
+    Superblock* map_superblock(std::size_t size, std::uint32_t size_class)
+    {
+        const std::size_t padded = size + pool_superblock_size;
+
+        void* memory = mmap(nullptr, padded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (memory == MAP_FAILED)
+            return nullptr;
+
+        // Cut off what's outside of the aligned range
+        const auto start   = reinterpret_cast<std::uintptr_t>(memory);
+        const auto aligned = (start + pool_superblock_size - 1) & ~(pool_superblock_size - 1);
+        if (aligned > start) {
+            munmap(memory, aligned - start);
+        }
+        if (start + padded > aligned + size) {
+            munmap(reinterpret_cast<void*>(aligned + size), start + padded - aligned - size);
+        }
+
+        pool().mapped.fetch_add(size, std::memory_order_relaxed);
+        return new (reinterpret_cast<void*>(aligned)) Superblock{size_class, size};
+    }
+
+    /// Blocks above the largest class get a mapping of their own, the block starts at offset
+    void* map_large(std::size_t size, std::size_t offset)
+    {
+        const std::size_t mapping = (offset + size + 4095) & ~std::size_t(4095);
+        if (mapping < size)
+            return nullptr;
+
+        auto* superblock = map_superblock(mapping, large_class);
+        return superblock ? reinterpret_cast<char*>(superblock) + offset : nullptr;
+    }
+
+    void unmap_large(Superblock* superblock)
+    {
+        pool().mapped.fetch_sub(superblock->mapping_size, std::memory_order_relaxed);
+        munmap(superblock, superblock->mapping_size);
+    }
+
+    /// The free blocks a thread keeps per size class, and the rest of the superblock it carves new
+    /// blocks from. What's left of that superblock is lost when the thread exits
+    class ThreadCache
+    {
+    public:
+        ThreadCache() : pool_(pool()), classes_(pool_.class_sizes.size()), blocks_(classes_.size() * pool_.cache_size)
+        {
+            for (std::size_t c = 0; c < classes_.size(); ++c) {
+                classes_[c].blocks = blocks_.data() + c * pool_.cache_size;
+            }
+        }
+
+        ~ThreadCache() { flush(); }
+
+        void* allocate(std::uint32_t size_class)
+        {
+            auto& cache = classes_[size_class];
+            if (cache.count == 0 && !refill(size_class))
+                return nullptr;
+            return cache.blocks[--cache.count];
+        }
+
+        void deallocate(void* ptr, std::uint32_t size_class)
+        {
+            auto& cache = classes_[size_class];
+            if (cache.count == static_cast<std::uint32_t>(pool_.cache_size)) {
+                hand_back(size_class, pool_.batch_size);
+                // No magazine for the batch, the block is lost
+                if (cache.count == static_cast<std::uint32_t>(pool_.cache_size))
+                    return;
+            }
+            cache.blocks[cache.count++] = ptr;
+        }
+
+        /// Hand all cached blocks back to the depot
+        void flush()
+        {
+            for (std::uint32_t c = 0; c < classes_.size(); ++c) {
+                while (classes_[c].count > 0) {
+                    hand_back(c, std::min<std::uint32_t>(classes_[c].count, pool_.batch_size));
+                }
+            }
+        }
+
+    private:
+        struct ClassCache {
+            void**        blocks = nullptr;
+            std::uint32_t count  = 0;
+            char*         carve  = nullptr;
+            char*         end    = nullptr;
+        };
+
+        /// Take a batch from the depot, or carve one from the superblock of the thread
+        bool refill(std::uint32_t size_class)
+        {
+            auto& cache = classes_[size_class];
+
+            if (auto* magazine = pool_.full[size_class].pop()) {
+                std::copy(magazine->blocks, magazine->blocks + magazine->count, cache.blocks);
+                cache.count = magazine->count;
+                pool_.empty.push(magazine);
+                return true;
+            }
+
+            const std::size_t size = pool_.class_sizes[size_class];
+            if (cache.carve + size > cache.end) {
+                auto* superblock = map_superblock(pool_superblock_size, size_class);
+                if (!superblock)
+                    return false;
+
+                cache.carve = reinterpret_cast<char*>(superblock) + superblock_header;
+                cache.end   = reinterpret_cast<char*>(superblock) + pool_superblock_size;
+            }
+
+            while (cache.count < static_cast<std::uint32_t>(pool_.batch_size) && cache.carve + size <= cache.end) {
+                cache.blocks[cache.count++] = cache.carve;
+                cache.carve += size;
+            }
+            return true;
+        }
+
+        /// Move count blocks from the top of the cache to the depot
+        void hand_back(std::uint32_t size_class, std::uint32_t count)
+        {
+            auto& cache    = classes_[size_class];
+            auto* magazine = pool_.empty_magazine();
+            if (!magazine)
+                return;
+
+            cache.count -= count;
+            std::copy(cache.blocks + cache.count, cache.blocks + cache.count + count, magazine->blocks);
+            magazine->count = count;
+            pool_.full[size_class].push(magazine);
+        }
+
+        Pool&                   pool_;
+        std::vector<ClassCache> classes_;
+        std::vector<void*>      blocks_;
+    };
+
+    thread_local ThreadCache thread_cache;
+
+    void* pool_malloc(std::size_t size)
+    {
+        const auto size_class = pool().class_of(size);
+        if (size_class == large_class)
+            return map_large(size, superblock_header);
+        return thread_cache.allocate(size_class);
+    }
+
+    void pool_free(void* ptr)
+    {
+        if (!ptr)
+            return;
+
+        auto* superblock = superblock_of(ptr);
+        if (superblock->size_class == large_class) {
+            unmap_large(superblock);
+        } else {
+            thread_cache.deallocate(ptr, superblock->size_class);
+        }
+    }
+
+    void* pool_calloc(std::size_t count, std::size_t size)
+    {
+        if (size && count > SIZE_MAX / size)
+            return nullptr;
+
+        // Fresh superblocks and direct mappings come zeroed from the kernel, recycled blocks don't
+        void* block = pool_malloc(count * size);
+        if (block && superblock_of(block)->size_class != large_class) {
+            std::memset(block, 0, count * size);
+        }
+        return block;
+    }
+
+    void pool_free_sized(void* ptr, std::size_t size)
+    {
+        if (!ptr)
+            return;
+
+        // The class follows from the size, so the superblock header is only read for large blocks
+        const auto size_class = pool().class_of(size);
+        if (size_class == large_class) {
+            unmap_large(superblock_of(ptr));
+        } else {
+            thread_cache.deallocate(ptr, size_class);
+        }
+    }
+
+    void* pool_realloc(void* ptr, std::size_t size)
+    {
+        if (!ptr)
+            return pool_malloc(size);
+
+        auto*             superblock = superblock_of(ptr);
+        const std::size_t usable     = superblock->size_class == large_class
+                                           ? superblock->mapping_size - (static_cast<char*>(ptr) - reinterpret_cast<char*>(superblock))
+                                           : pool().class_sizes[superblock->size_class];
+
+        // Only stay in place within the same class, so a sized free of the new size finds it
+        if (size <= usable && pool().class_of(size) == superblock->size_class)
+            return ptr;
+
+        void* block = pool_malloc(size);
+        if (block) {
+            std::memcpy(block, ptr, std::min(size, usable));
+            pool_free(ptr);
+        }
+        return block;
+    }
+
+    void* pool_aligned_alloc(std::size_t alignment, std::size_t size)
+    {
+        if (alignment <= 16)
+            return pool_malloc(size);
+
+        // Blocks start at offset 64 of their superblock, so classes which are a multiple of the
+        // alignment give aligned blocks. Larger alignments go to a mapping of their own
+        if (alignment <= superblock_header) {
+            const auto& classes = pool().class_sizes;
+            for (auto c = pool().class_of(std::max(size, alignment)); c < classes.size(); ++c) {
+                if (classes[c] % alignment == 0)
+                    return thread_cache.allocate(c);
+            }
+        }
+
+        if (alignment >= pool_superblock_size)
+            return nullptr;
+        return map_large(size, std::max(alignment, superblock_header));
+    }
+
+    void pool_thread_teardown()
+    {
+        thread_cache.flush();
+    }
+
+    bool pool_heap_stats(HeapStats& stats)
+    {
+        // Blocks in use aren't counted, only the mapped superblocks
+        stats.in_use = pool().mapped.load(std::memory_order_relaxed);
+        stats.mapped = stats.in_use;
+        return true;
+    }
+} // namespace
+
+bool parse_pool_spacing(std::string_view name, PoolSpacing& spacing)
+{
+    if (name == "pow2") {
+        spacing = PoolSpacing::pow2;
+    } else if (name == "quarter") {
+        spacing = PoolSpacing::quarter;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+Backend pool_backend()
+{
+    Backend backend{"pool", pool_malloc, pool_free, pool_realloc, pool_aligned_alloc, nullptr, pool_thread_teardown, pool_heap_stats, "builtin"};
+    backend.calloc     = pool_calloc;
+    backend.free_sized = pool_free_sized;
+    return backend;
+}
@@ -2,56 +2,146 @@
 #include "options.h"
 #include "util.h"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <cctype>
+#include <string>
+#include <utility>
 
 #include <fmt/format.h>
 #include <fmt/color.h>
 #include <fmt/ranges.h>
 
-void print_header(bool print_total_time)
+void print_header(const std::vector<Backend>& backends, bool print_total_time, std::string_view row_label)
 {
+    // Every backend is compared against the first one
+    const auto& baseline = backends.front().name;
+
     if (print_total_time) {
-        fmt::print("|{:-^12}|{:-^44}|{:-^44}|{:-^35}|\n", "", "libstdc++ malloc", "TBB malloc",
-                   "Difference");
-        fmt::print(
-            "|{:^12}| {:^12} | {:^12} | {:^12} | {:^12} | {:^12} | {:^12} || {:^9} | {:^9} | "
-            "{:^9} |\n",
-            "Bytes", "Total Time", "Alloc Time", "Free Time", "Total Time", "Alloc Time",
-            "Free Time", "Total", "Alloc", "Free");
+        fmt::print("|{:-^12}|", "");
+        for (const auto& b : backends) {
+            fmt::print("|{:-^44}|", b.name);
+        }
+        for (std::size_t i = 1; i < backends.size(); ++i) {
+            fmt::print("|{:-^35}|", fmt::format("{} vs {}", backends[i].name, baseline));
+        }
+        fmt::print("|\n");
+
+        fmt::print("|{:^12}|", row_label);
+        for (std::size_t i = 0; i < backends.size(); ++i) {
+            fmt::print("| {:^12} | {:^12} | {:^12} |", "Total Time", "Alloc Time", "Free Time");
+        }
+        for (std::size_t i = 1; i < backends.size(); ++i) {
+            fmt::print("| {:^9} | {:^9} | {:^9} |", "Total", "Alloc", "Free");
+        }
+        fmt::print("|\n");
     } else {
-        fmt::print("|{:-^12}||{:-^29}||{:-^29}||{:-^23}||\n", "", "libstdc++ malloc", "TBB malloc",
-                   "Difference");
-        fmt::print("|{:^12}|| {:^12} | {:^12} || {:^12} | {:^12} || {:^9} | {:^9} ||\n", "Bytes",
-                   "Alloc Time", "Free Time", "Alloc Time", "Free Time", "Alloc", "Free");
+        fmt::print("|{:-^12}|", "");
+        for (const auto& b : backends) {
+            fmt::print("|{:-^29}|", b.name);
+        }
+        for (std::size_t i = 1; i < backends.size(); ++i) {
+            fmt::print("|{:-^23}|", fmt::format("{} vs {}", backends[i].name, baseline));
+        }
+        fmt::print("|\n");
+
+        fmt::print("|{:^12}|", row_label);
+        for (std::size_t i = 0; i < backends.size(); ++i) {
+            fmt::print("| {:^12} | {:^12} |", "Alloc Time", "Free Time");
+        }
+        for (std::size_t i = 1; i < backends.size(); ++i) {
+            fmt::print("| {:^9} | {:^9} |", "Alloc", "Free");
+        }
+        fmt::print("|\n");
     }
 }
 
-void print_round(long N, fsec alloc_elapsed, fsec free_elapsed, fsec tbb_alloc_elapsed,
-                 fsec tbb_free_elapsed, bool print_round_time, bool print_total_time)
+namespace
 {
-    float avg_alloc = alloc_elapsed.count() / repeat;
-    float avg_free  = free_elapsed.count() / repeat;
-    float avg_total = avg_alloc + avg_free;
+    /// Operations of one thread in one trial. The histograms hold the operations of all trials and
+    /// threads, while the elapsed times are those of the median trial, averaged over the threads.
+    /// Fixed duration runs report the time per operation already
+    double operations(const Histogram& latency, const Summary& summary, int num_threads)
+    {
+        if (run_duration > 0)
+            return 1.0;
 
-    float tbb_avg_alloc = tbb_alloc_elapsed.count() / repeat;
-    float tbb_avg_free  = tbb_free_elapsed.count() / repeat;
-    float tbb_avg_total = tbb_avg_alloc + tbb_avg_free;
+        const double trials = std::max(1, summary.trials);
+        return std::max(1.0, latency.count() / (trials * num_threads));
+    }
+} // namespace
 
-    float diff_alloc = ((avg_alloc / tbb_avg_alloc) - 1) * 100;
-    float diff_free  = ((avg_free / tbb_avg_free) - 1) * 100;
-    float diff_total = ((avg_total / tbb_avg_total) - 1) * 100;
+void print_round(long N, const std::vector<BackendStats>& round, bool print_round_time, bool print_total_time, int num_threads)
+{
+    fmt::print("| {:>10} |", N);
 
-    if (print_total_time) {
-        fmt::print("| {:>10} || {:>12.10f} | {:>12.10f} | {:>12.10f} || {:>12.10f} | {:>12.10f} | "
-                   "{:>12.10f} |",
-                   N, avg_total, avg_alloc, avg_free, tbb_avg_total, tbb_avg_alloc, tbb_avg_free);
+    for (const auto& b : round) {
+        // Workloads which cap their operations at large sizes do fewer than repeat
+        float avg_alloc = b.alloc_elapsed.count() / operations(b.alloc_latency, b.alloc_summary, num_threads);
+        float avg_free  = b.free_elapsed.count() / operations(b.free_latency, b.free_summary, num_threads);
+        float avg_total = avg_alloc + avg_free;
+
+        if (print_total_time) {
+            fmt::print("| {:>12.10f} | {:>12.10f} | {:>12.10f} |", avg_total, avg_alloc, avg_free);
+        } else {
+            fmt::print("| {:>12.10f} | {:>12.10f} |", avg_alloc, avg_free);
+        }
+    }
+
+    // Positive numbers mean the backend is faster than the first one, colored if the confidence
+    // intervals of the trials don't overlap
+    const auto& baseline = round.front();
+    for (std::size_t i = 1; i < round.size(); ++i) {
+        const auto& other = round[i];
+
+        float diff_alloc = ((baseline.alloc_elapsed / other.alloc_elapsed) - 1) * 100;
+        float diff_free  = ((baseline.free_elapsed / other.free_elapsed) - 1) * 100;
+        float diff_total = (((baseline.alloc_elapsed + baseline.free_elapsed) / (other.alloc_elapsed + other.free_elapsed)) - 1) * 100;
+
+        fmt::print("|");
+        print_difference(diff_total, diff_alloc, diff_free, print_total_time, significant(baseline.total_summary, other.total_summary),
+                         significant(baseline.alloc_summary, other.alloc_summary), significant(baseline.free_summary, other.free_summary));
+    }
+
+    fmt::print("|");
+    if (print_round_time) {
+        fmt::print("\n");
     } else {
-        fmt::print("| {:>10} || {:>12.10f} | {:>12.10f} || {:>12.10f} | "
-                   "{:>12.10f} ||",
-                   N, avg_alloc, avg_free, tbb_avg_alloc, tbb_avg_free);
+        fmt::print("\r");
     }
+}
 
-    print_difference(diff_total, diff_alloc, diff_free, print_total_time);
+void print_rate_header(const std::vector<Backend>& backends, std::string_view row_label)
+{
+    fmt::print("|{:-^12}|", "");
+    for (const auto& b : backends) {
+        fmt::print("|{:-^68}|", b.name);
+    }
+    fmt::print("|\n");
+
+    fmt::print("|{:^12}|", row_label);
+    for (std::size_t i = 0; i < backends.size(); ++i) {
+        fmt::print("| {:^9} | {:^9} | {:^9} | {:^9} | {:^9} | {:^9} |", "Alloc ns", "Free ns", "Mops/s", "MB/s", "Mops/s/t",
+                   "MB/s/t");
+    }
+    fmt::print("|\n");
+}
+
+void print_rate_round(long N, const std::vector<BackendStats>& round, int num_threads, bool print_round_time)
+{
+    fmt::print("| {:>10} |", N);
+
+    for (const auto& b : round) {
+        // One operation is an allocation and its free, the rates are the median of the trials
+        const double ops   = b.alloc_rate * 1e-6;
+        const double bytes = b.byte_rate / (1024.0 * 1024.0);
+
+        fmt::print("| {:>9.1f} | {:>9.1f} | {:>9.3f} | {:>9.4g} | {:>9.3f} | {:>9.4g} |", b.alloc_latency.mean(), b.free_latency.mean(), ops,
+                   bytes, ops / num_threads, bytes / num_threads);
+    }
+
+    fmt::print("|");
     if (print_round_time) {
         fmt::print("\n");
     } else {
@@ -59,66 +149,325 @@ void print_round(long N, fsec alloc_elapsed, fsec free_elapsed, fsec tbb_alloc_e
     }
 }
 
-void print_difference(float diff_total, float diff_alloc, float diff_free, bool print_total_time)
+void print_numa_header(const std::vector<Backend>& backends)
 {
-    auto diff_total_color = [&] {
-        if (diff_total < 0.0) {
-            return fmt::color::red;
-        }
-        return fmt::color::green;
-    }();
+    fmt::print("|{:-^12}|", "");
+    for (const auto& b : backends) {
+        fmt::print("|{:-^56}|", b.name);
+    }
+    fmt::print("|\n");
 
-    if (print_total_time) {
-        fmt::print(fmt::fg(diff_total_color), " {:>+8.2f}% ", diff_total);
-        fmt::print("|");
+    fmt::print("|{:^12}|", "Bytes");
+    for (std::size_t i = 0; i < backends.size(); ++i) {
+        fmt::print("| {:^9} | {:^9} | {:^9} | {:^9} | {:^9} |", "Alloc ns", "Free ns", "Touch ns", "Local %", "Reuse %");
     }
+    fmt::print("|\n");
+}
 
-    auto diff_alloc_color = [&] {
-        if (diff_alloc < 0.0) {
-            return fmt::color::red;
-        }
-        return fmt::color::green;
-    }();
+void print_numa_round(long N, const std::vector<BackendStats>& round, bool print_round_time)
+{
+    fmt::print("| {:>10} |", N);
+
+    for (const auto& b : round) {
+        // Touch time is per page, local is the share of pages on the node of the allocating thread
+        const double touch = b.touched_pages ? b.touch_elapsed.count() * 1e9 / b.touched_pages : 0.0;
+
+        fmt::print("| {:>9.1f} | {:>9.1f} | {:>9.1f} | {:>9.1f} | {:>9.1f} |", b.alloc_latency.mean(), b.free_latency.mean(), touch,
+                   b.first_placement.local_ratio() * 100, b.reuse_placement.local_ratio() * 100);
+    }
+
+    fmt::print("|");
+    if (print_round_time) {
+        fmt::print("\n");
+    } else {
+        fmt::print("\r");
+    }
+}
+
+void print_container_header(const std::vector<Backend>& backends)
+{
+    fmt::print("|{:-^12}|", "");
+    for (const auto& b : backends) {
+        fmt::print("|{:-^35}|", b.name);
+    }
+    fmt::print("|\n");
+
+    fmt::print("|{:^12}|", "Elements");
+    for (std::size_t i = 0; i < backends.size(); ++i) {
+        fmt::print("| {:^9} | {:^9} | {:^9} |", "Build ns", "Walk ns", "Free ns");
+    }
+    fmt::print("|\n");
+}
+
+void print_container_round(long N, const std::vector<BackendStats>& round, bool print_round_time)
+{
+    fmt::print("| {:>10} |", N);
+
+    for (const auto& b : round) {
+        // Everything per element
+        fmt::print("| {:>9.1f} | {:>9.1f} | {:>9.1f} |", b.alloc_elapsed.count() * 1e9 / N, b.touch_elapsed.count() * 1e9 / N,
+                   b.free_elapsed.count() * 1e9 / N);
+    }
+
+    fmt::print("|");
+    if (print_round_time) {
+        fmt::print("\n");
+    } else {
+        fmt::print("\r");
+    }
+}
+
+void print_locality_header(const std::vector<Backend>& backends)
+{
+    fmt::print("|{:-^12}|", "");
+    for (const auto& b : backends) {
+        fmt::print("|{:-^47}|", b.name);
+    }
+    fmt::print("|\n");
+
+    fmt::print("|{:^12}|", "Nodes");
+    for (std::size_t i = 0; i < backends.size(); ++i) {
+        fmt::print("| {:^9} | {:^9} | {:^9} | {:^9} |", "Build ns", "Walk ns", "Lines/n", "Pages/n");
+    }
+    fmt::print("|\n");
+}
+
+void print_locality_round(long N, const std::vector<BackendStats>& round, bool print_round_time)
+{
+    fmt::print("| {:>10} |", N);
+
+    for (const auto& b : round) {
+        // Everything per node, a page holds 128 nodes of 32 bytes
+        fmt::print("| {:>9.1f} | {:>9.1f} | {:>9.3f} | {:>9.4f} |", b.alloc_elapsed.count() * 1e9 / N, b.touch_elapsed.count() * 1e9 / N,
+                   static_cast<double>(b.walked_lines) / N, static_cast<double>(b.walked_pages) / N);
+    }
 
-    fmt::print(fmt::fg(diff_alloc_color), " {:>+8.2f}% ", diff_alloc);
     fmt::print("|");
+    if (print_round_time) {
+        fmt::print("\n");
+    } else {
+        fmt::print("\r");
+    }
+}
+
+void print_trials(const std::vector<Backend>& backends, const std::vector<Stats>& statistics)
+{
+    for (std::size_t b = 0; b < backends.size(); ++b) {
+        fmt::print("\nTrials of {}: median, MAD and {:.0f}% confidence interval of the kept trials in us\n", backends[b].name,
+                   confidence_level * 100);
+        fmt::print("|{:-^12}|{:-^19}||{:-^52}||{:-^52}||\n", "", "", "Alloc", "Free");
+        fmt::print("|{:^12}| {:^6} | {:^8} |", "Bytes", "Trials", "Outliers");
+        for (int i = 0; i < 2; ++i) {
+            fmt::print("| {:^4} | {:^9} | {:^9} | {:^9} | {:^9} |", "Kept", "Median", "MAD", "CI low", "CI high");
+        }
+        fmt::print("|\n");
+
+        for (const auto& s : statistics) {
+            const auto& stats = s.backends[b];
 
-    auto diff_free_color = [&] {
-        if (diff_free < 0.0) {
-            return fmt::color::red;
+            fmt::print("| {:>10} | {:>6} | {:>8} |", s.num_bytes, stats.alloc_summary.trials,
+                       stats.alloc_summary.outliers + stats.free_summary.outliers);
+            for (const auto* summary : {&stats.alloc_summary, &stats.free_summary}) {
+                fmt::print("| {:>4} | {:>9.3f} | {:>9.3f} | {:>9.3f} | {:>9.3f} |", summary->kept, summary->median * 1e6, summary->mad * 1e6,
+                           summary->ci_low * 1e6, summary->ci_high * 1e6);
+            }
+            fmt::print("|\n");
         }
-        return fmt::color::green;
-    }();
+    }
+    fmt::print("\n");
+}
+
+void print_throughput(const std::vector<Backend>& backends, const std::vector<Stats>& statistics, int num_threads, std::string_view row_label)
+{
+    fmt::print("\nAggregate and per thread (/t) throughput of {} thread(s) in wall clock time, latencies are per operation\n", num_threads);
+    print_rate_header(backends, row_label);
 
-    fmt::print(fmt::fg(diff_free_color), " {:>+8.2f}% ", diff_free);
-    fmt::print("||");
+    for (const auto& s : statistics) {
+        print_rate_round(s.num_bytes, s.backends, num_threads, true);
+    }
+    fmt::print("\n");
 }
 
-void print_stats(std::FILE* handle, const std::vector<Stats>& statistics)
+void print_reallocs(const std::vector<Backend>& backends, const std::vector<Stats>& statistics)
 {
-    if (!print_statistics)
+    // Only the realloc workloads have any
+    const bool any = std::any_of(statistics.begin(), statistics.end(), [](const Stats& s) {
+        return std::any_of(s.backends.begin(), s.backends.end(), [](const BackendStats& b) { return b.reallocs > 0; });
+    });
+    if (!any)
         return;
 
-    auto [bytes, avg_allocs, avg_frees, tbb_avg_allocs, tbb_avg_frees] = split_stats(statistics);
+    fmt::print("\nReallocs which kept the block in place\n");
+    fmt::print("|{:-^12}|", "");
+    for (const auto& b : backends) {
+        fmt::print("|{:-^25}|", b.name);
+    }
+    fmt::print("|\n");
+
+    fmt::print("|{:^12}|", "Bytes");
+    for (std::size_t i = 0; i < backends.size(); ++i) {
+        fmt::print("| {:^11} | {:^9} |", "Reallocs", "In place");
+    }
+    fmt::print("|\n");
 
-    print_numpy(handle, "bytes", bytes);
-    print_numpy(handle, "allocs", avg_allocs);
-    print_numpy(handle, "frees", avg_frees);
-    print_numpy(handle, "tbb_allocs", tbb_avg_allocs);
-    print_numpy(handle, "tbb_frees", tbb_avg_frees);
+    for (const auto& s : statistics) {
+        fmt::print("| {:>10} |", s.num_bytes);
+        for (const auto& b : s.backends) {
+            const double in_place = b.reallocs ? 100.0 * b.in_place_reallocs / b.reallocs : 0.0;
+            fmt::print("| {:>11} | {:>8.1f}% |", b.reallocs, in_place);
+        }
+        fmt::print("|\n");
+    }
+    fmt::print("\n");
 }
 
-void print_stats(std::FILE* handle, const std::vector<int> threads, const std::vector<std::vector<Stats>>& statistics)
+void print_touch(const std::vector<Backend>& backends, const std::vector<Stats>& statistics)
 {
-    fmt::print("Threads size {}, stats size {}\n", threads.size(), statistics.size());
-    assert(threads.size() == statistics.size());
+    // Every fault on a touched page means the backend handed out memory which wasn't faulted in yet
+    fmt::print("\nTouch time per page and page faults of the workload, faults per touched page show how much memory was fresh\n");
+    fmt::print("|{:-^12}|", "");
+    for (const auto& b : backends) {
+        fmt::print("|{:-^47}|", b.name);
+    }
+    fmt::print("|\n");
+
+    fmt::print("|{:^12}|", "Bytes");
+    for (std::size_t i = 0; i < backends.size(); ++i) {
+        fmt::print("| {:^9} | {:^9} | {:^9} | {:^9} |", "Touch ns", "Minor", "Major", "Fresh %");
+    }
+    fmt::print("|\n");
+
+    for (const auto& s : statistics) {
+        fmt::print("| {:>10} |", s.num_bytes);
+        for (const auto& b : s.backends) {
+            const double touch = b.touched_pages ? b.touch_elapsed.count() * 1e9 / b.touched_pages : 0.0;
+            const double fresh = b.touched_pages ? 100.0 * b.minor_faults / b.touched_pages : 0.0;
+            fmt::print("| {:>9.1f} | {:>9} | {:>9} | {:>9.1f} |", touch, b.minor_faults, b.major_faults, fresh);
+        }
+        fmt::print("|\n");
+    }
+    fmt::print("\n");
+}
 
-    auto [bytes, allocs, frees, tbballocs, tbbfrees] = split_2d_stats(statistics);
+void print_totals(const std::vector<Backend>& backends, const std::vector<BackendStats>& results)
+{
+    fmt::print("|{:^16}|| {:^10} | {:^12} | {:^9} | {:^9} || {:^10} | {:^12} | {:^9} | {:^9} || {:^9} ||\n", "Backend", "Allocs",
+               "Alloc Time", "Mean ns", "p99 ns", "Frees", "Free Time", "Mean ns", "p99 ns", "Total");
+
+    const auto& baseline = results.front();
+    for (std::size_t b = 0; b < backends.size(); ++b) {
+        const auto& r = results[b];
+
+        fmt::print("| {:>14} || {:>10} | {:>12.6f} | {:>9.1f} | {:>9} || {:>10} | {:>12.6f} | {:>9.1f} | {:>9} ||", backends[b].name,
+                   r.alloc_latency.count(), r.alloc_elapsed.count(), r.alloc_latency.mean(), r.alloc_latency.percentile(99.0),
+                   r.free_latency.count(), r.free_elapsed.count(), r.free_latency.mean(), r.free_latency.percentile(99.0));
+
+        // Same convention as the rounds, positive numbers mean faster than the first backend
+        const float diff_total =
+            (((baseline.alloc_elapsed + baseline.free_elapsed) / (r.alloc_elapsed + r.free_elapsed)) - 1) * 100;
+        fmt::print(fmt::fg(diff_total < 0.0 ? fmt::color::red : fmt::color::green), " {:>+8.2f}% ", diff_total);
+        fmt::print("||\n");
+    }
+}
+
+void print_latencies(const std::vector<Backend>& backends, const std::vector<Stats>& statistics)
+{
+    for (std::size_t b = 0; b < backends.size(); ++b) {
+        fmt::print("\nLatency percentiles of {} in ns\n", backends[b].name);
+        fmt::print("|{:-^12}||{:-^49}||{:-^49}||\n", "", "Alloc", "Free");
+        fmt::print("|{:^12}|", "Bytes");
+        for (int i = 0; i < 2; ++i) {
+            fmt::print("| {:^7} | {:^7} | {:^7} | {:^7} | {:^7} |", "p50", "p90", "p99", "p99.9", "max");
+        }
+        fmt::print("|\n");
+
+        for (const auto& s : statistics) {
+            fmt::print("| {:>10} |", s.num_bytes);
+            for (const auto* hist : {&s.backends[b].alloc_latency, &s.backends[b].free_latency}) {
+                fmt::print("|");
+                for (const auto& [p, name] : reported_percentiles) {
+                    fmt::print(" {:>7} |", hist->percentile(p));
+                }
+            }
+            fmt::print("|\n");
+        }
+    }
+    fmt::print("\n");
+}
+
+void print_perf_counters(const std::vector<Backend>& backends, const std::vector<Stats>& statistics)
+{
+    for (std::size_t b = 0; b < backends.size(); ++b) {
+        fmt::print("\nPerformance counters of {} per operation\n", backends[b].name);
+        fmt::print("|{:-^12}||{:-^69}||{:-^69}||\n", "", "Alloc", "Free");
+        fmt::print("|{:^12}|", "Bytes");
+        for (int i = 0; i < 2; ++i) {
+            fmt::print("| {:^7} | {:^7} | {:^7} | {:^7} | {:^7} | {:^7} | {:^7} |", "cycles", "instr", "L1d", "LLC", "dTLB", "faults",
+                       "ctxsw");
+        }
+        fmt::print("|\n");
+
+        for (const auto& s : statistics) {
+            const auto& stats = s.backends[b];
+
+            fmt::print("| {:>10} |", s.num_bytes);
+            for (bool alloc : {true, false}) {
+                const auto& counters = alloc ? stats.alloc_counters : stats.free_counters;
+                const auto  ops      = std::max<std::uint64_t>(1, alloc ? stats.alloc_latency.count() : stats.free_latency.count());
+
+                fmt::print("|");
+                for (int e = 0; e < perf_event_count; ++e) {
+                    if (counters.available[e]) {
+                        fmt::print(" {:>7.1f} |", static_cast<double>(counters.values[e]) / ops);
+                    } else {
+                        fmt::print(" {:>7} |", "-");
+                    }
+                }
+            }
+            fmt::print("|\n");
+        }
+    }
+    fmt::print("\n");
+}
+
+void print_memory(const std::vector<Backend>& backends, const std::vector<Stats>& statistics)
+{
+    constexpr double mb = 1024.0 * 1024.0;
+
+    for (std::size_t b = 0; b < backends.size(); ++b) {
+        fmt::print("\nMemory footprint of {} in MB (overhead is RSS / requested, THP is the RSS in transparent huge pages)\n",
+                   backends[b].name);
+        fmt::print("|{:^12}|| {:^10} | {:^10} | {:^10} | {:^10} | {:^10} | {:^10} || {:^9} | {:^9} ||\n", "Bytes", "Requested", "RSS",
+                   "PSS", "THP", "Heap", "Retained", "Peak ovh", "Steady");
+
+        for (const auto& s : statistics) {
+            const auto& m = s.backends[b].memory;
+
+            fmt::print("| {:>10} || {:>10.3f} | {:>10.3f} | {:>10.3f} | {:>10.3f} | {:>10.3f} | {:>10.3f} || {:>9.2f} | {:>9.2f} ||\n",
+                       s.num_bytes, m.peak_requested / mb, m.peak_rss / mb, m.peak_pss / mb, m.peak_anon_huge / mb, m.peak_heap / mb,
+                       m.retained_rss / mb, m.peak_overhead, m.steady_overhead());
+        }
+    }
+    fmt::print("\n");
+}
+
+void print_difference(float diff_total, float diff_alloc, float diff_free, bool print_total_time, bool significant_total,
+                      bool significant_alloc, bool significant_free)
+{
+    // Only differences outside of the noise get a color
+    auto print_diff = [](float diff, bool significant) {
+        if (significant) {
+            fmt::print(fmt::fg(diff < 0.0 ? fmt::color::red : fmt::color::green), " {:>+8.2f}% ", diff);
+        } else {
+            fmt::print(" {:>+8.2f}% ", diff);
+        }
+        fmt::print("|");
+    };
+
+    if (print_total_time) {
+        print_diff(diff_total, significant_total);
+    }
 
-    print_numpy(handle, "threads", threads);
-    print_numpy(handle, "bytes", bytes);
-    print_numpy(handle, "allocs", allocs);
-    print_numpy(handle, "frees", frees);
-    print_numpy(handle, "tbballocs", tbballocs);
-    print_numpy(handle, "tbbfrees", tbbfrees);
+    print_diff(diff_alloc, significant_alloc);
+    print_diff(diff_free, significant_free);
 }
@@ -0,0 +1,236 @@
+#include "producer_consumer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+#include <fmt/format.h>
+
+#include "options.h"
+#include "perf_counters.h"
+#include "print.h"
+#include "queue.h"
+#include "runner.h"
+#include "thread_pool.h"
+#include "timer.h"
+#include "util.h"
+
+namespace
+{
+    /// Keep at most 64 MB of messages in flight, but at least a few per slot
+    std::size_t queue_capacity(long N)
+    {
+        std::size_t capacity = 16;
+        while (capacity < 4096 && (capacity * 2) * N <= 64 * megabyte) {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    template <typename Queue>
+    void produce(const Backend& backend, long N, const PipelineConfig& config, Queue& queue, BackendStats& result)
+    {
+        std::vector<std::byte*> batch(config.batch);
+
+        for (long i = 0; i < config.messages; i += config.batch) {
+            const long count = std::min(config.batch, config.messages - i);
+
+            for (long j = 0; j < count; j += timer_batch_size) {
+                const long ops = std::min(timer_batch_size, count - j);
+
+                phase_begin(Phase::alloc);
+                auto alloc_start = timer_start();
+                for (long k = j; k < j + ops; ++k) {
+                    batch[k] = static_cast<std::byte*>(backend.malloc(N));
+                }
+                auto alloc_end = timer_stop();
+                phase_end(Phase::alloc);
+                result.record_alloc(timer_elapsed(alloc_start, alloc_end), ops);
+            }
+
+            // Write the message, so its cache line moves to the consumer like a real one would
+            for (long j = 0; j < count; ++j) {
+                if (batch[j]) {
+                    *batch[j] = std::byte{1};
+                }
+                while (!queue.push(batch[j])) {
+                    cpu_relax();
+                }
+            }
+        }
+    }
+
+    template <typename Queue>
+    void consume(const Backend& backend, const PipelineConfig& config, Queue& queue, std::atomic<long>& consumed, long total,
+                 BackendStats& result)
+    {
+        std::vector<std::byte*> batch(config.batch);
+
+        for (;;) {
+            long count = 0;
+            while (count < config.batch && queue.pop(batch[count])) {
+                ++count;
+            }
+
+            if (count == 0) {
+                if (consumed.load(std::memory_order_acquire) >= total)
+                    return;
+
+                cpu_relax();
+                continue;
+            }
+
+            // Read the message before it's released
+            for (long j = 0; j < count; ++j) {
+                if (batch[j]) {
+                    escape(batch[j]);
+                    clobber();
+                }
+            }
+
+            for (long j = 0; j < count; j += timer_batch_size) {
+                const long ops = std::min(timer_batch_size, count - j);
+
+                phase_begin(Phase::free);
+                auto free_start = timer_start();
+                for (long k = j; k < j + ops; ++k) {
+                    backend.free(batch[k]);
+                }
+                auto free_end = timer_stop();
+                phase_end(Phase::free);
+                result.record_free(timer_elapsed(free_start, free_end), ops);
+            }
+
+            consumed.fetch_add(count, std::memory_order_release);
+        }
+    }
+
+    template <typename Queue>
+    BackendStats run_pipeline(const Backend& backend, long N, const PipelineConfig& config)
+    {
+        Queue queue(queue_capacity(N));
+
+        const long        total = config.messages * config.producers;
+        std::atomic<long> consumed{0};
+        std::atomic<int>  ready{0};
+        std::atomic<bool> go{false};
+
+        std::vector<BackendStats> producer_stats(config.producers);
+        std::vector<BackendStats> consumer_stats(config.consumers);
+        std::vector<std::thread>  threads;
+
+        // Producers get the first CPUs of the affinity policy, consumers the following ones
+        auto cpu_sets = affinity_cpu_sets(worker_affinity, config.producers + config.consumers);
+
+        auto start_together = [&] {
+            ready.fetch_add(1, std::memory_order_acq_rel);
+            while (!go.load(std::memory_order_acquire)) {
+                cpu_relax();
+            }
+        };
+
+        for (int p = 0; p < config.producers; ++p) {
+            threads.emplace_back([&, p] {
+                pin_current_thread(cpu_sets[p]);
+                BackendThreadScope scope(backend);
+                ThreadPerfCounters counters(use_perf_counters);
+
+                start_together();
+                produce(backend, N, config, queue, producer_stats[p]);
+                counters.read(producer_stats[p].alloc_counters, producer_stats[p].free_counters);
+            });
+        }
+
+        for (int c = 0; c < config.consumers; ++c) {
+            threads.emplace_back([&, c] {
+                pin_current_thread(cpu_sets[config.producers + c]);
+                BackendThreadScope scope(backend);
+                ThreadPerfCounters counters(use_perf_counters);
+
+                start_together();
+                consume(backend, config, queue, consumed, total, consumer_stats[c]);
+                counters.read(consumer_stats[c].alloc_counters, consumer_stats[c].free_counters);
+            });
+        }
+
+        while (ready.load(std::memory_order_acquire) != config.producers + config.consumers) {
+            cpu_relax();
+        }
+
+        auto start = stdclock::now();
+        go.store(true, std::memory_order_release);
+
+        for (auto& t : threads) {
+            t.join();
+        }
+        auto end = stdclock::now();
+
+        // All messages are released, as is the memory of the exited producers
+        if (backend.release) {
+            backend.release();
+        }
+
+        BackendStats merged;
+        for (const auto& s : producer_stats) {
+            merged.alloc_elapsed += s.alloc_elapsed;
+            merged.alloc_latency.merge(s.alloc_latency);
+            merged.alloc_counters.merge(s.alloc_counters);
+        }
+        for (const auto& s : consumer_stats) {
+            merged.free_elapsed += s.free_elapsed;
+            merged.free_latency.merge(s.free_latency);
+            merged.free_counters.merge(s.free_counters);
+        }
+
+        merged.wall_elapsed = end - start;
+        merged.bytes        = total * N;
+        return merged;
+    }
+} // namespace
+
+std::vector<Stats> producer_consumer_alloc(const std::vector<Backend>& backends, const PipelineConfig& config)
+{
+    const bool spsc = config.producers == 1 && config.consumers == 1;
+
+    fmt::print("{} producer(s), {} consumer(s), batches of {} messages, {} queue\n\n", config.producers, config.consumers, config.batch,
+               spsc ? "SPSC" : "MPMC");
+
+    print_rate_header(backends);
+
+    std::vector<Stats> statistics;
+    statistics.reserve(max_message_size_power);
+
+    for (long n = 1; n <= max_message_size_power; ++n) {
+        long N = std::pow(2, n);
+
+        Stats stats{N, {}};
+        stats.backends.reserve(backends.size());
+
+        for (const auto& backend : backends) {
+            if (spsc) {
+                stats.backends.push_back(run_trials([&] { return run_pipeline<SpscQueue<std::byte*>>(backend, N, config); }));
+            } else {
+                stats.backends.push_back(run_trials([&] { return run_pipeline<MpmcQueue<std::byte*>>(backend, N, config); }));
+            }
+        }
+
+        print_rate_round(N, stats.backends, config.producers + config.consumers, print_round_time);
+
+        statistics.emplace_back(std::move(stats));
+    }
+
+    if (print_trial_summary) {
+        print_trials(backends, statistics);
+    }
+
+    if (print_latency_percentiles) {
+        print_latencies(backends, statistics);
+    }
+
+    if (use_perf_counters) {
+        print_perf_counters(backends, statistics);
+    }
+
+    return statistics;
+}
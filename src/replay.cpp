@@ -0,0 +1,301 @@
+#include "replay.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+
+#include "options.h"
+#include "perf_counters.h"
+#include "timer.h"
+#include "util.h"
+
+bool load_trace(const std::string& path, ReplayTrace& trace, std::string& error)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        error = "can't open file";
+        return false;
+    }
+
+    TraceHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) || std::memcmp(header.magic, trace_magic, sizeof(header.magic)) != 0) {
+        error = "not an allocation trace";
+        return false;
+    }
+
+    if (header.version != trace_version || header.record_size != sizeof(TraceRecord)) {
+        error = "unsupported trace version";
+        return false;
+    }
+
+    std::vector<TraceRecord> records;
+    TraceRecord              record;
+    while (file.read(reinterpret_cast<char*>(&record), sizeof(record))) {
+        records.push_back(record);
+    }
+
+    // Threads are flushed independently, so restore the global order
+    std::stable_sort(records.begin(), records.end(), [](const auto& a, const auto& b) { return a.timestamp < b.timestamp; });
+
+    // Map addresses to slots, slots of freed allocations are reused
+    std::unordered_map<std::uint64_t, std::uint32_t> live;
+    std::vector<std::uint32_t>                       versions;
+    std::vector<std::uint32_t>                       free_slots;
+
+    auto new_slot = [&] {
+        if (!free_slots.empty()) {
+            auto slot = free_slots.back();
+            free_slots.pop_back();
+            return slot;
+        }
+        versions.push_back(0);
+        return static_cast<std::uint32_t>(versions.size() - 1);
+    };
+
+    // Slots of the blocks a thread's realloc in progress released, by thread
+    std::unordered_map<std::uint32_t, std::uint32_t> releasing;
+
+    std::uint64_t sequence = 0;
+    for (const auto& r : records) {
+        if (r.thread >= trace.threads.size()) {
+            trace.threads.resize(r.thread + 1);
+        }
+
+        ReplayOp op{r.op, 0, 0, r.size, 0, sequence};
+
+        switch (r.op) {
+            case TraceOp::malloc:
+            case TraceOp::calloc:
+            case TraceOp::memalign: {
+                if (!r.address)
+                    continue;
+
+                op.slot      = new_slot();
+                op.alignment = r.op == TraceOp::memalign ? r.extra : 0;
+                live[r.address] = op.slot;
+                trace.total_bytes += r.size;
+                break;
+            }
+            case TraceOp::realloc_release: {
+                // The address may be handed out again before the realloc returns, the slot stays
+                // with the thread until then
+                auto it = live.find(r.address);
+                if (it == live.end()) {
+                    trace.skipped += 1;
+                    continue;
+                }
+
+                releasing[r.thread] = it->second;
+                live.erase(it);
+                continue;
+            }
+            case TraceOp::realloc: {
+                std::uint32_t slot = 0;
+                if (r.extra) {
+                    auto it = releasing.find(r.thread);
+                    if (it == releasing.end()) {
+                        // Its release was already counted as skipped
+                        continue;
+                    }
+                    slot = it->second;
+                    releasing.erase(it);
+                }
+
+                // A failed realloc leaves the old block alone and realloc(nullptr, 0) may return
+                // nullptr, there's nothing to replay for either
+                if (!r.address && (r.size != 0 || !r.extra)) {
+                    if (r.extra) {
+                        live[r.extra] = slot;
+                    }
+                    continue;
+                }
+
+                // realloc(nullptr, n) is a malloc, realloc(p, 0) may free p
+                op.slot = r.extra ? slot : new_slot();
+                if (r.address) {
+                    live[r.address] = op.slot;
+                    trace.total_bytes += r.size;
+                } else {
+                    op.op = TraceOp::free;
+                }
+                break;
+            }
+            case TraceOp::free: {
+                auto it = live.find(r.address);
+                if (it == live.end()) {
+                    trace.skipped += 1;
+                    continue;
+                }
+
+                op.slot = it->second;
+                live.erase(it);
+                break;
+            }
+        }
+
+        op.slot_version = versions[op.slot]++;
+        trace.threads[r.thread].push_back(op);
+        sequence += 1;
+
+        // A freed slot can be used again, its version keeps counting
+        if (op.op == TraceOp::free) {
+            free_slots.push_back(op.slot);
+        }
+    }
+
+    trace.num_slots = versions.size();
+    trace.num_ops   = sequence;
+    return true;
+}
+
+namespace
+{
+    /// Live allocation of a slot and the number of operations done on it so far
+    struct Slot {
+        std::atomic<std::uint32_t> version{0};
+        void*                      ptr  = nullptr;
+        std::uint64_t              size = 0;
+    };
+
+    void* replay_realloc(const Backend& backend, void* ptr, std::uint64_t old_size, std::uint64_t size)
+    {
+        if (backend.realloc) {
+            return backend.realloc(ptr, size);
+        }
+
+        // Emulate it for backends without realloc
+        void* new_ptr = backend.malloc(size);
+        if (new_ptr && ptr) {
+            std::memcpy(new_ptr, ptr, std::min(old_size, size));
+        }
+        backend.free(ptr);
+        return new_ptr;
+    }
+
+    void* replay_aligned(const Backend& backend, std::uint64_t alignment, std::uint64_t size)
+    {
+        return backend.aligned_alloc ? backend.aligned_alloc(alignment, size) : backend.malloc(size);
+    }
+} // namespace
+
+BackendStats replay_trace(const ReplayTrace& trace, const Backend& backend, bool strict)
+{
+    auto slots = std::make_unique<Slot[]>(trace.num_slots);
+
+    std::atomic<std::uint64_t> next_sequence{0};
+    std::atomic<bool>          go{false};
+
+    std::vector<BackendStats> results(trace.threads.size());
+    std::vector<std::thread>  threads;
+    threads.reserve(trace.threads.size());
+
+    for (std::size_t t = 0; t < trace.threads.size(); ++t) {
+        threads.emplace_back([&, t] {
+            BackendThreadScope scope(backend);
+
+            auto&       result = results[t];
+            const auto& ops    = trace.threads[t];
+
+            ThreadPerfCounters counters(use_perf_counters);
+
+            wait_until([&] { return go.load(std::memory_order_acquire); });
+
+            for (const auto& op : ops) {
+                auto& slot = slots[op.slot];
+
+                // Wait until it's the turn of this operation
+                if (strict) {
+                    wait_until([&] { return next_sequence.load(std::memory_order_acquire) == op.sequence; });
+                } else {
+                    wait_until([&] { return slot.version.load(std::memory_order_acquire) == op.slot_version; });
+                }
+
+                const auto phase = op.op == TraceOp::free ? Phase::free : Phase::alloc;
+
+                phase_begin(phase);
+                auto start = timer_start();
+                switch (op.op) {
+                    case TraceOp::malloc:
+                        slot.ptr = backend.malloc(op.size);
+                        break;
+                    case TraceOp::calloc:
+                        if (backend.calloc) {
+                            slot.ptr = backend.calloc(1, op.size);
+                        } else {
+                            slot.ptr = backend.malloc(op.size);
+                            if (slot.ptr) {
+                                std::memset(slot.ptr, 0, op.size);
+                            }
+                        }
+                        break;
+                    case TraceOp::realloc:
+                        slot.ptr = replay_realloc(backend, slot.ptr, slot.size, op.size);
+                        break;
+                    case TraceOp::memalign:
+                        slot.ptr = replay_aligned(backend, op.alignment, op.size);
+                        break;
+                    case TraceOp::free:
+                        backend.free(slot.ptr);
+                        slot.ptr = nullptr;
+                        break;
+                    case TraceOp::realloc_release:
+                        // Folded into the realloc by load_trace
+                        break;
+                }
+                auto stop = timer_stop();
+                phase_end(phase);
+
+                escape(slot.ptr);
+                slot.size = op.size;
+
+                if (phase == Phase::free) {
+                    result.record_free(timer_elapsed(start, stop));
+                } else {
+                    result.record_alloc(timer_elapsed(start, stop));
+                }
+
+                // Let the next operation on this slot, or in the trace, go ahead
+                slot.version.store(op.slot_version + 1, std::memory_order_release);
+                if (strict) {
+                    next_sequence.store(op.sequence + 1, std::memory_order_release);
+                }
+            }
+
+            counters.read(result.alloc_counters, result.free_counters);
+        });
+    }
+
+    go.store(true, std::memory_order_release);
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    // Everything the traced program never freed
+    for (std::size_t i = 0; i < trace.num_slots; ++i) {
+        if (slots[i].ptr) {
+            backend.free(slots[i].ptr);
+        }
+    }
+
+    // The replay threads are gone, so bulk releasing backends can reclaim their memory
+    if (backend.release) {
+        backend.release();
+    }
+
+    BackendStats merged;
+    for (const auto& r : results) {
+        merged.alloc_elapsed += r.alloc_elapsed;
+        merged.free_elapsed += r.free_elapsed;
+        merged.alloc_latency.merge(r.alloc_latency);
+        merged.free_latency.merge(r.free_latency);
+        merged.alloc_counters.merge(r.alloc_counters);
+        merged.free_counters.merge(r.free_counters);
+    }
+
+    return merged;
+}
@@ -0,0 +1,691 @@
+#include "results.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <thread>
+
+#include <fmt/format.h>
+
+#include <sys/utsname.h>
+#include <unistd.h>
+
+bool parse_results_format(std::string_view name, ResultsFormat& format)
+{
+    if (name == "jsonl") {
+        format = ResultsFormat::jsonl;
+    } else if (name == "columnar") {
+        format = ResultsFormat::columnar;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+namespace
+{
+    constexpr char          results_magic[8] = {'A', 'L', 'L', 'O', 'C', 'R', 'E', 'S'};
+    constexpr std::uint32_t results_version  = 1;
+
+    /// Memory fields of a record, in bytes or as ratio
+    const std::array<std::pair<std::string_view, double (*)(const MemoryStats&)>, 8> memory_fields{{
+        {"peak_requested", [](const MemoryStats& m) { return static_cast<double>(m.peak_requested); }},
+        {"peak_rss", [](const MemoryStats& m) { return static_cast<double>(m.peak_rss); }},
+        {"peak_pss", [](const MemoryStats& m) { return static_cast<double>(m.peak_pss); }},
+        {"peak_heap", [](const MemoryStats& m) { return static_cast<double>(m.peak_heap); }},
+        {"peak_anon_huge", [](const MemoryStats& m) { return static_cast<double>(m.peak_anon_huge); }},
+        {"retained_rss", [](const MemoryStats& m) { return static_cast<double>(m.retained_rss); }},
+        {"peak_overhead", [](const MemoryStats& m) { return m.peak_overhead; }},
+        {"steady_overhead", [](const MemoryStats& m) { return m.steady_overhead(); }},
+    }};
+
+    /// Call f(name, value) for every measured value of a backend. All records have the same fields
+    /// in the same order, values which weren't measured are NaN
+    template <typename F>
+    void for_each_field(const BackendStats& b, int threads, F&& f)
+    {
+        f("allocs", static_cast<double>(b.alloc_latency.count()));
+        f("frees", static_cast<double>(b.free_latency.count()));
+        f("alloc_time_s", b.alloc_elapsed.count());
+        f("free_time_s", b.free_elapsed.count());
+        f("wall_time_s", b.wall_elapsed.count());
+        f("bytes", static_cast<double>(b.bytes));
+        f("touch_time_s", b.touch_elapsed.count());
+        f("touched_pages", static_cast<double>(b.touched_pages));
+        f("minor_faults", static_cast<double>(b.minor_faults));
+        f("major_faults", static_cast<double>(b.major_faults));
+        f("reallocs", static_cast<double>(b.reallocs));
+        f("in_place_reallocs", static_cast<double>(b.in_place_reallocs));
+        f("walked_lines", static_cast<double>(b.walked_lines));
+        f("walked_pages", static_cast<double>(b.walked_pages));
+        f("allocs_per_s", b.alloc_rate);
+        f("bytes_per_s", b.byte_rate);
+        f("thread_allocs_per_s", b.alloc_rate / threads);
+        f("thread_bytes_per_s", b.byte_rate / threads);
+
+        for (bool alloc : {true, false}) {
+            const auto&       hist   = alloc ? b.alloc_latency : b.free_latency;
+            const std::string prefix = alloc ? "alloc_" : "free_";
+
+            f(prefix + "mean_ns", hist.mean());
+            for (const auto& [p, name] : reported_percentiles) {
+                f(prefix + std::string(name) + "_ns", static_cast<double>(hist.percentile(p)));
+            }
+        }
+
+        for (bool alloc : {true, false}) {
+            const auto&       counters = alloc ? b.alloc_counters : b.free_counters;
+            const std::string prefix   = alloc ? "alloc_" : "free_";
+
+            for (int e = 0; e < perf_event_count; ++e) {
+                f(prefix + std::string(perf_event_names[e]), counters.available[e] ? static_cast<double>(counters.values[e]) : NAN);
+            }
+        }
+
+        for (const auto& [name, placement] : {std::pair{"first", &b.first_placement}, std::pair{"reuse", &b.reuse_placement}}) {
+            f(fmt::format("{}_local_pages", name), static_cast<double>(placement->local));
+            f(fmt::format("{}_remote_pages", name), static_cast<double>(placement->remote));
+            f(fmt::format("{}_unknown_pages", name), static_cast<double>(placement->unknown));
+        }
+
+        for (const auto& [name, field] : memory_fields) {
+            f(std::string(name), field(b.memory));
+        }
+
+        for (const auto& [name, summary] :
+             {std::pair{"alloc", &b.alloc_summary}, std::pair{"free", &b.free_summary}, std::pair{"total", &b.total_summary}}) {
+            f(fmt::format("{}_trials", name), summary->trials);
+            f(fmt::format("{}_outliers", name), summary->outliers);
+            f(fmt::format("{}_kept", name), summary->kept);
+            f(fmt::format("{}_median_s", name), summary->median);
+            f(fmt::format("{}_mad_s", name), summary->mad);
+            f(fmt::format("{}_ci_low_s", name), summary->ci_low);
+            f(fmt::format("{}_ci_high_s", name), summary->ci_high);
+        }
+    }
+
+    /// Quote and escape a string for JSON
+    std::string json_string(std::string_view text)
+    {
+        std::string quoted = "\"";
+        for (char c : text) {
+            switch (c) {
+            case '"':
+                quoted += "\\\"";
+                break;
+            case '\\':
+                quoted += "\\\\";
+                break;
+            case '\n':
+                quoted += "\\n";
+                break;
+            case '\t':
+                quoted += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    quoted += fmt::format("\\u{:04x}", c);
+                } else {
+                    quoted += c;
+                }
+            }
+        }
+        return quoted + "\"";
+    }
+
+    /// JSON has no NaN, so values which weren't measured are null
+    std::string json_number(double value)
+    {
+        return std::isfinite(value) ? fmt::format("{}", value) : "null";
+    }
+
+    std::string metadata_json(const RunMetadata& metadata)
+    {
+        std::string json = fmt::format("{{\"type\":\"run\",\"version\":{},\"start_time\":{},\"host\":{},\"cpu\":{},\"cpus\":{},\"kernel\":{}",
+                                       results_version, json_string(metadata.start_time), json_string(metadata.host),
+                                       json_string(metadata.cpu), metadata.cpus, json_string(metadata.kernel));
+
+        json += ",\"command\":[";
+        for (std::size_t i = 0; i < metadata.command.size(); ++i) {
+            json += (i ? "," : "") + json_string(metadata.command[i]);
+        }
+
+        json += "],\"options\":{";
+        for (std::size_t i = 0; i < metadata.options.size(); ++i) {
+            json += fmt::format("{}{}:{}", i ? "," : "", json_string(metadata.options[i].first), json_string(metadata.options[i].second));
+        }
+
+        json += "},\"backends\":[";
+        for (std::size_t i = 0; i < metadata.backends.size(); ++i) {
+            json += fmt::format("{}{{\"name\":{},\"version\":{}}}", i ? "," : "", json_string(metadata.backends[i].first),
+                                json_string(metadata.backends[i].second));
+        }
+        return json + "]}";
+    }
+
+    std::string cpu_model()
+    {
+        std::ifstream cpuinfo("/proc/cpuinfo");
+        std::string   line;
+        while (std::getline(cpuinfo, line)) {
+            if (line.rfind("model name", 0) == 0) {
+                const auto colon = line.find(':');
+                return colon == std::string::npos ? line : line.substr(line.find_first_not_of(' ', colon + 1));
+            }
+        }
+        return "unknown";
+    }
+
+    template <typename T>
+    void write_value(std::FILE* file, T value)
+    {
+        std::fwrite(&value, sizeof(value), 1, file);
+    }
+
+    void write_string(std::FILE* file, std::string_view text, bool wide = false)
+    {
+        if (wide) {
+            write_value(file, static_cast<std::uint32_t>(text.size()));
+        } else {
+            write_value(file, static_cast<std::uint16_t>(text.size()));
+        }
+        std::fwrite(text.data(), 1, text.size(), file);
+    }
+} // namespace
+
+RunMetadata collect_run_metadata(int argc, char** argv, const std::vector<Backend>& backends)
+{
+    RunMetadata metadata;
+
+    char       buf[256] = {};
+    const auto now      = std::time(nullptr);
+    std::strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now));
+    metadata.start_time = buf;
+
+    if (gethostname(buf, sizeof(buf) - 1) == 0) {
+        metadata.host = buf;
+    }
+
+    utsname name;
+    if (uname(&name) == 0) {
+        metadata.kernel = fmt::format("{} {} {}", name.sysname, name.release, name.machine);
+    }
+
+    metadata.cpu  = cpu_model();
+    metadata.cpus = std::thread::hardware_concurrency();
+
+    metadata.command.assign(argv, argv + argc);
+
+    for (const auto& backend : backends) {
+        metadata.backends.emplace_back(backend.name, backend.version);
+    }
+
+    return metadata;
+}
+
+ResultsWriter::ResultsWriter(const std::string& path, ResultsFormat format, const RunMetadata& metadata)
+    : writing_(!path.empty()), format_(format), metadata_(metadata_json(metadata))
+{
+    if (!writing_)
+        return;
+
+    file_ = std::fopen(path.c_str(), "wb");
+    if (file_ && format_ == ResultsFormat::jsonl) {
+        fmt::print(file_, "{}\n", metadata_);
+    }
+}
+
+ResultsWriter::~ResultsWriter()
+{
+    if (!file_)
+        return;
+
+    if (format_ == ResultsFormat::columnar) {
+        write_columns();
+    }
+    std::fclose(file_);
+}
+
+ResultsWriter::Column& ResultsWriter::column(std::size_t i, std::string_view name, ColumnType type)
+{
+    // The columns are created by the first record, all others have the same fields
+    if (i == columns_.size()) {
+        columns_.push_back({std::string(name), type, {}, {}, {}, {}});
+    }
+    return columns_[i];
+}
+
+void ResultsWriter::add_string(Column& column, std::string_view value)
+{
+    auto it = std::find(column.dictionary.begin(), column.dictionary.end(), value);
+    if (it == column.dictionary.end()) {
+        column.dictionary.emplace_back(value);
+        it = column.dictionary.end() - 1;
+    }
+    column.index.push_back(static_cast<std::uint32_t>(it - column.dictionary.begin()));
+}
+
+void ResultsWriter::record(std::string_view test, int threads, const std::vector<Backend>& backends, const std::vector<Stats>& statistics)
+{
+    for (const auto& s : statistics) {
+        for (std::size_t b = 0; b < backends.size(); ++b) {
+            ResultRecord record{std::string(test), threads, backends[b].name, s.num_bytes, {}};
+            for_each_field(s.backends[b], std::max(1, threads), [&](const std::string& name, double value) { record.fields.emplace_back(name, value); });
+
+            if (file_ && format_ == ResultsFormat::jsonl) {
+                std::string line = fmt::format("{{\"type\":\"result\",\"test\":{},\"threads\":{},\"backend\":{},\"size\":{}",
+                                               json_string(record.test), record.threads, json_string(record.backend), record.size);
+                for (const auto& [name, value] : record.fields) {
+                    line += fmt::format(",{}:{}", json_string(name), json_number(value));
+                }
+                fmt::print(file_, "{}}}\n", line);
+            }
+
+            if (file_ && format_ == ResultsFormat::columnar) {
+                add_string(column(0, "test", ColumnType::string), record.test);
+                column(1, "threads", ColumnType::i64).i64.push_back(record.threads);
+                add_string(column(2, "backend", ColumnType::string), record.backend);
+                column(3, "size", ColumnType::i64).i64.push_back(record.size);
+
+                std::size_t i = 4;
+                for (const auto& [name, value] : record.fields) {
+                    column(i++, name, ColumnType::f64).f64.push_back(value);
+                }
+                ++rows_;
+            }
+
+            records_.push_back(std::move(record));
+        }
+    }
+
+    if (file_) {
+        std::fflush(file_);
+    }
+}
+
+void ResultsWriter::write_columns()
+{
+    std::fwrite(results_magic, 1, sizeof(results_magic), file_);
+    write_value(file_, results_version);
+    write_value(file_, static_cast<std::uint32_t>(columns_.size()));
+    write_value(file_, rows_);
+    write_string(file_, metadata_, true);
+
+    for (const auto& c : columns_) {
+        write_string(file_, c.name);
+        write_value(file_, c.type);
+
+        switch (c.type) {
+        case ColumnType::f64:
+            std::fwrite(c.f64.data(), sizeof(double), c.f64.size(), file_);
+            break;
+        case ColumnType::i64:
+            std::fwrite(c.i64.data(), sizeof(std::int64_t), c.i64.size(), file_);
+            break;
+        case ColumnType::string:
+            write_value(file_, static_cast<std::uint32_t>(c.dictionary.size()));
+            for (const auto& value : c.dictionary) {
+                write_string(file_, value);
+            }
+            std::fwrite(c.index.data(), sizeof(std::uint32_t), c.index.size(), file_);
+            break;
+        }
+    }
+}
+
+double ResultRecord::field(std::string_view name) const
+{
+    for (const auto& [n, value] : fields) {
+        if (n == name)
+            return value;
+    }
+    return NAN;
+}
+
+namespace
+{
+    /// Just enough JSON to read back what metadata_json() and ResultsWriter::record() write
+    struct JsonValue {
+        enum class Kind { null, boolean, number, string, array, object } kind = Kind::null;
+
+        double                                       number = 0.0;
+        std::string                                  string;
+        std::vector<JsonValue>                       array;
+        std::vector<std::pair<std::string, JsonValue>> object;
+
+        const JsonValue* find(std::string_view key) const
+        {
+            for (const auto& [k, v] : object) {
+                if (k == key)
+                    return &v;
+            }
+            return nullptr;
+        }
+    };
+
+    class JsonParser
+    {
+    public:
+        explicit JsonParser(std::string_view text) : text_(text) {}
+
+        bool parse(JsonValue& value)
+        {
+            return parse_value(value) && (skip_space(), pos_ == text_.size());
+        }
+
+    private:
+        void skip_space()
+        {
+            while (pos_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[pos_]))) {
+                ++pos_;
+            }
+        }
+
+        bool consume(char c)
+        {
+            skip_space();
+            if (pos_ < text_.size() && text_[pos_] == c) {
+                ++pos_;
+                return true;
+            }
+            return false;
+        }
+
+        bool parse_literal(std::string_view literal)
+        {
+            if (text_.substr(pos_, literal.size()) != literal)
+                return false;
+            pos_ += literal.size();
+            return true;
+        }
+
+        bool parse_string(std::string& out)
+        {
+            if (!consume('"'))
+                return false;
+
+            while (pos_ < text_.size() && text_[pos_] != '"') {
+                char c = text_[pos_++];
+                if (c != '\\') {
+                    out += c;
+                    continue;
+                }
+                if (pos_ >= text_.size())
+                    return false;
+
+                switch (char e = text_[pos_++]) {
+                case 'n':
+                    out += '\n';
+                    break;
+                case 't':
+                    out += '\t';
+                    break;
+                case 'u':
+                    // Only control characters are escaped this way
+                    if (pos_ + 4 > text_.size())
+                        return false;
+                    out += static_cast<char>(std::stoi(std::string(text_.substr(pos_, 4)), nullptr, 16));
+                    pos_ += 4;
+                    break;
+                default:
+                    out += e;
+                }
+            }
+            return consume('"');
+        }
+
+        bool parse_value(JsonValue& value)
+        {
+            skip_space();
+            if (pos_ >= text_.size())
+                return false;
+
+            const char c = text_[pos_];
+            if (c == '"') {
+                value.kind = JsonValue::Kind::string;
+                return parse_string(value.string);
+            }
+
+            if (c == '[') {
+                value.kind = JsonValue::Kind::array;
+                ++pos_;
+                if (consume(']'))
+                    return true;
+                do {
+                    value.array.emplace_back();
+                    if (!parse_value(value.array.back()))
+                        return false;
+                } while (consume(','));
+                return consume(']');
+            }
+
+            if (c == '{') {
+                value.kind = JsonValue::Kind::object;
+                ++pos_;
+                if (consume('}'))
+                    return true;
+                do {
+                    std::string key;
+                    if (!parse_string(key) || !consume(':'))
+                        return false;
+                    value.object.emplace_back(std::move(key), JsonValue{});
+                    if (!parse_value(value.object.back().second))
+                        return false;
+                } while (consume(','));
+                return consume('}');
+            }
+
+            if (parse_literal("null")) {
+                value.kind = JsonValue::Kind::null;
+                return true;
+            }
+            if (parse_literal("true")) {
+                value.kind   = JsonValue::Kind::boolean;
+                value.number = 1.0;
+                return true;
+            }
+            if (parse_literal("false")) {
+                value.kind = JsonValue::Kind::boolean;
+                return true;
+            }
+
+            const std::string number(text_.substr(pos_, 64));
+            char*             end = nullptr;
+            value.kind            = JsonValue::Kind::number;
+            value.number          = std::strtod(number.c_str(), &end);
+            if (end == number.c_str())
+                return false;
+            pos_ += end - number.c_str();
+            return true;
+        }
+
+        std::string_view text_;
+        std::size_t      pos_ = 0;
+    };
+
+    bool parse_json(std::string_view text, JsonValue& value)
+    {
+        return JsonParser(text).parse(value);
+    }
+
+    void read_run(const JsonValue& value, RunMetadata& run)
+    {
+        if (const auto* cmd = value.find("command")) {
+            for (const auto& arg : cmd->array) {
+                run.command.push_back(arg.string);
+            }
+        }
+        if (const auto* options = value.find("options")) {
+            for (const auto& [key, option] : options->object) {
+                run.options.emplace_back(key, option.string);
+            }
+        }
+    }
+
+    bool load_jsonl(std::FILE* file, RunMetadata& run, std::vector<ResultRecord>& records, std::string& error)
+    {
+        std::string line;
+        long        number = 0;
+
+        for (int c; (c = std::fgetc(file)) != EOF || !line.empty();) {
+            if (c != '\n' && c != EOF) {
+                line += static_cast<char>(c);
+                continue;
+            }
+            ++number;
+
+            JsonValue value;
+            if (!parse_json(line, value) || value.kind != JsonValue::Kind::object) {
+                error = fmt::format("line {} is not a JSON object", number);
+                return false;
+            }
+            line.clear();
+
+            const auto* type = value.find("type");
+            if (type && type->string == "run") {
+                read_run(value, run);
+                continue;
+            }
+
+            ResultRecord record;
+            for (const auto& [key, v] : value.object) {
+                if (key == "type") {
+                    continue;
+                } else if (key == "test") {
+                    record.test = v.string;
+                } else if (key == "backend") {
+                    record.backend = v.string;
+                } else if (key == "threads") {
+                    record.threads = static_cast<int>(v.number);
+                } else if (key == "size") {
+                    record.size = static_cast<long>(v.number);
+                } else {
+                    record.fields.emplace_back(key, v.kind == JsonValue::Kind::number ? v.number : NAN);
+                }
+            }
+            records.push_back(std::move(record));
+        }
+        return true;
+    }
+
+    template <typename T>
+    bool read_value(std::FILE* file, T& value)
+    {
+        return std::fread(&value, sizeof(value), 1, file) == 1;
+    }
+
+    bool read_string(std::FILE* file, std::string& text, bool wide = false)
+    {
+        std::uint32_t size = 0;
+        if (wide) {
+            if (!read_value(file, size))
+                return false;
+        } else {
+            std::uint16_t narrow = 0;
+            if (!read_value(file, narrow))
+                return false;
+            size = narrow;
+        }
+
+        text.resize(size);
+        return std::fread(text.data(), 1, size, file) == size;
+    }
+
+    bool load_columnar(std::FILE* file, RunMetadata& run, std::vector<ResultRecord>& records, std::string& error)
+    {
+        std::uint32_t version = 0, num_columns = 0;
+        std::uint64_t num_rows = 0;
+        std::string   metadata;
+
+        if (!read_value(file, version) || !read_value(file, num_columns) || !read_value(file, num_rows) || !read_string(file, metadata, true)) {
+            error = "truncated header";
+            return false;
+        }
+        if (version != results_version) {
+            error = fmt::format("unsupported version {}", version);
+            return false;
+        }
+
+        JsonValue value;
+        if (parse_json(metadata, value)) {
+            read_run(value, run);
+        }
+
+        const auto first = records.size();
+        records.resize(first + num_rows);
+
+        for (std::uint32_t c = 0; c < num_columns; ++c) {
+            std::string  name;
+            std::uint8_t type = 0;
+            if (!read_string(file, name) || !read_value(file, type)) {
+                error = "truncated column header";
+                return false;
+            }
+
+            for (std::uint64_t r = 0; r < num_rows && type != 2; ++r) {
+                double       f64 = 0.0;
+                std::int64_t i64 = 0;
+                if (type == 0 ? !read_value(file, f64) : !read_value(file, i64)) {
+                    error = fmt::format("truncated column '{}'", name);
+                    return false;
+                }
+
+                auto& record = records[first + r];
+                if (name == "threads") {
+                    record.threads = static_cast<int>(i64);
+                } else if (name == "size") {
+                    record.size = static_cast<long>(i64);
+                } else {
+                    record.fields.emplace_back(name, type == 0 ? f64 : static_cast<double>(i64));
+                }
+            }
+
+            if (type == 2) {
+                std::uint32_t            size = 0;
+                std::vector<std::string> dictionary;
+                bool                     ok = read_value(file, size);
+                for (std::uint32_t i = 0; ok && i < size; ++i) {
+                    ok = read_string(file, dictionary.emplace_back());
+                }
+
+                for (std::uint64_t r = 0; ok && r < num_rows; ++r) {
+                    std::uint32_t index = 0;
+                    ok                  = read_value(file, index) && index < dictionary.size();
+                    if (ok) {
+                        (name == "test" ? records[first + r].test : records[first + r].backend) = dictionary[index];
+                    }
+                }
+
+                if (!ok) {
+                    error = fmt::format("broken column '{}'", name);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+} // namespace
+
+bool load_results(const std::string& path, RunMetadata& run, std::vector<ResultRecord>& records, std::string& error)
+{
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) {
+        error = std::strerror(errno);
+        return false;
+    }
+
+    char magic[sizeof(results_magic)] = {};
+    const bool columnar = std::fread(magic, 1, sizeof(magic), file) == sizeof(magic) && std::equal(magic, magic + sizeof(magic), results_magic);
+    if (!columnar) {
+        std::rewind(file);
+    }
+
+    const bool ok = columnar ? load_columnar(file, run, records, error) : load_jsonl(file, run, records, error);
+    std::fclose(file);
+    return ok;
+}
@@ -0,0 +1,275 @@
+#include "soak.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <thread>
+
+#include <fmt/format.h>
+
+#include "memory_stats.h"
+#include "op_stream.h"
+#include "options.h"
+#include "perf_counters.h"
+#include "thread_pool.h"
+#include "timer.h"
+#include "util.h"
+#include "workload_model.h"
+
+namespace
+{
+    /// Operations between two hand overs of a thread's measurements to the sampler
+    constexpr long soak_chunk = 1024;
+
+    /// Measurements of one thread since the last sample, the thread adds to it after every chunk
+    struct SoakThreadState {
+        std::mutex   mtx;
+        BackendStats interval;
+        std::size_t  live_bytes = 0;
+    };
+
+    /// Slots in the order they are replaced: shuffled permutations of all slots one after the
+    /// other, so a timer batch within a chunk never frees the same slot twice
+    std::vector<std::uint32_t> replacement_order(long live_blocks, std::mt19937_64& gen)
+    {
+        constexpr int permutations = 4;
+
+        std::vector<std::uint32_t> order(permutations * live_blocks);
+        for (int p = 0; p < permutations; ++p) {
+            auto first = order.begin() + p * live_blocks;
+            std::iota(first, first + live_blocks, 0);
+            std::shuffle(first, first + live_blocks, gen);
+        }
+        return order;
+    }
+
+    void soak_thread(const Backend& backend, long live_blocks, int thread_id, SoakThreadState& state, SpinBarrier& filled,
+                     const std::atomic<bool>& stop)
+    {
+        std::mt19937_64 gen(stream_seed(0, thread_id));
+        const auto      order = replacement_order(live_blocks, gen);
+        const auto      sizes = sample_sizes(order.size(), gen());
+
+        std::vector<void*>         slots(live_blocks);
+        std::vector<std::uint64_t> slot_sizes(live_blocks);
+        std::size_t                live_bytes = 0;
+
+        // The initial working set isn't timed
+        for (long i = 0; i < live_blocks; ++i) {
+            slot_sizes[i] = sizes[i];
+            slots[i]      = backend.malloc(slot_sizes[i]);
+            touch_block(slots[i], slot_sizes[i]);
+            live_bytes += slot_sizes[i];
+        }
+        {
+            std::scoped_lock _(state.mtx);
+            state.live_bytes = live_bytes;
+        }
+        filled.arrive_and_wait();
+
+        BackendStats local;
+        std::size_t  position = 0;
+
+        while (!stop.load(std::memory_order_relaxed)) {
+            for (long j = 0; j < soak_chunk; j += timer_batch_size) {
+                const long ops = std::min(timer_batch_size, soak_chunk - j);
+                const auto* op = &order[position + j];
+
+                phase_begin(Phase::free);
+                auto free_start = timer_start();
+                for (long k = 0; k < ops; ++k) {
+                    backend.free(slots[op[k]]);
+                }
+                auto free_end = timer_stop();
+                phase_end(Phase::free);
+                local.record_free(timer_elapsed(free_start, free_end), ops);
+
+                phase_begin(Phase::alloc);
+                auto alloc_start = timer_start();
+                for (long k = 0; k < ops; ++k) {
+                    slots[op[k]] = backend.malloc(sizes[position + j + k]);
+                }
+                auto alloc_end = timer_stop();
+                phase_end(Phase::alloc);
+                local.record_alloc(timer_elapsed(alloc_start, alloc_end), ops);
+
+                for (long k = 0; k < ops; ++k) {
+                    escape(slots[op[k]]);
+                    live_bytes += sizes[position + j + k] - slot_sizes[op[k]];
+                    slot_sizes[op[k]] = sizes[position + j + k];
+                    local.bytes += slot_sizes[op[k]];
+                }
+
+                if (touch_policy != TouchPolicy::none) {
+                    auto touch_start = timer_start();
+                    for (long k = 0; k < ops; ++k) {
+                        local.touched_pages += touch_block(slots[op[k]], slot_sizes[op[k]]);
+                    }
+                    auto touch_end = timer_stop();
+                    local.touch_elapsed += timer_elapsed(touch_start, touch_end);
+                }
+            }
+            position = (position + soak_chunk) % order.size();
+
+            std::scoped_lock _(state.mtx);
+            auto& interval = state.interval;
+            interval.alloc_latency.merge(local.alloc_latency);
+            interval.free_latency.merge(local.free_latency);
+            interval.alloc_elapsed += local.alloc_elapsed;
+            interval.free_elapsed += local.free_elapsed;
+            interval.touch_elapsed += local.touch_elapsed;
+            interval.touched_pages += local.touched_pages;
+            interval.bytes += local.bytes;
+            state.live_bytes = live_bytes;
+            local            = BackendStats{};
+        }
+
+        for (long i = 0; i < live_blocks; ++i) {
+            backend.free(slots[i]);
+        }
+    }
+
+    void print_soak_header(const Backend& backend)
+    {
+        fmt::print("|{:-^10}||{:-^81}||\n", "", backend.name);
+        fmt::print("|{:^10}|| {:^9} | {:^9} | {:^9} | {:^9} | {:^9} | {:^9} | {:^9} ||\n", "Time s", "Mops/s", "Alloc p50", "Alloc p99",
+                   "Alloc max", "Free p99", "Live MB", "RSS MB");
+    }
+
+    void print_soak_sample(double seconds, const BackendStats& sample)
+    {
+        fmt::print("| {:>8.1f} || {:>9.3f} | {:>9} | {:>9} | {:>9} | {:>9} | {:>9.1f} | {:>9.1f} ||\n", seconds,
+                   (sample.alloc_rate + sample.free_latency.count() / sample.wall_elapsed.count()) * 1e-6,
+                   sample.alloc_latency.percentile(50), sample.alloc_latency.percentile(99), sample.alloc_latency.max(),
+                   sample.free_latency.percentile(99), static_cast<double>(sample.memory.peak_requested) / megabyte,
+                   static_cast<double>(sample.memory.peak_rss) / megabyte);
+    }
+
+    /// Relative change between the first and the last samples, e.g. +5% RSS after an hour
+    void print_soak_drift(const Backend& backend, const std::vector<BackendStats>& series)
+    {
+        // A quarter of the series on each end, so a single noisy interval doesn't decide it
+        const std::size_t window = std::max<std::size_t>(1, series.size() / 4);
+
+        const auto average = [&](std::size_t first, auto value) {
+            double sum = 0;
+            for (std::size_t i = first; i < first + window; ++i) {
+                sum += value(series[i]);
+            }
+            return sum / window;
+        };
+        const auto drift = [&](auto value) {
+            const double begin = average(0, value);
+            const double end   = average(series.size() - window, value);
+            return begin > 0 ? (end / begin - 1.0) * 100.0 : 0.0;
+        };
+
+        fmt::print("Drift of {} from the first to the last {} interval(s): throughput {:+.1f}%, alloc p99 {:+.1f}%, RSS {:+.1f}%\n\n",
+                   backend.name, window, drift([](const BackendStats& s) { return s.alloc_rate; }),
+                   drift([](const BackendStats& s) { return static_cast<double>(s.alloc_latency.percentile(99)); }),
+                   drift([](const BackendStats& s) { return static_cast<double>(s.memory.peak_rss); }));
+    }
+
+    void soak_backend(const Backend& backend, const SoakConfig& config, long live_blocks, ResultsWriter* results)
+    {
+        std::vector<SoakThreadState> states(config.threads);
+        std::atomic<bool>            stop{false};
+        SpinBarrier                  filled(config.threads + 1);
+
+        const auto baseline = read_process_memory();
+        HeapStats  heap;
+
+        auto                     cpu_sets = affinity_cpu_sets(worker_affinity, config.threads);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < config.threads; ++t) {
+            threads.emplace_back([&, t] {
+                pin_current_thread(cpu_sets[t]);
+                BackendThreadScope scope(backend);
+                soak_thread(backend, live_blocks, t, states[t], filled, stop);
+            });
+        }
+        filled.arrive_and_wait();
+
+        print_soak_header(backend);
+
+        std::vector<BackendStats> series;
+        const auto                start = stdclock::now();
+        auto                      last  = start;
+
+        for (long i = 1; i * config.interval <= config.duration; ++i) {
+            std::this_thread::sleep_until(start + std::chrono::duration_cast<stdclock::duration>(fsec(i * config.interval)));
+
+            BackendStats sample;
+            std::size_t  live_bytes = 0;
+            for (auto& state : states) {
+                std::scoped_lock _(state.mtx);
+                sample.alloc_latency.merge(state.interval.alloc_latency);
+                sample.free_latency.merge(state.interval.free_latency);
+                sample.alloc_elapsed += state.interval.alloc_elapsed;
+                sample.free_elapsed += state.interval.free_elapsed;
+                sample.touch_elapsed += state.interval.touch_elapsed;
+                sample.touched_pages += state.interval.touched_pages;
+                sample.bytes += state.interval.bytes;
+                live_bytes += state.live_bytes;
+                state.interval = BackendStats{};
+            }
+
+            const auto now      = stdclock::now();
+            sample.wall_elapsed = now - last;
+            last                = now;
+
+            // Times are the average over the threads, like in the threaded tests
+            sample.alloc_elapsed /= config.threads;
+            sample.free_elapsed /= config.threads;
+            sample.touch_elapsed /= config.threads;
+            sample.alloc_rate = sample.alloc_latency.count() / sample.wall_elapsed.count();
+            sample.byte_rate  = sample.bytes / sample.wall_elapsed.count();
+
+            const auto memory            = read_process_memory();
+            sample.memory.samples        = 1;
+            sample.memory.peak_requested = live_bytes;
+            sample.memory.peak_rss       = memory.rss > baseline.rss ? memory.rss - baseline.rss : 0;
+            sample.memory.peak_pss       = memory.pss > baseline.pss ? memory.pss - baseline.pss : 0;
+            sample.memory.peak_anon_huge = memory.anon_huge > baseline.anon_huge ? memory.anon_huge - baseline.anon_huge : 0;
+            sample.memory.peak_heap      = backend.heap_stats && backend.heap_stats(heap) ? heap.mapped : 0;
+            sample.memory.peak_overhead  = live_bytes ? static_cast<double>(sample.memory.peak_rss) / live_bytes : 0.0;
+
+            print_soak_sample(fsec(now - start).count(), sample);
+            if (results) {
+                // Keyed by the interval, which matches between runs unlike the time since the start
+                results->record("soak", config.threads, {backend}, {Stats{i, {sample}}});
+            }
+            series.push_back(std::move(sample));
+        }
+
+        stop.store(true, std::memory_order_relaxed);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        if (!series.empty()) {
+            print_soak_drift(backend, series);
+        }
+    }
+} // namespace
+
+void soak_alloc(const std::vector<Backend>& backends, const SoakConfig& config, ResultsWriter* results)
+{
+    long live_blocks = soak_chunk;
+    while (live_blocks < config.live_blocks) {
+        live_blocks *= 2;
+    }
+
+    for (const auto& backend : backends) {
+        // Blocks of a bulk release backend are only returned at a phase boundary, which a single
+        // long phase never reaches, so its footprint would grow until the machine runs out of memory
+        if (backend.release) {
+            fmt::print("Skipping {}: it only releases its blocks in bulk, which the soak test never does\n\n", backend.name);
+            continue;
+        }
+        soak_backend(backend, config, live_blocks, results);
+    }
+}
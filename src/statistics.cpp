@@ -0,0 +1,96 @@
+#include "statistics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+double median(std::vector<double>& values)
+{
+    if (values.empty())
+        return 0.0;
+
+    const auto mid = values.size() / 2;
+    std::nth_element(values.begin(), values.begin() + mid, values.end());
+    const double upper = values[mid];
+
+    if (values.size() % 2)
+        return upper;
+
+    const double lower = *std::max_element(values.begin(), values.begin() + mid);
+    return (lower + upper) / 2.0;
+}
+
+Summary summarize(std::vector<double> samples, double confidence, int resamples)
+{
+    Summary summary;
+    summary.trials = samples.size();
+    if (samples.empty())
+        return summary;
+
+    summary.median = median(samples);
+
+    std::vector<double> deviations;
+    deviations.reserve(samples.size());
+    for (double s : samples) {
+        deviations.push_back(std::abs(s - summary.median));
+    }
+    summary.mad = median(deviations);
+
+    // 1.4826 scales the MAD to the standard deviation of a normal distribution
+    const double limit = outlier_mads * 1.4826 * summary.mad;
+    if (limit > 0.0) {
+        const auto kept = std::remove_if(samples.begin(), samples.end(), [&](double s) { return std::abs(s - summary.median) > limit; });
+        summary.outliers = samples.end() - kept;
+        samples.erase(kept, samples.end());
+    }
+    summary.kept = samples.size();
+
+    // Everything reported is of the kept samples, so the interval brackets the reported median
+    if (summary.outliers > 0) {
+        summary.median = median(samples);
+
+        deviations.clear();
+        for (double s : samples) {
+            deviations.push_back(std::abs(s - summary.median));
+        }
+        summary.mad = median(deviations);
+    }
+
+    if (samples.size() < 2) {
+        summary.ci_low = summary.ci_high = summary.median;
+        return summary;
+    }
+
+    // Fixed seed, so the same samples always give the same interval
+    std::mt19937_64                            rng(samples.size());
+    std::uniform_int_distribution<std::size_t> pick(0, samples.size() - 1);
+
+    std::vector<double> medians;
+    std::vector<double> resample(samples.size());
+    medians.reserve(resamples);
+
+    for (int r = 0; r < resamples; ++r) {
+        for (auto& value : resample) {
+            value = samples[pick(rng)];
+        }
+        medians.push_back(median(resample));
+    }
+
+    std::sort(medians.begin(), medians.end());
+
+    const double tail = (1.0 - confidence) / 2.0;
+    const auto   low  = static_cast<std::size_t>(std::floor(tail * (medians.size() - 1)));
+    const auto   high = static_cast<std::size_t>(std::ceil((1.0 - tail) * (medians.size() - 1)));
+
+    summary.ci_low  = medians[low];
+    summary.ci_high = medians[high];
+    return summary;
+}
+
+bool significant(const Summary& a, const Summary& b)
+{
+    if (!a.has_interval() || !b.has_interval())
+        return false;
+
+    return a.ci_high < b.ci_low || b.ci_high < a.ci_low;
+}
@@ -0,0 +1,226 @@
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "topology.h"
+#include "util.h"
+
+bool parse_affinity(std::string_view name, Affinity& affinity)
+{
+    if (name == "none") {
+        affinity = Affinity::none;
+    } else if (name == "compact") {
+        affinity = Affinity::compact;
+    } else if (name == "scatter") {
+        affinity = Affinity::scatter;
+    } else if (name == "numa") {
+        affinity = Affinity::numa;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+namespace
+{
+    /// Rank of each value in order of first appearance within its group
+    template <typename Key, typename Value>
+    int rank_of(std::map<Key, std::vector<Value>>& groups, const Key& key, const Value& value)
+    {
+        auto& members = groups[key];
+        auto  it      = std::find(members.begin(), members.end(), value);
+        if (it == members.end()) {
+            members.push_back(value);
+            return static_cast<int>(members.size()) - 1;
+        }
+        return static_cast<int>(it - members.begin());
+    }
+
+    /// Order CPUs, so that the first CPUs are as far apart as possible
+    std::vector<int> scatter_order(const std::vector<CpuInfo>& cpus)
+    {
+        std::map<int, std::vector<int>>                 nodes;
+        std::map<int, std::vector<int>>                 llcs;
+        std::map<std::pair<int, int>, std::vector<int>> cores;
+        std::map<std::tuple<int, int>, std::vector<int>> threads;
+
+        std::vector<std::tuple<int, int, int, int, int>> keys;
+        for (const auto& c : cpus) {
+            const int node    = rank_of(nodes, 0, c.node);
+            const int llc     = rank_of(llcs, c.node, c.llc);
+            const int core    = rank_of(cores, {c.node, c.llc}, c.package * 100000 + c.core);
+            const int sibling = rank_of(threads, {c.package, c.core}, c.cpu);
+            keys.emplace_back(sibling, core, llc, node, c.cpu);
+        }
+
+        std::sort(keys.begin(), keys.end());
+
+        std::vector<int> order;
+        for (const auto& k : keys) {
+            order.push_back(std::get<4>(k));
+        }
+        return order;
+    }
+
+    /// Order CPUs, so that neighbours share as much as possible
+    std::vector<int> compact_order(std::vector<CpuInfo> cpus)
+    {
+        std::sort(cpus.begin(), cpus.end(), [](const CpuInfo& a, const CpuInfo& b) {
+            return std::tie(a.node, a.package, a.llc, a.core, a.cpu) < std::tie(b.node, b.package, b.llc, b.core, b.cpu);
+        });
+
+        std::vector<int> order;
+        for (const auto& c : cpus) {
+            order.push_back(c.cpu);
+        }
+        return order;
+    }
+} // namespace
+
+std::vector<std::vector<int>> affinity_cpu_sets(Affinity affinity, int num_threads)
+{
+    std::vector<std::vector<int>> sets(num_threads);
+    if (affinity == Affinity::none)
+        return sets;
+
+    const auto cpus = read_cpu_topology();
+    if (cpus.empty())
+        return sets;
+
+    if (affinity == Affinity::numa) {
+        std::map<int, std::vector<int>> nodes;
+        for (const auto& c : cpus) {
+            nodes[c.node].push_back(c.cpu);
+        }
+
+        std::vector<std::vector<int>> node_cpus;
+        for (auto& [node, list] : nodes) {
+            node_cpus.push_back(std::move(list));
+        }
+
+        for (int i = 0; i < num_threads; ++i) {
+            sets[i] = node_cpus[i % node_cpus.size()];
+        }
+        return sets;
+    }
+
+    const auto order = affinity == Affinity::compact ? compact_order(cpus) : scatter_order(cpus);
+    for (int i = 0; i < num_threads; ++i) {
+        sets[i] = {order[i % order.size()]};
+    }
+    return sets;
+}
+
+bool pin_current_thread(const std::vector<int>& cpus)
+{
+    if (cpus.empty())
+        return true;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus) {
+        CPU_SET(cpu, &set);
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+bool SpinBarrier::arrive_and_wait()
+{
+    const auto generation = generation_.load(std::memory_order_acquire);
+
+    if (waiting_.fetch_add(1, std::memory_order_acq_rel) + 1 == count_) {
+        waiting_.store(0, std::memory_order_relaxed);
+        generation_.store(generation + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Workers may share cores, so the last one to arrive may need the core of a waiting one
+    wait_until([&] { return generation_.load(std::memory_order_acquire) != generation; });
+    return false;
+}
+
+WorkerPool::WorkerPool(int num_threads, Affinity affinity) : start_(num_threads), end_times_(num_threads)
+{
+    auto sets = affinity_cpu_sets(affinity, num_threads);
+
+    threads_.reserve(num_threads);
+    for (int i = 0; i < num_threads; ++i) {
+        threads_.emplace_back(&WorkerPool::work, this, i, std::move(sets[i]));
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::scoped_lock _(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+
+    for (auto& t : threads_) {
+        t.join();
+    }
+}
+
+void WorkerPool::run(const std::function<void(int)>& task)
+{
+    std::unique_lock lock(mutex_);
+    task_    = &task;
+    running_ = size();
+    ++job_;
+    wake_.notify_all();
+
+    done_.wait(lock, [this] { return running_ == 0; });
+    task_ = nullptr;
+}
+
+bool WorkerPool::start_together()
+{
+    if (start_.arrive_and_wait()) {
+        start_time_ = stdclock::now();
+        return true;
+    }
+    return false;
+}
+
+void WorkerPool::finish(int thread_id)
+{
+    end_times_[thread_id] = stdclock::now();
+}
+
+fsec WorkerPool::wall_elapsed() const
+{
+    const auto end = *std::max_element(end_times_.begin(), end_times_.end());
+    return end > start_time_ ? fsec(end - start_time_) : fsec{};
+}
+
+void WorkerPool::work(int thread_id, std::vector<int> cpus)
+{
+    pin_current_thread(cpus);
+
+    unsigned long seen = 0;
+    for (;;) {
+        const std::function<void(int)>* task;
+        {
+            std::unique_lock lock(mutex_);
+            wake_.wait(lock, [&] { return stop_ || job_ != seen; });
+            if (stop_)
+                return;
+
+            seen = job_;
+            task = task_;
+        }
+
+        (*task)(thread_id);
+
+        std::scoped_lock _(mutex_);
+        if (--running_ == 0) {
+            done_.notify_one();
+        }
+    }
+}
@@ -0,0 +1,104 @@
+#include "timer.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+
+#ifdef HAVE_TSC_TIMER
+#include <cpuid.h>
+#endif
+
+namespace
+{
+    bool has_invariant_tsc()
+    {
+#ifdef HAVE_TSC_TIMER
+        unsigned int eax, ebx, ecx, edx;
+        if (!__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) || eax < 0x80000007)
+            return false;
+
+        // CPUID.80000007H:EDX[8] is the invariant TSC flag
+        __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+        return (edx >> 8) & 1;
+#else
+        return false;
+#endif
+    }
+
+    /// Compare the TSC against the steady clock over a few milliseconds, and take the median of
+    /// several tries to be robust against being descheduled
+    double calibrate_ns_per_tick()
+    {
+        std::vector<double> samples;
+
+        for (int i = 0; i < 5; ++i) {
+            auto  clock_start = stdclock::now();
+            ticks tsc_start   = timer_start();
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+            ticks tsc_end   = timer_stop();
+            auto  clock_end = stdclock::now();
+
+            auto ns = std::chrono::duration<double, std::nano>(clock_end - clock_start).count();
+            samples.push_back(ns / (tsc_end - tsc_start));
+        }
+
+        std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+        return samples[samples.size() / 2];
+    }
+
+    /// The cheapest empty timed region is the fixed cost paid by every measurement
+    ticks measure_overhead()
+    {
+        ticks overhead = ~ticks{0};
+
+        for (int i = 0; i < 10000; ++i) {
+            ticks start = timer_start();
+            ticks stop  = timer_stop();
+            overhead    = std::min(overhead, stop - start);
+        }
+        return overhead;
+    }
+} // namespace
+
+bool parse_timer_source(std::string_view name, TimerSource& source)
+{
+    if (name == "steady") {
+        source = TimerSource::steady_clock;
+        return true;
+    }
+
+    if (name == "tsc") {
+        source = TimerSource::tsc;
+        return true;
+    }
+
+    return false;
+}
+
+TimerSource init_timer(TimerSource requested)
+{
+    timer_source      = TimerSource::steady_clock;
+    timer_ns_per_tick = 1.0;
+    timer_overhead    = 0;
+
+    if (requested == TimerSource::tsc) {
+        if (has_invariant_tsc()) {
+            timer_source      = TimerSource::tsc;
+            timer_ns_per_tick = calibrate_ns_per_tick();
+        } else {
+            fmt::print("No invariant TSC available, falling back to the steady clock\n");
+        }
+    }
+
+    timer_overhead = measure_overhead();
+
+    if (timer_source == TimerSource::tsc) {
+        fmt::print("Using TSC timer with {:.3f} GHz, overhead of {} ticks\n", 1.0 / timer_ns_per_tick, timer_overhead);
+    }
+
+    return timer_source;
+}
@@ -0,0 +1,128 @@
+#include "topology.h"
+
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <string>
+
+#include <sched.h>
+
+namespace
+{
+    bool read_line(const std::string& path, std::string& line)
+    {
+        std::ifstream file(path);
+        return file && std::getline(file, line);
+    }
+
+    int read_int(const std::string& path, int fallback)
+    {
+        std::string line;
+        int         value = fallback;
+        if (read_line(path, line)) {
+            std::from_chars(line.data(), line.data() + line.size(), value);
+        }
+        return value;
+    }
+
+    /// The level 3 cache is not always index3, so look for the one that says it's level 3
+    int read_llc_id(int cpu, int fallback)
+    {
+        const auto base = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cache/index";
+        for (int index = 0; index < 8; ++index) {
+            if (read_int(base + std::to_string(index) + "/level", 0) == 3) {
+                return read_int(base + std::to_string(index) + "/id", fallback);
+            }
+        }
+        return fallback;
+    }
+
+    /// Nodes listed in /sys/devices/system/node/<file>, empty without NUMA support
+    std::vector<int> read_node_list(const char* file)
+    {
+        std::string      line;
+        std::vector<int> nodes;
+        if (read_line(std::string("/sys/devices/system/node/") + file, line)) {
+            parse_cpu_list(line, nodes);
+        }
+        return nodes;
+    }
+} // namespace
+
+bool parse_cpu_list(std::string_view text, std::vector<int>& list)
+{
+    while (!text.empty()) {
+        const auto comma = text.find(',');
+        const auto range = text.substr(0, comma);
+        text             = comma == std::string_view::npos ? std::string_view{} : text.substr(comma + 1);
+
+        if (range.empty() || range == "\n")
+            continue;
+
+        int  first = 0;
+        auto res   = std::from_chars(range.data(), range.data() + range.size(), first);
+        if (res.ec != std::errc{})
+            return false;
+
+        int last = first;
+        if (res.ptr != range.data() + range.size() && *res.ptr == '-') {
+            res = std::from_chars(res.ptr + 1, range.data() + range.size(), last);
+            if (res.ec != std::errc{})
+                return false;
+        }
+
+        for (int i = first; i <= last; ++i) {
+            list.push_back(i);
+        }
+    }
+    return true;
+}
+
+std::vector<CpuInfo> read_cpu_topology()
+{
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+        CPU_SET(0, &allowed);
+    }
+
+    std::vector<CpuInfo> cpus;
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (!CPU_ISSET(cpu, &allowed))
+            continue;
+
+        const auto base = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+
+        CpuInfo info;
+        info.cpu     = cpu;
+        info.core    = read_int(base + "core_id", cpu);
+        info.package = read_int(base + "physical_package_id", 0);
+        info.llc     = read_llc_id(cpu, info.package);
+        cpus.push_back(info);
+    }
+
+    for (int node : read_node_list("online")) {
+        std::string      line;
+        std::vector<int> node_cpus;
+        if (!read_line("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist", line)
+            || !parse_cpu_list(line, node_cpus))
+            continue;
+
+        for (auto& info : cpus) {
+            if (std::find(node_cpus.begin(), node_cpus.end(), info.cpu) != node_cpus.end()) {
+                info.node = node;
+            }
+        }
+    }
+
+    return cpus;
+}
+
+std::vector<int> memory_nodes()
+{
+    auto nodes = read_node_list("has_memory");
+    if (nodes.empty()) {
+        nodes.push_back(0);
+    }
+    return nodes;
+}
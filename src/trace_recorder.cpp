@@ -0,0 +1,357 @@
+// Allocation trace recorder, preload it into the program which should be traced:
+//
+//     LD_PRELOAD=liballoc_trace.so ALLOC_TRACE_FILE=my.%p.trace ./program
+//
+// All malloc family calls are forwarded to glibc and recorded into per thread buffers, which are
+// written to the trace file whenever they are full, when the thread exits and at program exit.
+// Every process writes its own file, named after its pid, so forked and executed children don't
+// overwrite the trace of their parent.
+// The recorder must never allocate itself, so buffers come straight from mmap and only raw
+// syscalls are used for the output.
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "trace.h"
+
+extern "C" {
+void* __libc_malloc(std::size_t);
+void* __libc_calloc(std::size_t, std::size_t);
+void* __libc_realloc(void*, std::size_t);
+void* __libc_memalign(std::size_t, std::size_t);
+void  __libc_free(void*);
+}
+
+namespace
+{
+    /// Records per thread buffer, 1 MB each
+    constexpr std::size_t buffer_capacity = (1 << 20) / sizeof(TraceRecord);
+
+    /// Upper limit of threads which are alive at the same time
+    constexpr std::size_t max_threads = 4096;
+
+    struct ThreadBuffer {
+        std::uint32_t thread;
+        std::size_t   count;
+        TraceRecord   records[buffer_capacity];
+    };
+
+    int                        trace_fd = -1;
+    pthread_mutex_t            trace_mutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_key_t              exit_key;
+    std::atomic<std::uint32_t> next_thread{0};
+    ThreadBuffer*              live_buffers[max_threads];
+    std::uint64_t              start_time;
+
+    thread_local ThreadBuffer* thread_buffer __attribute__((tls_model("initial-exec"))) = nullptr;
+    thread_local bool          in_hook __attribute__((tls_model("initial-exec")))       = false;
+
+    std::uint64_t now_ns()
+    {
+        timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<std::uint64_t>(ts.tv_sec) * 1000000000ull + ts.tv_nsec;
+    }
+
+    void write_all(const void* data, std::size_t size)
+    {
+        auto* bytes = static_cast<const char*>(data);
+        while (size > 0) {
+            ssize_t n = write(trace_fd, bytes, size);
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n <= 0)
+                return;
+            bytes += n;
+            size -= n;
+        }
+    }
+
+    /// Caller must hold trace_mutex
+    void flush_locked(ThreadBuffer* buffer)
+    {
+        if (trace_fd >= 0 && buffer->count > 0) {
+            write_all(buffer->records, buffer->count * sizeof(TraceRecord));
+        }
+        buffer->count = 0;
+    }
+
+    void release_buffer(void* ptr)
+    {
+        auto* buffer = static_cast<ThreadBuffer*>(ptr);
+
+        pthread_mutex_lock(&trace_mutex);
+        flush_locked(buffer);
+        for (auto& slot : live_buffers) {
+            if (slot == buffer) {
+                slot = nullptr;
+            }
+        }
+        pthread_mutex_unlock(&trace_mutex);
+
+        thread_buffer = nullptr;
+        munmap(buffer, sizeof(ThreadBuffer));
+    }
+
+    ThreadBuffer* acquire_buffer()
+    {
+        void* mem = mmap(nullptr, sizeof(ThreadBuffer), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mem == MAP_FAILED)
+            return nullptr;
+
+        auto* buffer   = static_cast<ThreadBuffer*>(mem);
+        buffer->thread = next_thread.fetch_add(1, std::memory_order_relaxed);
+        buffer->count  = 0;
+
+        pthread_mutex_lock(&trace_mutex);
+        for (auto& slot : live_buffers) {
+            if (!slot) {
+                slot = buffer;
+                break;
+            }
+        }
+        pthread_mutex_unlock(&trace_mutex);
+
+        // Flush the buffer once the thread exits
+        pthread_setspecific(exit_key, buffer);
+        return buffer;
+    }
+
+    /// Nanoseconds since the start of the trace
+    std::uint64_t trace_time()
+    {
+        return now_ns() - start_time;
+    }
+
+    /// Timestamp is taken by the caller, the order of the records is the order of the timestamps
+    void record(TraceOp op, void* address, std::size_t size, std::uint64_t extra, std::uint64_t timestamp)
+    {
+        if (trace_fd < 0 || in_hook)
+            return;
+
+        in_hook = true;
+
+        if (!thread_buffer) {
+            thread_buffer = acquire_buffer();
+        }
+
+        if (auto* buffer = thread_buffer) {
+            auto& r     = buffer->records[buffer->count++];
+            r.timestamp = timestamp;
+            r.address   = reinterpret_cast<std::uint64_t>(address);
+            r.size      = size;
+            r.extra     = extra;
+            r.thread    = buffer->thread;
+            r.op        = op;
+
+            if (buffer->count == buffer_capacity) {
+                pthread_mutex_lock(&trace_mutex);
+                flush_locked(buffer);
+                pthread_mutex_unlock(&trace_mutex);
+            }
+        }
+
+        in_hook = false;
+    }
+
+    /// Append the decimal digits of value at out, returns the end
+    char* append_number(char* out, char* end, unsigned long value)
+    {
+        char  digits[24];
+        char* first = digits + sizeof(digits);
+        do {
+            *--first = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value > 0);
+
+        while (first != digits + sizeof(digits) && out != end) {
+            *out++ = *first++;
+        }
+        return out;
+    }
+
+    /// The file name of ALLOC_TRACE_FILE with every %p replaced by the pid, or with the pid
+    /// appended if there is none. Children which exec with the recorder still preloaded would
+    /// truncate the parent's trace otherwise. Special files like /dev/null are used as they are
+    bool trace_path(char* path, std::size_t capacity)
+    {
+        const char* pattern = std::getenv("ALLOC_TRACE_FILE");
+        if (!pattern) {
+            pattern = "alloc.trace";
+        }
+
+        const auto pid     = static_cast<unsigned long>(getpid());
+        char*      out     = path;
+        char*      end     = path + capacity - 1;
+        bool       has_pid = false;
+        for (const char* in = pattern; *in && out != end; ++in) {
+            if (in[0] == '%' && in[1] == 'p') {
+                out     = append_number(out, end, pid);
+                has_pid = true;
+                ++in;
+            } else {
+                *out++ = *in;
+            }
+        }
+        struct stat st;
+        const bool  special = stat(pattern, &st) == 0 && !S_ISREG(st.st_mode);
+        if (!has_pid && !special && out != end) {
+            *out++ = '.';
+            out    = append_number(out, end, pid);
+        }
+        *out = '\0';
+        return out != end;
+    }
+
+    /// Create the trace file of this process and write the header
+    void open_trace()
+    {
+        char path[4096];
+        if (!trace_path(path, sizeof(path)))
+            return;
+
+        int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0)
+            return;
+
+        TraceHeader header{};
+        std::memcpy(header.magic, trace_magic, sizeof(header.magic));
+        header.version     = trace_version;
+        header.record_size = sizeof(TraceRecord);
+
+        start_time = now_ns();
+        trace_fd   = fd;
+        write_all(&header, sizeof(header));
+    }
+
+    /// No other thread may be in the middle of a flush while the process forks
+    void before_fork()
+    {
+        pthread_mutex_lock(&trace_mutex);
+    }
+
+    void after_fork_parent()
+    {
+        pthread_mutex_unlock(&trace_mutex);
+    }
+
+    /// The child only has the forking thread and copies of the parent's buffers and file, whose
+    /// records the parent writes itself. Drop them and start a trace of its own
+    void after_fork_child()
+    {
+        for (auto& buffer : live_buffers) {
+            if (buffer && buffer != thread_buffer) {
+                munmap(buffer, sizeof(ThreadBuffer));
+                buffer = nullptr;
+            }
+        }
+        if (thread_buffer) {
+            thread_buffer->thread = 0;
+            thread_buffer->count  = 0;
+        }
+        next_thread.store(thread_buffer ? 1 : 0, std::memory_order_relaxed);
+
+        if (trace_fd >= 0) {
+            close(trace_fd);
+            trace_fd = -1;
+            open_trace();
+        }
+        pthread_mutex_unlock(&trace_mutex);
+    }
+
+    __attribute__((constructor)) void start_trace()
+    {
+        pthread_key_create(&exit_key, release_buffer);
+        pthread_atfork(before_fork, after_fork_parent, after_fork_child);
+        open_trace();
+    }
+
+    __attribute__((destructor)) void stop_trace()
+    {
+        pthread_mutex_lock(&trace_mutex);
+        for (auto* buffer : live_buffers) {
+            if (buffer) {
+                flush_locked(buffer);
+            }
+        }
+
+        // Later calls aren't recorded anymore
+        close(trace_fd);
+        trace_fd = -1;
+        pthread_mutex_unlock(&trace_mutex);
+    }
+} // namespace
+
+extern "C" {
+
+void* malloc(std::size_t size)
+{
+    void* ptr = __libc_malloc(size);
+    record(TraceOp::malloc, ptr, size, 0, trace_time());
+    return ptr;
+}
+
+void* calloc(std::size_t num, std::size_t size)
+{
+    void* ptr = __libc_calloc(num, size);
+    record(TraceOp::calloc, ptr, num * size, 0, trace_time());
+    return ptr;
+}
+
+void* realloc(void* old, std::size_t size)
+{
+    // The old block may be handed to another thread before realloc returns and the new one may
+    // have been freed by another thread during the call, so the release of the old block is
+    // recorded before the call like a free and the new block after it like a malloc
+    if (old) {
+        record(TraceOp::realloc_release, old, 0, 0, trace_time());
+    }
+    void* ptr = __libc_realloc(old, size);
+    record(TraceOp::realloc, ptr, size, reinterpret_cast<std::uint64_t>(old), trace_time());
+    return ptr;
+}
+
+void* memalign(std::size_t alignment, std::size_t size)
+{
+    void* ptr = __libc_memalign(alignment, size);
+    record(TraceOp::memalign, ptr, size, alignment, trace_time());
+    return ptr;
+}
+
+void* aligned_alloc(std::size_t alignment, std::size_t size)
+{
+    return memalign(alignment, size);
+}
+
+int posix_memalign(void** out, std::size_t alignment, std::size_t size)
+{
+    // memalign rounds bad alignments up, posix_memalign has to reject them like glibc does
+    if (alignment % sizeof(void*) != 0 || (alignment & (alignment - 1)) != 0 || alignment == 0)
+        return EINVAL;
+
+    void* ptr = memalign(alignment, size);
+    if (!ptr && size != 0)
+        return ENOMEM;
+
+    *out = ptr;
+    return 0;
+}
+
+void free(void* ptr)
+{
+    if (ptr) {
+        record(TraceOp::free, ptr, 0, 0, trace_time());
+    }
+    __libc_free(ptr);
+}
+}
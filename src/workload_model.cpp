@@ -0,0 +1,299 @@
+#include "workload_model.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <queue>
+#include <random>
+#include <sstream>
+
+#include <fmt/format.h>
+
+#include "options.h"
+
+namespace
+{
+    /// Split "name:a:b" at the colons
+    std::vector<std::string> split_spec(std::string_view spec)
+    {
+        std::vector<std::string> parts;
+        std::size_t              start = 0;
+        while (true) {
+            const auto colon = spec.find(':', start);
+            parts.emplace_back(spec.substr(start, colon - start));
+            if (colon == std::string_view::npos)
+                break;
+            start = colon + 1;
+        }
+        return parts;
+    }
+
+    bool parse_number(const std::string& text, double& value)
+    {
+        char* end = nullptr;
+        value     = std::strtod(text.c_str(), &end);
+        return !text.empty() && end == text.c_str() + text.size() && std::isfinite(value);
+    }
+
+    /// Parse the parameters after the name into values, the ones not given keep their value
+    bool parse_parameters(const std::vector<std::string>& parts, std::size_t required, std::vector<double*> values, std::string& error)
+    {
+        if (parts.size() - 1 < required || parts.size() - 1 > values.size()) {
+            error = fmt::format("'{}' takes {} to {} parameters", parts[0], required, values.size());
+            return false;
+        }
+
+        for (std::size_t i = 1; i < parts.size(); ++i) {
+            if (!parse_number(parts[i], *values[i - 1]) || *values[i - 1] < 0) {
+                error = fmt::format("'{}' is not a valid parameter of '{}'", parts[i], parts[0]);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool read_histogram(const std::string& path, SizeDistribution& distribution, std::string& error)
+    {
+        std::ifstream file(path);
+        if (!file) {
+            error = fmt::format("can't open '{}'", path);
+            return false;
+        }
+
+        std::string line;
+        for (int number = 1; std::getline(file, line); ++number) {
+            line = line.substr(0, line.find('#'));
+
+            std::istringstream fields(line);
+            std::uint64_t      size   = 0;
+            double             weight = 0;
+            if (!(fields >> size)) {
+                // Blank or comment only
+                continue;
+            }
+            if (!(fields >> weight) || size == 0 || weight < 0) {
+                error = fmt::format("'{}' line {}: expected a size and a weight", path, number);
+                return false;
+            }
+
+            distribution.sizes.push_back(size);
+            distribution.weights.push_back(weight);
+        }
+
+        if (distribution.sizes.empty()) {
+            error = fmt::format("'{}' has no sizes", path);
+            return false;
+        }
+        return true;
+    }
+
+    /// Draws sizes from a SizeDistribution
+    class SizeSampler
+    {
+    public:
+        explicit SizeSampler(const SizeDistribution& distribution)
+            : distribution_(distribution), lognormal_(std::log(std::max(1.0, distribution.median)), distribution.sigma),
+              discrete_(distribution.weights.begin(), distribution.weights.end())
+        {
+        }
+
+        std::uint64_t operator()(std::mt19937_64& gen)
+        {
+            if (distribution_.kind == SizeDistribution::Kind::lognormal) {
+                // Cut off the tail at the largest size of the other tests
+                const double size = std::clamp(lognormal_(gen), 1.0, static_cast<double>(1UL << max_size_power));
+                return static_cast<std::uint64_t>(size);
+            }
+            return distribution_.sizes[discrete_(gen)];
+        }
+
+    private:
+        const SizeDistribution&          distribution_;
+        std::lognormal_distribution<>    lognormal_;
+        std::discrete_distribution<std::size_t> discrete_;
+    };
+
+    /// Draws lifetimes in allocations from a LifetimeModel, 0 means until the end
+    class LifetimeSampler
+    {
+    public:
+        explicit LifetimeSampler(const LifetimeModel& model) : model_(model) {}
+
+        std::uint64_t operator()(std::mt19937_64& gen)
+        {
+            switch (model_.kind) {
+            case LifetimeModel::Kind::exponential:
+                return exponential(model_.mean, gen);
+            case LifetimeModel::Kind::pareto: {
+                // Inverse of the CDF, 1 - uniform is in (0, 1]
+                const double u = 1.0 - std::uniform_real_distribution<>(0.0, 1.0)(gen);
+                return to_lifetime(std::max(1.0, model_.minimum) / std::pow(u, 1.0 / std::max(model_.alpha, 1e-3)));
+            }
+            case LifetimeModel::Kind::generational:
+                if (std::bernoulli_distribution(std::clamp(model_.short_fraction, 0.0, 1.0))(gen)) {
+                    return exponential(model_.short_mean, gen);
+                }
+                return model_.long_mean > 0 ? exponential(model_.long_mean, gen) : 0;
+            }
+            return 1;
+        }
+
+    private:
+        static std::uint64_t to_lifetime(double value)
+        {
+            // Everything beyond 2^62 allocations lives until the end anyway
+            return static_cast<std::uint64_t>(std::clamp(std::ceil(value), 1.0, 0x1p62));
+        }
+
+        static std::uint64_t exponential(double mean, std::mt19937_64& gen)
+        {
+            return to_lifetime(std::exponential_distribution<>(1.0 / std::max(mean, 1e-3))(gen));
+        }
+
+        const LifetimeModel& model_;
+    };
+} // namespace
+
+bool parse_size_distribution(std::string_view spec, SizeDistribution& distribution, std::string& error)
+{
+    const auto parts = split_spec(spec);
+    distribution     = {};
+
+    if (parts[0] == "lognormal") {
+        distribution.kind = SizeDistribution::Kind::lognormal;
+        return parse_parameters(parts, 2, {&distribution.median, &distribution.sigma}, error);
+    }
+
+    if (parts[0] == "zipf") {
+        double exponent = 1.0;
+        double largest  = 64 * kilobyte;
+        if (!parse_parameters(parts, 1, {&exponent, &largest}, error))
+            return false;
+
+        // Four classes per power of two, like the pool backend
+        distribution.kind = SizeDistribution::Kind::zipf;
+        for (std::uint64_t p = 16; p <= largest; p *= 2) {
+            for (std::uint64_t q = 0; q < 4; ++q) {
+                const std::uint64_t size = (p + q * p / 4 + 15) & ~std::uint64_t(15);
+                if (size <= largest && (distribution.sizes.empty() || size > distribution.sizes.back())) {
+                    distribution.sizes.push_back(size);
+                    distribution.weights.push_back(1.0 / std::pow(distribution.sizes.size(), exponent));
+                }
+            }
+        }
+        if (distribution.sizes.empty()) {
+            error = "the largest class of 'zipf' has to be at least 16";
+            return false;
+        }
+        return true;
+    }
+
+    if (parts[0] == "hist") {
+        if (parts.size() < 2 || parts[1].empty()) {
+            error = "'hist' needs a file";
+            return false;
+        }
+        // The path may contain colons itself
+        distribution.kind = SizeDistribution::Kind::histogram;
+        return read_histogram(std::string(spec.substr(spec.find(':') + 1)), distribution, error);
+    }
+
+    error = fmt::format("unknown size distribution '{}', use 'lognormal', 'zipf' or 'hist'", parts[0]);
+    return false;
+}
+
+bool parse_lifetime_model(std::string_view spec, LifetimeModel& model, std::string& error)
+{
+    const auto parts = split_spec(spec);
+    model            = {};
+
+    if (parts[0] == "exp") {
+        model.kind = LifetimeModel::Kind::exponential;
+        return parse_parameters(parts, 1, {&model.mean}, error);
+    }
+
+    if (parts[0] == "pareto") {
+        model.kind = LifetimeModel::Kind::pareto;
+        return parse_parameters(parts, 2, {&model.alpha, &model.minimum}, error);
+    }
+
+    if (parts[0] == "gen") {
+        model.kind = LifetimeModel::Kind::generational;
+        return parse_parameters(parts, 2, {&model.short_fraction, &model.short_mean, &model.long_mean}, error);
+    }
+
+    error = fmt::format("unknown lifetime model '{}', use 'exp', 'pareto' or 'gen'", parts[0]);
+    return false;
+}
+
+OpStream modeled_stream(long ipow, std::uint64_t seed)
+{
+    const std::uint64_t allocs = 1UL << ipow;
+
+    std::mt19937_64 gen(seed);
+    SizeSampler     next_size(model_sizes);
+    LifetimeSampler next_lifetime(model_lifetimes);
+
+    OpStream stream;
+    stream.ops.reserve(2 * allocs);
+
+    // Live blocks by the allocation after which they die, the earliest first
+    using Death = std::pair<std::uint64_t, std::uint32_t>;
+    std::priority_queue<Death, std::vector<Death>, std::greater<>> deaths;
+
+    std::vector<std::uint64_t> sizes;
+    std::vector<std::uint32_t> unused;
+    std::uint64_t              live_bytes = 0;
+
+    auto free_slot = [&](std::uint32_t slot) {
+        stream.push(OpKind::free, slot);
+        unused.push_back(slot);
+        live_bytes -= sizes[slot];
+    };
+
+    for (std::uint64_t i = 0; i < allocs; ++i) {
+        while (!deaths.empty() && deaths.top().first <= i) {
+            free_slot(deaths.top().second);
+            deaths.pop();
+        }
+
+        std::uint32_t slot = sizes.size();
+        if (!unused.empty()) {
+            slot = unused.back();
+            unused.pop_back();
+        } else {
+            sizes.push_back(0);
+        }
+
+        sizes[slot] = next_size(gen);
+        stream.push(OpKind::alloc, slot, sizes[slot]);
+        live_bytes += sizes[slot];
+
+        const auto lifetime = next_lifetime(gen);
+        deaths.emplace(lifetime == 0 || lifetime > allocs ? allocs + lifetime : i + lifetime, slot);
+
+        // The second half is considered steady state
+        if (i % 1024 == 1023) {
+            stream.sample(live_bytes, i >= allocs / 2);
+        }
+    }
+
+    while (!deaths.empty()) {
+        free_slot(deaths.top().second);
+        deaths.pop();
+    }
+
+    return stream;
+}
+
+std::vector<std::uint64_t> sample_sizes(std::size_t count, std::uint64_t seed)
+{
+    std::mt19937_64 gen(seed);
+    SizeSampler     next_size(model_sizes);
+
+    std::vector<std::uint64_t> sizes(count);
+    std::generate(sizes.begin(), sizes.end(), [&] { return next_size(gen); });
+    return sizes;
+}